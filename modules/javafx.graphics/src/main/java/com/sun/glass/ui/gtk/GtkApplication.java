@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -56,6 +56,10 @@ final class GtkApplication extends Application implements
                                     InvokeLaterDispatcher.InvokeLaterSubmitter {
     private static final int forcedGtkVersion;
     private static boolean gtkVersionWarningIssued = false;
+
+    // Pulse once per display refresh instead of on a millisecond timer
+    private static final boolean vsyncTimer =
+            !"false".equals(System.getProperty("glass.gtk.vsyncTimer"));
     private static final String GTK2_REMOVED_WARNING =
             "WARNING: A command line option tried to select the GTK 2 library, which was removed from JavaFX.";
 
@@ -400,9 +404,14 @@ final class GtkApplication extends Application implements
     protected native int staticTimer_getMaxPeriod();
 
     @Override protected double staticScreen_getVideoRefreshPeriod() {
-        return 0.0;     // indicate millisecond resolution
+        if (!vsyncTimer) {
+            return 0.0;     // indicate millisecond resolution
+        }
+        return _getVideoRefreshPeriod();
     }
 
+    private native double _getVideoRefreshPeriod();
+
     @Override native protected Screen[] staticScreen_getScreens();
 
     @Override
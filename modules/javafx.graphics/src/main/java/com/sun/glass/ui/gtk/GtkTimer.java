@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,23 +24,50 @@
  */
 package com.sun.glass.ui.gtk;
 
+import com.sun.glass.ui.Screen;
 import com.sun.glass.ui.Timer;
 
 final class GtkTimer extends Timer{
 
+    private long vsyncTimer;
+
     public GtkTimer(Runnable runnable) {
         super(runnable);
     }
 
+    /**
+     * Starts a timer that runs the runnable on its own thread once per
+     * refresh of the fastest monitor. If that thread can not be started, the
+     * millisecond timer runs at the refresh rate instead.
+     */
     @Override protected long _start(Runnable runnable) {
-        throw new RuntimeException("vsync timer not supported");
+        double period = Screen.getVideoRefreshPeriod();
+        if (period <= 0.0) {
+            throw new RuntimeException("vsync timer not supported");
+        }
+        vsyncTimer = _startVsync(runnable, period);
+        if (vsyncTimer == 0L) {
+            return _start(runnable, Math.max(1, (int) period));
+        }
+        return vsyncTimer;
     }
 
     @Override
     protected native long _start(Runnable runnable, int period);
 
     @Override
-    protected native void _stop(long timer);
+    protected void _stop(long timer) {
+        if (timer == vsyncTimer) {
+            vsyncTimer = 0L;
+            _stopVsync(timer);
+        } else {
+            _stopTimer(timer);
+        }
+    }
+
+    private native long _startVsync(Runnable runnable, double period);
+    private native void _stopVsync(long timer);
+    private native void _stopTimer(long timer);
 
     @Override protected void _pause(long timer) {}
     @Override protected void _resume(long timer) {}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -196,6 +196,11 @@ class EGL {
             long nativeWindow,
             int[] attribs);
 
+    native long eglCreatePbufferSurface(
+            long eglDisplay,
+            long eglConfig,
+            int[] attribs);
+
     native boolean eglDestroyContext(long eglDisplay, long eglContext);
 
     native boolean eglGetConfigAttrib(
@@ -206,6 +211,12 @@ class EGL {
 
     native long eglGetDisplay(long nativeDisplay);
 
+    /** Gets a display for the given EGL_EXT_platform_base platform.
+     * @return the display, or EGL_NO_DISPLAY if the EGL implementation does
+     * not support platform displays
+     */
+    native long eglGetPlatformDisplay(int platform, long nativeDisplay);
+
     native int eglGetError();
 
     native boolean eglInitialize(long eglDisplay, int[] major,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -235,6 +235,8 @@ class EPDScreen implements NativeScreen {
     @Override
     public synchronized void swapBuffers() {
         if (!isShutdown && pixels.hasReceivedData()) {
+            // A mapped frame buffer is displayed without being written
+            pixels.applyPendingClear();
             writeBuffer();
             fbDevice.sync();
             pixels.reset();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,6 +38,7 @@ import java.nio.file.Path;
 import java.nio.file.StandardOpenOption;
 import java.nio.IntBuffer;
 import java.nio.ShortBuffer;
+import java.util.Arrays;
 import java.util.function.IntConsumer;
 
 class FBDevScreen implements NativeScreen {
@@ -51,6 +52,9 @@ class FBDevScreen implements NativeScreen {
     private Framebuffer fb;
     private LinuxFrameBuffer linuxFB;
     private final String fbDevPath;
+    private int[] copyStart, copyEnd;
+    private int[] lastDamageStart, lastDamageEnd;
+    private int fullFrames;
 
     FBDevScreen() {
         String tmp = System.getProperty("monocle.screen.fb", "/dev/fb0");
@@ -139,20 +143,21 @@ class FBDevScreen implements NativeScreen {
         // The Framebuffer obect must be created lazily. If we are running with
         // the ES2 pipeline then we won't need the framebuffer until shutdown time.
         if (fb == null) {
-            ByteBuffer bb;
-            if (linuxFB.getDepth() == 32 && linuxFB.canDoubleBuffer()) {
-                // Only map 32-bit framebuffers with enough space for two
-                // full screens
-                mappedFB = linuxFB.getMappedBuffer();
-            }
-            if (mappedFB != null) {
-                bb = mappedFB;
-            } else {
-                bb = ByteBuffer.allocateDirect(getWidth() * getHeight() * 4);
-            }
+            // Windows are composed in memory and only the pixels that changed
+            // are copied to the framebuffer, which is usually uncached.
+            ByteBuffer bb = ByteBuffer.allocateDirect(getWidth() * getHeight() * 4);
             bb.order(ByteOrder.nativeOrder());
             fb = new Framebuffer(bb, getWidth(), getHeight(), getDepth(), true);
-            fb.setStartAddress(linuxFB.getNextAddress());
+            if (linuxFB.getDepth() == 32 || linuxFB.getDepth() == 16) {
+                mappedFB = linuxFB.getMappedBuffer();
+            }
+            copyStart = new int[getHeight()];
+            copyEnd = new int[getHeight()];
+            lastDamageStart = new int[getHeight()];
+            lastDamageEnd = new int[getHeight()];
+            fb.clearDamage(lastDamageStart, lastDamageEnd);
+            // Each buffer starts out with unknown contents
+            fullFrames = linuxFB.isDoubleBuffer() ? 2 : 1;
         }
         return fb;
     }
@@ -228,10 +233,35 @@ class FBDevScreen implements NativeScreen {
             }
             fbdev.position(linuxFB.getNextAddress());
             getFramebuffer().write(fbdev);
-        } else if (linuxFB.isDoubleBuffer()) {
-            linuxFB.next();
-            linuxFB.vSync();
-            getFramebuffer().setStartAddress(linuxFB.getNextAddress());
+        } else {
+            Framebuffer framebuffer = getFramebuffer();
+            if (fullFrames > 0) {
+                Arrays.fill(copyStart, 0);
+                Arrays.fill(copyEnd, getWidth());
+                fullFrames--;
+            } else if (linuxFB.isDoubleBuffer()) {
+                // The back buffer still shows the frame before the last one
+                System.arraycopy(lastDamageStart, 0, copyStart, 0, copyStart.length);
+                System.arraycopy(lastDamageEnd, 0, copyEnd, 0, copyEnd.length);
+            } else {
+                framebuffer.clearDamage(copyStart, copyEnd);
+            }
+            framebuffer.addDamageTo(copyStart, copyEnd);
+            framebuffer.clearDamage(lastDamageStart, lastDamageEnd);
+            framebuffer.addDamageTo(lastDamageStart, lastDamageEnd);
+            linuxFB.copyRows(framebuffer.getBuffer(), mappedFB, linuxFB.getNextAddress(),
+                             copyStart, copyEnd);
+            if (linuxFB.isDoubleBuffer()) {
+                try {
+                    linuxFB.next();
+                } catch (IOException e) {
+                    // Panning is off from now on, so the visible buffer is
+                    // written next and may not hold the last frame
+                    fullFrames = 1;
+                    throw e;
+                }
+                linuxFB.vSync();
+            }
         }
     }
 
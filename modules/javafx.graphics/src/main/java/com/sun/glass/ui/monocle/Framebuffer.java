@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,10 +32,24 @@ import java.nio.ByteOrder;
 import java.nio.IntBuffer;
 import java.nio.ShortBuffer;
 import java.nio.channels.WritableByteChannel;
+import java.util.Arrays;
+import java.util.BitSet;
 
 /**
  * A ByteBuffer used as a rendering target for window composition. Stored as
  * 32-bit and can write to a 16-bit or 32-bit target.
+ * <p>
+ * The pixels of each row that changed since the last call to reset() are
+ * tracked as a span, so that a screen can present only those. Every upload
+ * is compared with the previous contents of the buffer and only the pixels
+ * that differ are written and counted as changed.
+ * <p>
+ * If the buffer is cleared, the clear is deferred until the frame is read, and
+ * then covers only the pixels that no upload of the frame wrote. Pixels that
+ * are overwritten anyway are therefore compared with the last frame instead
+ * of the cleared background. Where uploads of the same frame overlap, the
+ * later ones are compared with what the earlier ones wrote, so such pixels
+ * count as changed even when the final result is the same as before.
  */
 class Framebuffer {
 
@@ -45,9 +59,16 @@ class Framebuffer {
     private int byteDepth;
     private boolean receivedData;
     private ByteBuffer clearBuffer;
+    private final BitSet written;
+    private boolean clearPending;
     private ByteBuffer lineByteBuffer;
     private Buffer linePixelBuffer;
     private int address;
+    private final int[] damageStart;
+    private final int[] damageEnd;
+
+    /** Compare opaque uploads in runs of this many pixels from the end of a row */
+    private static final int MISMATCH_CHUNK = 64;
 
     Framebuffer(ByteBuffer bb, int width, int height, int depth, boolean clear) {
         this.bb = bb;
@@ -56,16 +77,52 @@ class Framebuffer {
         this.byteDepth = depth >>> 3;
         if (clear) {
             clearBuffer = ByteBuffer.allocate(width * 4);
+            written = new BitSet(width * height);
+        } else {
+            written = null;
         }
+        damageStart = new int[height];
+        damageEnd = new int[height];
+        clearDamage(damageStart, damageEnd);
     }
 
     ByteBuffer getBuffer() {
+        applyPendingClear();
         bb.clear();
         return bb;
     }
 
     void reset() {
+        applyPendingClear();
         receivedData = false;
+        clearDamage(damageStart, damageEnd);
+    }
+
+    /**
+     * Marks every row of the given spans as unchanged. A row y is changed
+     * from pixel starts[y] up to, but not including, pixel ends[y].
+     */
+    void clearDamage(int[] starts, int[] ends) {
+        Arrays.fill(starts, width);
+        Arrays.fill(ends, 0);
+    }
+
+    /** Extends the given spans by the pixels changed since the last reset() */
+    void addDamageTo(int[] starts, int[] ends) {
+        applyPendingClear();
+        for (int y = 0; y < height; y++) {
+            if (damageStart[y] < damageEnd[y]) {
+                starts[y] = Math.min(starts[y], damageStart[y]);
+                ends[y] = Math.max(ends[y], damageEnd[y]);
+            }
+        }
+    }
+
+    private void addDamage(int x, int y, int w, int h) {
+        for (int i = y; i < y + h; i++) {
+            damageStart[i] = Math.min(damageStart[i], x);
+            damageEnd[i] = Math.max(damageEnd[i], x + w);
+        }
     }
 
     void setStartAddress(int address) {
@@ -73,12 +130,34 @@ class Framebuffer {
     }
 
     void clearBufferContents() {
-        bb.clear();
-        bb.position(address);
-        bb.limit(address + width * height * 4);
-        for (int i = 0; i < height; i++) {
-            clearBuffer.clear();
-            bb.put(clearBuffer);
+        written.clear();
+        clearPending = true;
+        applyPendingClear();
+    }
+
+    /**
+     * Clears the pixels that no upload wrote since the first upload of the
+     * frame, if that upload left the buffer to be cleared.
+     */
+    void applyPendingClear() {
+        if (!clearPending) {
+            return;
+        }
+        clearPending = false;
+        IntBuffer dstPixels = bb.duplicate().clear().order(bb.order()).asIntBuffer();
+        IntBuffer clearPixels = clearBuffer.duplicate().clear().asIntBuffer();
+        for (int y = 0; y < height; y++) {
+            int rowStart = y * width;
+            int rowEnd = rowStart + width;
+            int x = written.nextClearBit(rowStart);
+            while (x < rowEnd) {
+                int end = written.nextSetBit(x);
+                if (end < 0 || end > rowEnd) {
+                    end = rowEnd;
+                }
+                copyChangedRow(dstPixels, clearPixels, 0, x - rowStart, y, end - x);
+                x = written.nextClearBit(end);
+            }
         }
     }
 
@@ -111,11 +190,14 @@ class Framebuffer {
         if (pW < 0 || pH < 0 || alphaMultiplier <= 0) {
             return;
         }
-        // If clearBuffer is set, clear the buffer on the first upload of each
-        // frame, unless that upload already overwrites the whole buffer.
+        // If clearBuffer is set, the buffer is cleared on the first upload of
+        // each frame, unless that upload already overwrites the whole buffer.
+        // The first upload is copied, so only the pixels that no upload writes
+        // need the clear, which waits until the frame is read.
         if (!receivedData && clearBuffer != null) {
-            if (alphaMultiplier < 256 || start != 0 || pW != width || pH != height) {
-                clearBufferContents();
+            if (pW != width || pH != height) {
+                written.clear();
+                clearPending = true;
             }
         }
         bb.position(address + pX * 4 + pY * width * 4);
@@ -130,68 +212,116 @@ class Framebuffer {
                 srcPixels = ((ByteBuffer) src).asIntBuffer();
             }
             IntBuffer dstPixels = bb.asIntBuffer();
+            if (alphaMultiplier >= 255) {
+                alphaMultiplier = 256;
+            }
             for (int i = 0; i < pH; i++) {
                 int dstPosition = i * width;
                 int srcPosition = (start + i * stride) >> 2;
-                if (alphaMultiplier >= 255) {
-                    for (int j = 0; j < pW; j++) {
-                        int srcPixel = srcPixels.get(srcPosition + j);
-                        int srcA = (srcPixel >> 24) & 0xff;
-                        if (srcA == 0xff) {
-                            dstPixels.put(dstPosition + j, srcPixel);
-                        } else {
-                            dstPixels.put(dstPosition + j,
-                                          blend32(srcPixel,
-                                                  dstPixels.get(dstPosition + j),
-                                                  256));
-                        }
+                int bitPosition = pX + (pY + i) * width;
+                int first = -1;
+                int last = -1;
+                for (int j = 0; j < pW; j++) {
+                    int srcPixel = srcPixels.get(srcPosition + j);
+                    int dstPixel = dstPixels.get(dstPosition + j);
+                    int pixel;
+                    if (alphaMultiplier == 256 && (srcPixel >>> 24) == 0xff) {
+                        pixel = srcPixel;
+                    } else if (clearPending && !written.get(bitPosition + j)) {
+                        // Blend with the cleared background, which is zero
+                        pixel = blend32(srcPixel, 0, alphaMultiplier);
+                    } else {
+                        pixel = blend32(srcPixel, dstPixel, alphaMultiplier);
                     }
-                } else {
-                    for (int j = 0; j < pW; j++) {
-                        dstPixels.put(dstPosition + j,
-                                      blend32(srcPixels.get(srcPosition + j),
-                                              dstPixels.get(dstPosition + j),
-                                              alphaMultiplier));
+                    if (pixel != dstPixel) {
+                        dstPixels.put(dstPosition + j, pixel);
+                        if (first < 0) {
+                            first = j;
+                        }
+                        last = j;
                     }
                 }
+                if (first >= 0) {
+                    addDamage(pX + first, pY + i, last + 1 - first, 1);
+                }
             }
         } else {
-            if (pW == width) {
-                if (src instanceof ByteBuffer) {
-                    src.position(start);
-                    src.limit(stride * pH);
-                    bb.put((ByteBuffer) src);
-                } else {
-                    IntBuffer srcPixels = (IntBuffer) src;
-                    srcPixels.position(start >> 2);
-                    srcPixels.limit((stride * pH) >> 2);
-                    bb.asIntBuffer().put(srcPixels);
-                }
-            } else {
-                if (src instanceof ByteBuffer) {
-                    for (int i = 0; i < pH; i++) {
-                        bb.position(address + pX * 4 + (pY + i) * width * 4);
-                        src.limit(start + i * stride + pW * 4);
-                        src.position(start + i * stride);
-                        bb.put((ByteBuffer) src);
-                    }
-                } else {
-                    bb.position(address);
-                    bb.limit(address + width * height * 4);
-                    IntBuffer dstPixels = bb.asIntBuffer();
-                    IntBuffer srcPixels = (IntBuffer) src;
-                    for (int i = 0; i < pH; i++) {
-                        dstPixels.position(pX + (pY + i) * width);
-                        srcPixels.limit(pW + ((start + i * stride) >> 2));
-                        srcPixels.position((start + i * stride) >> 2);
-                        dstPixels.put((IntBuffer) src);
-                    }
-                }
+            copyChangedPixels(src, start, stride, pX, pY, pW, pH);
+        }
+        if (clearPending) {
+            for (int i = pY; i < pY + pH; i++) {
+                written.set(pX + i * width, pX + pW + i * width);
             }
         }
         receivedData = true;
     }
 
+    /**
+     * Copies the pixels of the first upload of a frame into the buffer,
+     * skipping the pixels at the start and end of each row that are already
+     * the same.
+     */
+    private void copyChangedPixels(Buffer src, int start, int stride,
+                                   int pX, int pY, int pW, int pH) {
+        IntBuffer srcPixels;
+        if (src instanceof IntBuffer) {
+            srcPixels = ((IntBuffer) src).duplicate().clear();
+        } else {
+            // Compare the bytes as ints in the byte order of the target
+            srcPixels = ((ByteBuffer) src).duplicate().clear()
+                    .order(bb.order()).asIntBuffer();
+        }
+        IntBuffer dstPixels = bb.duplicate().clear().order(bb.order()).asIntBuffer();
+        for (int i = 0; i < pH; i++) {
+            int srcPosition = (start + i * stride) >> 2;
+            copyChangedRow(dstPixels, srcPixels, srcPosition, pX, pY + i, pW);
+        }
+    }
+
+    /**
+     * Copies w pixels from srcPosition to pixel x of row y, skipping the
+     * pixels at the start and end that are already the same.
+     */
+    private void copyChangedRow(IntBuffer dstPixels, IntBuffer srcPixels,
+                                int srcPosition, int x, int y, int w) {
+        int dstPosition = (address >> 2) + x + y * width;
+        int first = dstPixels.slice(dstPosition, w)
+                .mismatch(srcPixels.slice(srcPosition, w));
+        if (first < 0) {
+            return;
+        }
+        int last = lastMismatch(dstPixels, dstPosition,
+                                srcPixels, srcPosition, first, w);
+        dstPixels.put(dstPosition + first, srcPixels,
+                      srcPosition + first, last + 1 - first);
+        addDamage(x + first, y, last + 1 - first, 1);
+    }
+
+    /**
+     * Returns the index of the last of the length pixels starting at
+     * aOffset and bOffset that differ, given that the pixels at index first
+     * differ.
+     */
+    private static int lastMismatch(IntBuffer a, int aOffset,
+                                    IntBuffer b, int bOffset,
+                                    int first, int length) {
+        int end = length;
+        while (end - first > MISMATCH_CHUNK) {
+            int chunkStart = end - MISMATCH_CHUNK;
+            if (a.slice(aOffset + chunkStart, MISMATCH_CHUNK)
+                    .mismatch(b.slice(bOffset + chunkStart, MISMATCH_CHUNK)) >= 0) {
+                break;
+            }
+            end = chunkStart;
+        }
+        for (int i = end - 1; i > first; i--) {
+            if (a.get(aOffset + i) != b.get(bOffset + i)) {
+                return i;
+            }
+        }
+        return first;
+    }
+
     private static int blend32(int src, int dst, int alphaMultiplier) {
         int srcA = (((src >> 24) & 0xff) * alphaMultiplier) >> 8;
         int srcR = (src >> 16) & 0xff;
@@ -209,6 +339,7 @@ class Framebuffer {
     }
 
     void write(WritableByteChannel out) throws IOException {
+        applyPendingClear();
         bb.clear();
         if (byteDepth == 4) {
             out.write(bb);
@@ -237,6 +368,7 @@ class Framebuffer {
     }
 
     void copyToBuffer(ByteBuffer out) {
+        applyPendingClear();
         bb.clear();
         if (byteDepth == 4) {
             out.put(bb);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,9 +68,8 @@ class FramebufferY8 extends Framebuffer {
      * @param height the height of the composition buffer in pixels
      * @param depth the color depth of the target channel or buffer in bits per
      * pixel
-     * @param clear {@code true} to clear the composition buffer on the first
-     * upload of each frame unless that upload already overwrites the entire
-     * buffer; otherwise {@code false}
+     * @param clear {@code true} to clear the pixels of the composition buffer
+     * that no upload of a frame writes; otherwise {@code false}
      */
     FramebufferY8(ByteBuffer bb, int width, int height, int depth, boolean clear) {
         super(bb, width, height, depth, clear);
@@ -142,6 +141,7 @@ class FramebufferY8 extends Framebuffer {
      */
     @Override
     void write(WritableByteChannel out) throws IOException {
+        applyPendingClear();
         bb.clear();
         switch (byteDepth) {
             case Byte.BYTES: {
@@ -201,6 +201,7 @@ class FramebufferY8 extends Framebuffer {
      */
     @Override
     void copyToBuffer(ByteBuffer out) {
+        applyPendingClear();
         bb.clear();
         switch (byteDepth) {
             case Byte.BYTES: {
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import java.nio.ByteBuffer;
+
+/**
+ * An AcceleratedScreen that renders into an EGL pbuffer the size of the
+ * headless screen. When the EGL implementation offers the Mesa surfaceless
+ * platform the display is opened on it, so that a software rasterizer such
+ * as llvmpipe can be used without any display server or DRM device.
+ * Once a Robot has been created, each completed frame is read back into
+ * the headless screen, where the Robot captures it from. Without a Robot
+ * nothing reads the capture, so frames are not read back.
+ */
+class HeadlessEGLAcceleratedScreen extends AcceleratedScreen {
+
+    /** From EGL_MESA_platform_surfaceless */
+    private static final int EGL_PLATFORM_SURFACELESS_MESA = 0x31DD;
+
+    /** Index of GLPixelFormat.Attributes.ONSCREEN in the attribute array */
+    private static final int ONSCREEN = 6;
+
+    /** Set once a Robot may read the screen capture */
+    private static volatile boolean captureEnabled;
+    /** Set once a screen has been created, so frames may have been skipped */
+    private static volatile boolean created;
+
+    private final EGL egl;
+    private final NativeScreen screen;
+    private final int width;
+    private final int height;
+
+    HeadlessEGLAcceleratedScreen(int[] attributes, NativeScreen screen)
+            throws GLException, UnsatisfiedLinkError {
+        egl = EGL.getEGL();
+        this.screen = screen;
+        width = screen.getWidth();
+        height = screen.getHeight();
+        created = true;
+        initPlatformLibraries();
+
+        int major[] = {0}, minor[] = {0};
+        eglDisplay = getDisplay();
+        if (eglDisplay == EGL.EGL_NO_DISPLAY) {
+            throw new GLException(egl.eglGetError(),
+                                  "Could not get EGL display");
+        }
+
+        if (!egl.eglInitialize(eglDisplay, major, minor)) {
+            throw new GLException(egl.eglGetError(),
+                                  "Error initializing EGL");
+        }
+
+        if (!egl.eglBindAPI(EGL.EGL_OPENGL_ES_API)) {
+            throw new GLException(egl.eglGetError(),
+                                  "Error binding OPENGL API");
+        }
+
+        // Ask for a config that supports pbuffers rather than windows
+        int[] pbufferAttributes = attributes.clone();
+        pbufferAttributes[ONSCREEN] = 0;
+        int configCount[] = {0};
+        if (!egl.eglChooseConfig(eglDisplay, pbufferAttributes, eglConfigs,
+                                 1, configCount) || configCount[0] == 0) {
+            throw new GLException(egl.eglGetError(),
+                                  "Error choosing EGL config");
+        }
+
+        int surfaceAttributes[] = {
+            EGL.EGL_WIDTH, width,
+            EGL.EGL_HEIGHT, height,
+            EGL.EGL_NONE
+        };
+        eglSurface = egl.eglCreatePbufferSurface(eglDisplay, eglConfigs[0],
+                                                 surfaceAttributes);
+        if (eglSurface == EGL.EGL_NO_SURFACE) {
+            throw new GLException(egl.eglGetError(),
+                                  "Could not get EGL pbuffer surface");
+        }
+
+        int emptyAttrArray [] = {};
+        eglContext = egl.eglCreateContext(eglDisplay, eglConfigs[0],
+                0, emptyAttrArray);
+        if (eglContext == EGL.EGL_NO_CONTEXT) {
+            throw new GLException(egl.eglGetError(),
+                                  "Could not get EGL context");
+        }
+    }
+
+    private long getDisplay() {
+        // Client extensions are queried without a display
+        String extensions = egl.eglQueryString(EGL.EGL_NO_DISPLAY,
+                                               EGL.EGL_EXTENSIONS);
+        if (extensions != null
+                && extensions.contains("EGL_MESA_platform_surfaceless")) {
+            long display = egl.eglGetPlatformDisplay(
+                    EGL_PLATFORM_SURFACELESS_MESA, EGL.EGL_DEFAULT_DISPLAY);
+            if (display != EGL.EGL_NO_DISPLAY) {
+                return display;
+            }
+        }
+        // Querying without a display fails when client extensions are not
+        // supported; clear the error before trying the default display.
+        egl.eglGetError();
+        return egl.eglGetDisplay(EGL.EGL_DEFAULT_DISPLAY);
+    }
+
+    @Override
+    public void enableRendering(boolean flag) {
+        if (flag) {
+            egl.eglMakeCurrent(eglDisplay, eglSurface, eglSurface,
+                               eglContext);
+        } else {
+            egl.eglMakeCurrent(eglDisplay, 0, 0, eglContext);
+        }
+    }
+
+    /**
+     * Starts reading frames back into the screen capture.
+     *
+     * @return true if frames have been rendered without being read back,
+     * so the windows have to be painted again to fill the capture
+     */
+    static boolean enableCapture() {
+        boolean skipped = !captureEnabled && created;
+        captureEnabled = true;
+        return skipped;
+    }
+
+    /** A pbuffer has no front buffer to present to, so a frame is complete
+     * once it has been rendered into the surface. While capture is enabled
+     * the frame is copied into the screen capture of the headless screen,
+     * which only supports 32 bit pixels.
+     *
+     * @return true
+     */
+    @Override
+    public boolean swapBuffers() {
+        if (captureEnabled && screen.getDepth() == 32) {
+            synchronized (NativeScreen.framebufferSwapLock) {
+                ByteBuffer capture = screen.getScreenCapture();
+                if (capture.hasArray()) {
+                    _readPixels(capture.array(), width, height);
+                }
+            }
+        }
+        return true;
+    }
+
+    private native boolean _readPixels(byte[] pixels, int width, int height);
+
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -124,6 +124,86 @@ class LinuxEventBuffer {
         return isSync;
     }
 
+    /**
+     * Adds as many of the raw Linux events between the position and limit of
+     * the given buffer as fit, advancing its position past the events added.
+     * Does not block, so that a reader serving several devices is not held up
+     * by one of them. Call dropPartialEvent() when events remain.
+     *
+     * @param events A ByteBuffer containing whole events to be added.
+     * @return true if one of the events added was "SYN SYN_REPORT", false
+     * otherwise
+     */
+    synchronized boolean putAll(ByteBuffer events) {
+        int size = eventStruct.getSize();
+        int limit = events.limit();
+        int count = Math.min(limit - events.position(), bb.limit() - bb.position()) / size;
+        boolean isSync = false;
+        for (int i = 0; i < count; i++) {
+            int index = events.position() + i * size;
+            if (isSync(events, index)) {
+                positionOfLastSync = bb.position() + i * size;
+                isSync = true;
+            }
+            if (MonocleSettings.settings.traceEventsVerbose) {
+                short type = events.getShort(index + eventStruct.getTypeIndex());
+                short code = events.getShort(index + eventStruct.getCodeIndex());
+                String typeStr = LinuxInput.typeToString(type);
+                MonocleTrace.traceEvent("Read %s %s %d [index=%d]",
+                                        typeStr,
+                                        LinuxInput.codeToString(typeStr, code),
+                                        events.getInt(index + eventStruct.getValueIndex()),
+                                        bb.position() + i * size);
+            }
+        }
+        events.limit(events.position() + count * size);
+        bb.put(events);
+        events.limit(limit);
+        return isSync;
+    }
+
+    /**
+     * Discards the event lines after the last "SYN SYN_REPORT" in the buffer,
+     * which belong to an event whose remaining lines did not fit. The
+     * complete events before them are kept.
+     */
+    synchronized void dropPartialEvent() {
+        int end = 0;
+        if (positionOfLastSync >= 0 && positionOfLastSync < bb.position()
+                && isSync(bb, positionOfLastSync)) {
+            end = positionOfLastSync + eventStruct.getSize();
+        }
+        if (MonocleSettings.settings.traceEvents) {
+            MonocleTrace.traceEvent("Event buffer %s is full, dropping %d event lines",
+                                    bb, (bb.position() - end) / eventStruct.getSize());
+        }
+        bb.position(end);
+    }
+
+    /**
+     * Advances the position of the given buffer of raw Linux events past the
+     * next "SYN SYN_REPORT", or to its limit if there is none.
+     *
+     * @param events A ByteBuffer containing whole events to be skipped.
+     * @return true if a "SYN SYN_REPORT" was skipped, false otherwise
+     */
+    boolean skipEvent(ByteBuffer events) {
+        int size = eventStruct.getSize();
+        while (events.remaining() >= size) {
+            int index = events.position();
+            events.position(index + size);
+            if (isSync(events, index)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    private boolean isSync(ByteBuffer events, int index) {
+        return events.getShort(index + eventStruct.getTypeIndex()) == 0
+                && events.getInt(index + eventStruct.getValueIndex()) == 0;
+    }
+
     synchronized void startIteration() {
         currentPosition = 0;
         mark = 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,7 @@ class LinuxFrameBuffer {
     private LinuxSystem.FbVarScreenInfo screenInfo;
     private int width;
     private int height;
+    private int virtualWidth;
     private int bitDepth;
     private int byteDepth;
     private int offsetX, offsetY;
@@ -56,14 +57,35 @@ class LinuxFrameBuffer {
             system.close(fd);
             throw new IOException(system.getErrorMessage());
         }
-        bitDepth = screenInfo.getBitsPerPixel(screenInfo.p);
+        setGeometry(screenInfo.getXRes(screenInfo.p),
+                    screenInfo.getYRes(screenInfo.p),
+                    screenInfo.getXResVirtual(screenInfo.p),
+                    screenInfo.getYResVirtual(screenInfo.p),
+                    screenInfo.getOffsetX(screenInfo.p),
+                    screenInfo.getOffsetY(screenInfo.p),
+                    screenInfo.getBitsPerPixel(screenInfo.p));
+    }
+
+    /**
+     * Creates a framebuffer of the given geometry without a device, whose
+     * pixels are copied with copyRows() to memory mapped by the caller.
+     */
+    LinuxFrameBuffer(int width, int height, int virtualWidth, int virtualHeight,
+                     int offsetX, int offsetY, int bitDepth) {
+        system = LinuxSystem.getLinuxSystem();
+        fd = -1;
+        setGeometry(width, height, virtualWidth, virtualHeight, offsetX, offsetY, bitDepth);
+    }
+
+    private void setGeometry(int width, int height, int virtualWidth, int virtualHeight,
+                             int offsetX, int offsetY, int bitDepth) {
+        this.bitDepth = bitDepth;
         byteDepth = bitDepth >>> 3;
-        width = screenInfo.getXRes(screenInfo.p);
-        height = screenInfo.getYRes(screenInfo.p);
-        int virtualWidth = screenInfo.getXResVirtual(screenInfo.p);
-        int virtualHeight = screenInfo.getYResVirtual(screenInfo.p);
-        offsetX = screenInfo.getOffsetX(screenInfo.p);
-        offsetY = screenInfo.getOffsetY(screenInfo.p);
+        this.width = width;
+        this.height = height;
+        this.virtualWidth = virtualWidth;
+        this.offsetX = offsetX;
+        this.offsetY = offsetY;
         if (virtualHeight >= height * 2) {
             if (offsetY >= height) {
                 offsetY1 = offsetY;
@@ -73,7 +95,7 @@ class LinuxFrameBuffer {
                 offsetY2 = offsetY + height;
             } else {
                 offsetY1 = 0;
-                offsetY2 = width * byteDepth;
+                offsetY2 = height;
             }
             offsetX1 = offsetX2 = offsetX;
             state = 1;
@@ -83,10 +105,10 @@ class LinuxFrameBuffer {
                 offsetX2 = 0;
             } else if (virtualWidth - offsetX >= width * 2) {
                 offsetX1 = offsetX;
-                offsetX2 = offsetX + height;
+                offsetX2 = offsetX + width;
             } else {
                 offsetX1 = 0;
-                offsetX2 = width * byteDepth;
+                offsetX2 = width;
             }
             offsetY1 = offsetY2 = offsetY;
             state = 1;
@@ -110,11 +132,11 @@ class LinuxFrameBuffer {
     int getNextAddress() {
         switch (state) {
             case 1:
-                return (offsetX2 + offsetY2 * width) * byteDepth;
+                return (offsetX2 + offsetY2 * virtualWidth) * byteDepth;
             case 2:
-                return (offsetX1 + offsetY1 * width) * byteDepth;
+                return (offsetX1 + offsetY1 * virtualWidth) * byteDepth;
             default:
-                return (offsetX + offsetY * width) * byteDepth;
+                return (offsetX + offsetY * virtualWidth) * byteDepth;
         }
     }
 
@@ -159,6 +181,31 @@ class LinuxFrameBuffer {
         return null;
     }
 
+    /**
+     * Copies the given spans of each row of a 32-bit buffer of the size of
+     * the screen into the mapped framebuffer at the given byte offset,
+     * converting the pixels to the depth of the framebuffer. Row y is copied
+     * from pixel starts[y] up to, but not including, pixel ends[y].
+     */
+    void copyRows(ByteBuffer src, ByteBuffer mappedFB, int offset,
+                  int[] starts, int[] ends) {
+        int stride = virtualWidth * byteDepth;
+        if (src.capacity() < width * height * 4
+                || offset < 0
+                || offset + (height - 1) * stride + width * byteDepth > mappedFB.capacity()
+                || starts.length < height || ends.length < height) {
+            throw new IllegalArgumentException("Rows do not fit the framebuffer");
+        }
+        C c = C.getC();
+        _copyRows(c.GetDirectBufferAddress(src), width, height,
+                  c.GetDirectBufferAddress(mappedFB) + offset, stride, bitDepth,
+                  starts, ends);
+    }
+
+    private static native void _copyRows(long src, int width, int height,
+                                         long dst, int dstStride, int dstDepth,
+                                         int[] starts, int[] ends);
+
     void releaseMappedBuffer(ByteBuffer b) {
         system.munmap(C.getC().GetDirectBufferAddress(b), b.capacity());
     }
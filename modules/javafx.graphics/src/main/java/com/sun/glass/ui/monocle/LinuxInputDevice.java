@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -62,6 +62,8 @@ class LinuxInputDevice implements Runnable, InputDevice {
     private RunnableProcessor runnableProcessor;
     private EventProcessor processor = new EventProcessor();
     private final LinuxEventBuffer buffer;
+    // set while the rest of an event that did not fit in the buffer is skipped
+    private boolean dropping;
     private Map<String,String> uevent;
     private static LinuxSystem system = LinuxSystem.getLinuxSystem();
 
@@ -166,6 +168,40 @@ class LinuxInputDevice implements Runnable, InputDevice {
         }
     }
 
+    /**
+     * Adds whole events read by a LinuxInputMultiplexer to the buffer and
+     * notifies the listener once for all the complete events among them.
+     * Never blocks, since the multiplexer reads all the devices: when the
+     * buffer is full, the event that does not fit is dropped as a whole, like
+     * the kernel does when its own buffer overflows.
+     *
+     * @param events A ByteBuffer containing the events between its position
+     *               and limit
+     */
+    void putEvents(ByteBuffer events) {
+        synchronized (buffer) {
+            while (events.remaining() >= buffer.getEventSize()) {
+                if (dropping) {
+                    dropping = !buffer.skipEvent(events);
+                    continue;
+                }
+                if (buffer.putAll(events) && !processor.scheduled) {
+                    runnableProcessor.invokeLater(processor);
+                    processor.scheduled = true;
+                }
+                if (events.remaining() >= buffer.getEventSize()) {
+                    buffer.dropPartialEvent();
+                    dropping = true;
+                }
+            }
+        }
+    }
+
+    /** Returns the file descriptor of the device node, or -1 if simulated */
+    long getFileDescriptor() {
+        return fd;
+    }
+
     /**
      * The EventProcessor is used to notify listeners of pending events. It runs
      * on the application thread.
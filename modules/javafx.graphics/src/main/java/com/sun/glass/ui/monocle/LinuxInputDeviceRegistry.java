@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,8 @@ import java.util.Map;
 
 class LinuxInputDeviceRegistry extends InputDeviceRegistry {
 
+    private LinuxInputMultiplexer multiplexer;
+
     LinuxInputDeviceRegistry(boolean headless) {
         if (headless) {
             // Keep the registry but do not bind it to udev.
@@ -61,6 +63,9 @@ class LinuxInputDeviceRegistry extends InputDeviceRegistry {
                         deviceMap.remove(sysPath);
                         if (device != null) {
                             devices.remove(device);
+                            if (multiplexer != null) {
+                                multiplexer.removeDevice(device);
+                            }
                         }
                     }
                 } catch (IOException e) {
@@ -92,6 +97,23 @@ class LinuxInputDeviceRegistry extends InputDeviceRegistry {
             return null;
         } else {
             device.setInputProcessor(processor);
+            if (device.getFileDescriptor() != -1
+                    && MonocleSettings.settings.inputMultiplexer) {
+                if (multiplexer == null) {
+                    multiplexer = LinuxInputMultiplexer.getInstance();
+                }
+                if (multiplexer != null) {
+                    try {
+                        multiplexer.addDevice(device);
+                        devices.add(device);
+                        return device;
+                    } catch (IOException e) {
+                        System.err.println("Cannot multiplex " + name
+                                + ", reading it on its own thread");
+                        e.printStackTrace();
+                    }
+                }
+            }
             Thread thread = new Thread(device);
             thread.setName(name);
             thread.setDaemon(true);
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.HashMap;
+import java.util.Map;
+
+/**
+ * LinuxInputMultiplexer reads all Linux input devices on a single thread. It
+ * waits on the device nodes with epoll and reads all the events pending on
+ * each ready device in one call, then hands them to the device, which
+ * notifies its listener once for all the complete events read.
+ * <p>
+ * Devices are registered with an id that is never reused, so that events
+ * read for a device that was removed in the meantime are dropped.
+ */
+class LinuxInputMultiplexer implements Runnable {
+
+    private static final int BUFFER_SIZE = 64 * 1024;
+    private static LinuxInputMultiplexer instance;
+
+    private final long epfd;
+    private final ByteBuffer buffer;
+    private final int eventSize;
+    private final Map<Integer, LinuxInputDevice> devices = new HashMap<>();
+    private final Map<LinuxInputDevice, Integer> ids = new HashMap<>();
+    private int nextId;
+
+    /** Gets the singleton LinuxInputMultiplexer, or null if epoll is not available */
+    static synchronized LinuxInputMultiplexer getInstance() {
+        if (instance == null) {
+            try {
+                instance = new LinuxInputMultiplexer();
+            } catch (IOException e) {
+                System.err.println("LinuxInputMultiplexer: failed to create epoll instance");
+                e.printStackTrace();
+            }
+        }
+        return instance;
+    }
+
+    private LinuxInputMultiplexer() throws IOException {
+        epfd = _open();
+        eventSize = new LinuxEventBuffer(LinuxArch.getBits()).getEventSize();
+        buffer = ByteBuffer.allocateDirect(BUFFER_SIZE);
+        buffer.order(ByteOrder.nativeOrder());
+        Thread thread = new Thread(this, "Linux input");
+        thread.setDaemon(true);
+        thread.start();
+    }
+
+    private native long _open() throws IOException;
+    private native void _addDevice(long epfd, long fd, int id) throws IOException;
+    private native void _removeDevice(long epfd, long fd);
+    private native int _readEvents(long epfd, ByteBuffer buffer, int eventSize)
+            throws IOException;
+    private native void _close(long epfd);
+
+    /**
+     * Starts reading events from the device node of the given device, which
+     * must already have its input processor set.
+     */
+    synchronized void addDevice(LinuxInputDevice device) throws IOException {
+        int id = nextId++;
+        _addDevice(epfd, device.getFileDescriptor(), id);
+        devices.put(id, device);
+        ids.put(device, id);
+    }
+
+    /** Stops reading events from the given device, if it was added */
+    synchronized void removeDevice(LinuxInputDevice device) {
+        Integer id = ids.remove(device);
+        if (id != null) {
+            devices.remove(id);
+            _removeDevice(epfd, device.getFileDescriptor());
+        }
+    }
+
+    private synchronized LinuxInputDevice getDevice(int id) {
+        return devices.get(id);
+    }
+
+    private synchronized void deviceDropped(int id) {
+        LinuxInputDevice device = devices.remove(id);
+        if (device != null) {
+            ids.remove(device);
+        }
+    }
+
+    @Override
+    public void run() {
+        try {
+            while (true) {
+                buffer.clear();
+                int length = _readEvents(epfd, buffer, eventSize);
+                int position = 0;
+                while (position < length) {
+                    int id = buffer.getInt(position);
+                    int count = buffer.getInt(position + 4);
+                    position += 8;
+                    if (count < 0) {
+                        // the device is disconnected
+                        deviceDropped(id);
+                        continue;
+                    }
+                    LinuxInputDevice device = getDevice(id);
+                    if (device != null) {
+                        buffer.limit(position + count).position(position);
+                        device.putEvents(buffer);
+                        buffer.limit(buffer.capacity());
+                    }
+                    position += count;
+                }
+            }
+        } catch (IOException e) {
+            System.err.println("Exception in Linux input thread:");
+            e.printStackTrace();
+        }
+        _close(epfd);
+    }
+
+}
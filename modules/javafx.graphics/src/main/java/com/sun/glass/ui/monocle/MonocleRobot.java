@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,11 +36,17 @@ import javafx.scene.paint.Color;
 import com.sun.glass.events.MouseEvent;
 import com.sun.glass.ui.Application;
 import com.sun.glass.ui.GlassRobot;
+import com.sun.javafx.tk.Toolkit;
 
 class MonocleRobot extends GlassRobot {
     @Override
     public void create() {
-        // no-op
+        // Offscreen EGL frames are only read back once a robot can capture
+        // them, so the frames shown so far are painted again
+        if (HeadlessEGLAcceleratedScreen.enableCapture()) {
+            MonocleWindowManager.getInstance().repaintAll();
+            Toolkit.getToolkit().requestNextPulse();
+        }
     }
 
     @Override
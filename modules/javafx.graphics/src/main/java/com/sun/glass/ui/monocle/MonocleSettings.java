@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,11 +32,15 @@ class MonocleSettings {
     final boolean traceEvents;
     final boolean traceEventsVerbose;
     final boolean tracePlatformConfig;
+    final boolean inputMultiplexer;
 
     private MonocleSettings() {
         traceEventsVerbose = Boolean.getBoolean("monocle.input.traceEvents.verbose");
         traceEvents = traceEventsVerbose || Boolean.getBoolean("monocle.input.traceEvents");
         tracePlatformConfig = Boolean.getBoolean("monocle.platform.traceConfig");
+        // Read all input devices on one epoll thread instead of one thread each
+        inputMultiplexer = Boolean.parseBoolean(
+                System.getProperty("monocle.input.multiplexer", "true"));
     }
 
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -174,6 +174,24 @@ public class CompositeStrike implements FontStrike {
         return getStrikeSlot(slot).getGlyph(slotglyphCode);
     }
 
+    @Override
+    public void prepareGlyphs(int[] glyphCodes, int count) {
+        /* Forward each run of glyphs from the same slot to its strike */
+        int[] slotGlyphCodes = new int[count];
+        int i = 0;
+        while (i < count) {
+            int slot = glyphCodes[i] >>> 24;
+            int n = 0;
+            while (i < count && (glyphCodes[i] >>> 24) == slot) {
+                slotGlyphCodes[n++] = glyphCodes[i++] & CompositeGlyphMapper.GLYPHMASK;
+            }
+            FontStrike strike = getStrikeSlot(slot);
+            if (strike != null) {
+                strike.prepareGlyphs(slotGlyphCodes, n);
+            }
+        }
+    }
+
      /**
      * Access to individual character advances are frequently needed for layout
      * understand that advance may vary for single glyph if ligatures or kerning
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.font;
+
+import java.io.ByteArrayOutputStream;
+import java.io.DataOutputStream;
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.StandardOpenOption;
+
+/**
+ * On-disk copy of the fonts listed by fontconfig, so that startup does not
+ * have to enumerate and resolve every installed font again. The index is
+ * keyed by a stamp of fontconfig's configuration and cache files and is
+ * rebuilt whenever that changes.
+ * <p>
+ * File layout, big endian: magic, version, stamp (long), number of strings,
+ * then each string as its UTF-8 length followed by the bytes. The strings
+ * are the file, family name and full name of each font, as returned by
+ * {@code FontConfigManager.getFontConfigFonts()}.
+ */
+final class FontConfigIndex {
+
+    private static final int MAGIC = 0x4A465849; // "JFXI"
+    private static final int VERSION = 1;
+    private static final int HEADER_SIZE = 4 + 4 + 8 + 4;
+    private static final String FILE_NAME = "fontconfig.idx";
+
+    private FontConfigIndex() {
+    }
+
+    private static File getIndexFile() {
+        String cacheDir = System.getProperty("javafx.cachedir", "");
+        if (cacheDir.isEmpty()) {
+            cacheDir = System.getProperty("user.home") + "/.openjfx/cache";
+        }
+        return new File(new File(cacheDir, "fonts"), FILE_NAME);
+    }
+
+    /**
+     * Returns the fonts stored for the given stamp, or null if there is no
+     * index or it is out of date.
+     */
+    static String[] read(long stamp) {
+        File file = getIndexFile();
+        if (!file.isFile()) {
+            return null;
+        }
+        try (FileChannel channel = FileChannel.open(file.toPath(), StandardOpenOption.READ)) {
+            long size = channel.size();
+            if (size < HEADER_SIZE || size > Integer.MAX_VALUE) {
+                return null;
+            }
+            MappedByteBuffer buffer = channel.map(FileChannel.MapMode.READ_ONLY, 0, size);
+            if (buffer.getInt() != MAGIC ||
+                buffer.getInt() != VERSION ||
+                buffer.getLong() != stamp) {
+                return null;
+            }
+            int count = buffer.getInt();
+            if (count < 0 || count % 3 != 0 || count > buffer.remaining() / 4) {
+                return null;
+            }
+            String[] fonts = new String[count];
+            byte[] bytes = new byte[256];
+            for (int i = 0; i < count; i++) {
+                int length = buffer.getInt();
+                if (length < 0 || length > buffer.remaining()) {
+                    return null;
+                }
+                if (length > bytes.length) {
+                    bytes = new byte[length];
+                }
+                buffer.get(bytes, 0, length);
+                fonts[i] = new String(bytes, 0, length, StandardCharsets.UTF_8);
+            }
+            return fonts;
+        } catch (IOException | RuntimeException e) {
+            if (FontConfigManager.debugFonts) {
+                System.err.println("Could not read " + file + ": " + e);
+            }
+            return null;
+        }
+    }
+
+    /**
+     * Stores the fonts for the given stamp. The index is written to a
+     * temporary file first, so concurrent readers never see a partial file.
+     */
+    static void write(long stamp, String[] fonts, int count) {
+        File file = getIndexFile();
+        Path tmp = null;
+        try {
+            ByteArrayOutputStream bytes = new ByteArrayOutputStream(HEADER_SIZE + count * 48);
+            DataOutputStream out = new DataOutputStream(bytes);
+            out.writeInt(MAGIC);
+            out.writeInt(VERSION);
+            out.writeLong(stamp);
+            out.writeInt(count);
+            for (int i = 0; i < count; i++) {
+                byte[] utf8 = fonts[i].getBytes(StandardCharsets.UTF_8);
+                out.writeInt(utf8.length);
+                out.write(utf8);
+            }
+            out.flush();
+
+            File dir = file.getParentFile();
+            if (!dir.isDirectory() && !dir.mkdirs()) {
+                return;
+            }
+            tmp = Files.createTempFile(dir.toPath(), FILE_NAME, ".tmp");
+            try (FileChannel channel = FileChannel.open(tmp, StandardOpenOption.WRITE)) {
+                ByteBuffer buffer = ByteBuffer.wrap(bytes.toByteArray());
+                while (buffer.hasRemaining()) {
+                    channel.write(buffer);
+                }
+            }
+            Files.move(tmp, file.toPath(), StandardCopyOption.REPLACE_EXISTING,
+                       StandardCopyOption.ATOMIC_MOVE);
+            tmp = null;
+        } catch (IOException | RuntimeException e) {
+            if (FontConfigManager.debugFonts) {
+                System.err.println("Could not write " + file + ": " + e);
+            }
+        } finally {
+            if (tmp != null) {
+                try {
+                    Files.deleteIfExists(tmp);
+                } catch (IOException e) {
+                }
+            }
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@ public class FontConfigManager {
     static boolean useFontConfig = true;
     static boolean fontConfigFailed = false;
     static boolean useEmbeddedFontSupport = false;
+    static boolean useFontConfigIndex = true;
 
     static {
         String dbg = System.getProperty("prism.debugfonts", "");
@@ -48,6 +49,8 @@ public class FontConfigManager {
         useFontConfig = "true".equals(ufc);
         String emb = System.getProperty("prism.embeddedfonts", "");
         useEmbeddedFontSupport = "true".equals(emb);
+        String idx = System.getProperty("prism.fontConfigIndex", "true");
+        useFontConfigIndex = "true".equals(idx);
     }
 
     /* These next three classes are just data structures.
@@ -216,11 +219,42 @@ public class FontConfigManager {
         }
     }
 
-    private static native boolean populateMapsNative
-        (HashMap<String,String> fontToFileMap,
-         HashMap<String,String> fontToFamilyNameMap,
-         HashMap<String,ArrayList<String>> familyToFontListMap,
-         Locale locale);
+    /* Returns the file, family name and full name of each font, flattened
+     * into one array that may end with null elements.
+     */
+    private static native String[] getFontConfigFonts();
+
+    /* Returns a value that changes with fontconfig's configuration and
+     * caches, or 0 if it can not be determined.
+     */
+    private static native long getFontConfigStamp();
+
+    private static String[] getFontConfigFontsIndexed() {
+        long t0 = 0;
+        if (debugFonts) {
+            t0 = System.nanoTime();
+        }
+        long stamp = useFontConfigIndex ? getFontConfigStamp() : 0;
+        String[] fonts = stamp != 0 ? FontConfigIndex.read(stamp) : null;
+        boolean indexed = fonts != null;
+        if (fonts == null) {
+            fonts = getFontConfigFonts();
+            if (fonts != null && stamp != 0) {
+                int count = 0;
+                while (count < fonts.length && fonts[count] != null) {
+                    count++;
+                }
+                FontConfigIndex.write(stamp, fonts, count);
+            }
+        }
+        if (debugFonts) {
+            long t1 = System.nanoTime();
+            System.err.println("Time spent listing fontconfig fonts=" +
+                               ((t1 - t0) / 1000000) + "ms, " +
+                               (indexed ? "from index" : "from fontconfig"));
+        }
+        return fonts;
+    }
 
     public static void populateMaps
         (HashMap<String,String> fontToFileMap,
@@ -230,9 +264,21 @@ public class FontConfigManager {
 
         boolean pnm = false;
         if (useFontConfig && !fontConfigFailed) {
-            pnm = populateMapsNative(fontToFileMap, fontToFamilyNameMap,
-                                familyToFontListMap, locale);
-
+            String[] fonts = getFontConfigFontsIndexed();
+            if (fonts != null) {
+                for (int i = 0; i + 2 < fonts.length && fonts[i] != null; i += 3) {
+                    String file = fonts[i];
+                    String family = fonts[i + 1];
+                    String fullName = fonts[i + 2];
+                    String familyLC = family.toLowerCase(locale);
+                    String fullNameLC = fullName.toLowerCase(locale);
+                    fontToFileMap.put(fullNameLC, file);
+                    fontToFamilyNameMap.put(fullNameLC, family);
+                    familyToFontListMap.computeIfAbsent(familyLC, _ -> new ArrayList<>(4))
+                                       .add(fullName);
+                }
+                pnm = true;
+            }
         }
 
         if (fontConfigFailed ||
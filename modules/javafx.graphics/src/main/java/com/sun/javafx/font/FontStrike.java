@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -54,4 +54,12 @@ public interface FontStrike {
     public float getCharAdvance(char ch);
     public Shape getOutline(GlyphList gl,
                             BaseTransform transform);
+
+    /**
+     * Hints that the glyphs with the given codes are about to be rendered,
+     * so that a strike able to rasterize several glyphs at once can do so
+     * before {@link Glyph#getPixelData(int)} is called for each of them.
+     */
+    public default void prepareGlyphs(int[] glyphCodes, int count) {
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,17 @@ public class FTFactory extends PrismFontFactory {
             error = OSFreetype.FT_Library_SetLcdFilter(library, OSFreetype.FT_LCD_FILTER_DEFAULT);
             LCD_SUPPORT = error == 0;
             OSFreetype.FT_Done_FreeType(library);
+
+            /* Memory budget, in bytes, of the native glyph outline cache */
+            String s = System.getProperty("prism.glyphOutlineCacheSize");
+            if (s != null) {
+                try {
+                    OSFreetype.setGlyphOutlineCacheLimit(Long.parseLong(s));
+                } catch (NumberFormatException nfe) {
+                    System.err.println("Cannot parse glyph outline cache size '"
+                            + s + "'");
+                }
+            }
         }
         if (PrismFontFactory.debugFonts) {
             if (factory != null) {
@@ -64,6 +75,9 @@ public class FTFactory extends PrismFontFactory {
                 System.err.println("Freetype2 Loaded (version " + version + ")");
                 String lcdSupport = LCD_SUPPORT ? "Enabled" : "Disabled";
                 System.err.println("LCD support " + lcdSupport);
+                long[] stats = new long[5];
+                OSFreetype.getGlyphOutlineCacheStats(stats);
+                System.err.println("Glyph outline cache limit " + stats[1] + " bytes");
             } else {
                 System.err.println("Freetype2 Failed (error " + error + ")");
             }
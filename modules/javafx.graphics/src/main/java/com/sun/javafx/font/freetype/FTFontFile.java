@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,8 @@ import com.sun.javafx.font.PrismFontFile;
 import com.sun.javafx.font.PrismFontStrike;
 import com.sun.javafx.geom.Path2D;
 import com.sun.javafx.geom.transform.BaseTransform;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 
 class FTFontFile extends PrismFontFile {
     /*
@@ -109,26 +111,22 @@ class FTFontFile extends PrismFontFile {
         return bbox;
     }
 
+    /* The returned outline is shared with other strikes, callers only read it */
     synchronized Path2D createGlyphOutline(int gc, float size) {
         int size26dot6 = (int)(size * 64);
-        OSFreetype.FT_Set_Char_Size(face, 0, size26dot6, 72, 72);
         int flags = OSFreetype.FT_LOAD_NO_HINTING | OSFreetype.FT_LOAD_NO_BITMAP | OSFreetype.FT_LOAD_IGNORE_TRANSFORM;
-        OSFreetype.FT_Load_Glyph(face, gc, flags);
-        return OSFreetype.FT_Outline_Decompose(face);
+        return OSFreetype.getGlyphOutline(face, gc, size26dot6, flags);
     }
 
-    synchronized void initGlyph(FTGlyph glyph, FTFontStrike strike) {
-        float size = strike.getSize();
-        if (size == 0) {
-            glyph.buffer = new byte[0];
-            glyph.bitmap = new FT_Bitmap();
-            return;
-        }
-        int size26dot6 = (int)(size * 64);
-        OSFreetype.FT_Set_Char_Size(face, 0, size26dot6, 72, 72);
+    private static boolean isLCD(FTFontStrike strike) {
+        return strike.getAAMode() == FontResource.AA_LCD &&
+               FTFactory.LCD_SUPPORT;
+    }
 
-        boolean lcd = strike.getAAMode() == FontResource.AA_LCD &&
-                      FTFactory.LCD_SUPPORT;
+    /* Sets up the face for rendering the strike, returns the load flags */
+    private int setupStrike(FTFontStrike strike, boolean lcd) {
+        int size26dot6 = (int)(strike.getSize() * 64);
+        OSFreetype.FT_Set_Char_Size(face, 0, size26dot6, 72, 72);
 
         int flags = OSFreetype.FT_LOAD_RENDER | OSFreetype.FT_LOAD_NO_HINTING | OSFreetype.FT_LOAD_NO_BITMAP;
         FT_Matrix matrix = strike.matrix;
@@ -142,6 +140,81 @@ class FTFontFile extends PrismFontFile {
         } else {
             flags |= OSFreetype.FT_LOAD_TARGET_NORMAL;
         }
+        return flags;
+    }
+
+    /*
+     * Scratch space for initGlyphs(), shared by all font files and guarded
+     * by the FTFontFile class lock. Glyphs that do not fit are initialized
+     * one by one by initGlyph().
+     */
+    private static final int GLYPH_BUFFER_SIZE = 64 * 1024;
+    private static ByteBuffer glyphBuffer;
+    private static int[] glyphMetrics;
+
+    /*
+     * Renders several glyphs of the strike with a single native call. Glyphs
+     * that cannot be rendered this way are left uninitialized.
+     */
+    synchronized void initGlyphs(FTGlyph[] glyphs, int count, FTFontStrike strike) {
+        if (strike.getSize() == 0) {
+            return;
+        }
+        boolean lcd = isLCD(strike);
+        int flags = setupStrike(strike, lcd);
+        int[] glyphCodes = new int[count];
+        for (int i = 0; i < count; i++) {
+            glyphCodes[i] = glyphs[i].getGlyphCode();
+        }
+
+        synchronized (FTFontFile.class) {
+            if (glyphBuffer == null) {
+                glyphBuffer = ByteBuffer.allocateDirect(GLYPH_BUFFER_SIZE)
+                                        .order(ByteOrder.nativeOrder());
+            }
+            int start = 0;
+            while (start < count) {
+                int n = count - start;
+                if (glyphMetrics == null || glyphMetrics.length < n * OSFreetype.GLYPH_METRICS_SIZE) {
+                    glyphMetrics = new int[n * OSFreetype.GLYPH_METRICS_SIZE];
+                }
+                int[] m = glyphMetrics;
+                n = OSFreetype.renderGlyphs(face, glyphCodes, start, n, flags, glyphBuffer, m);
+                if (n == 0) break;
+                for (int i = 0; i < n; i++) {
+                    int k = i * OSFreetype.GLYPH_METRICS_SIZE;
+                    int offset = m[k];
+                    if (offset < 0) continue;
+                    FTGlyph glyph = glyphs[start + i];
+                    FT_Bitmap bitmap = new FT_Bitmap();
+                    bitmap.width = m[k + 1];
+                    bitmap.rows = m[k + 2];
+                    bitmap.pitch = bitmap.width;
+                    byte[] buffer = new byte[bitmap.width * bitmap.rows];
+                    glyphBuffer.get(offset, buffer);
+                    glyph.buffer = buffer;
+                    glyph.bitmap = bitmap;
+                    glyph.bitmap_left = m[k + 3];
+                    glyph.bitmap_top = m[k + 4];
+                    glyph.advanceX = m[k + 5] / 64f;    /* Fixed 26.6*/
+                    glyph.advanceY = m[k + 6] / 64f;
+                    glyph.userAdvance = m[k + 7] / 65536.0f; /* Fixed 16.16 */
+                    glyph.lcd = lcd;
+                }
+                start += n;
+            }
+        }
+    }
+
+    synchronized void initGlyph(FTGlyph glyph, FTFontStrike strike) {
+        float size = strike.getSize();
+        if (size == 0) {
+            glyph.buffer = new byte[0];
+            glyph.bitmap = new FT_Bitmap();
+            return;
+        }
+        boolean lcd = isLCD(strike);
+        int flags = setupStrike(strike, lcd);
 
         int glyphCode = glyph.getGlyphCode();
         int error = OSFreetype.FT_Load_Glyph(face, glyphCode, flags);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,6 +78,23 @@ class FTFontStrike extends PrismFontStrike<FTFontFile> {
         return fontResource.createGlyphOutline(glyphCode, getSize());
     }
 
+    @Override
+    public void prepareGlyphs(int[] glyphCodes, int count) {
+        if (drawShapes) return;
+        FTGlyph[] glyphs = new FTGlyph[count];
+        int n = 0;
+        for (int i = 0; i < count; i++) {
+            FTGlyph glyph = (FTGlyph)getGlyph(glyphCodes[i]);
+            if (glyph.bitmap == null) {
+                glyphs[n++] = glyph;
+            }
+        }
+        /* A single glyph is no cheaper to render as a batch */
+        if (n > 1) {
+            getFontResource().initGlyphs(glyphs, n, this);
+        }
+    }
+
     void initGlyph(FTGlyph glyph) {
         FTFontFile fontResource = getFontResource();
         fontResource.initGlyph(glyph, this);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.javafx.font.freetype;
 
 import com.sun.glass.utils.NativeLibLoader;
 import com.sun.javafx.geom.Path2D;
+import java.nio.ByteBuffer;
 
 class OSFreetype {
 
@@ -105,6 +106,33 @@ class OSFreetype {
     static final native void FT_Set_Transform(long face, FT_Matrix matrix, long delta_x, long delta_y);
     static final native FT_GlyphSlotRec getGlyphSlot(long face);
     static final native byte[] getBitmapData(long face);
+
+    /* Number of ints written to the metrics array of renderGlyphs per glyph */
+    static final int GLYPH_METRICS_SIZE = 8;
+
+    /**
+     * Renders glyphCodes[start, start + count) and packs the bitmaps, without
+     * row padding, into the direct buffer. See freetype.c for the layout of
+     * the metrics array. Returns the number of glyphs processed, which is
+     * less than count when the buffer filled up.
+     */
+    static final native int renderGlyphs(long face, int[] glyphCodes, int start, int count,
+                                         int load_flags, ByteBuffer buffer, int[] metrics);
+
+    /**
+     * Returns the unhinted outline of the glyph at the given size, using
+     * the native outline cache shared by all the strikes of the face.
+     * The face size is changed when the outline is not cached. The same
+     * Path2D is returned while the outline stays cached, so it must not be
+     * modified. Returns null if the glyph cannot be loaded.
+     */
+    static final native Path2D getGlyphOutline(long face, int glyphCode, int size26dot6, int load_flags);
+
+    /* Bounds the memory used by the outline cache, 0 disables it */
+    static final native void setGlyphOutlineCacheLimit(long bytes);
+
+    /* Fills stats with bytes used, limit, entries, hits and misses */
+    static final native void getGlyphOutlineCacheStats(long[] stats);
     static final native boolean isPangoEnabled();
     static final native boolean isHarfbuzzEnabled();
 }
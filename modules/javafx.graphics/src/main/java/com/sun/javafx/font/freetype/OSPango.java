@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -72,7 +72,8 @@ class OSPango {
     static final native void pango_attr_list_unref(long list);
     static final native void pango_attr_list_insert(long list, long attr);
     static final native long pango_itemize(long context, long text, int start_index, int length, long attrs, long cached_iter);
-    static final native PangoGlyphString pango_shape(long text, long pangoItem);
+    /* Packed glyph data, see PangoGlyphString */
+    static final native int[] pango_shape(long text, long pangoItem);
     static final native void pango_item_free(long item);
 
     /* Miscellaneous (glib, fontconfig) */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -152,7 +152,10 @@ class PangoGlyphLayout extends GlyphLayout {
             for (int i = 0; i < runsCount; i++) {
                 long pangoItem = OSPango.g_list_nth_data(runs, i);
                 if (pangoItem != 0) {
-                    pangoGlyphs[i] = OSPango.pango_shape(str, pangoItem);
+                    int[] data = OSPango.pango_shape(str, pangoItem);
+                    if (data != null) {
+                        pangoGlyphs[i] = new PangoGlyphString(data);
+                    }
                     OSPango.pango_item_free(pangoItem);
                 }
             }
@@ -177,7 +180,7 @@ class PangoGlyphLayout extends GlyphLayout {
                     for (int i = 0; i < g.num_glyphs; i++) {
                         int gii = gi + i;
                         if (slot != -1) {
-                            int gg = g.glyphs[i];
+                            int gg = g.glyph(i);
 
                             /* Ignoring any glyphs outside the GLYPHMASK range.
                              * Note that Pango uses PANGO_GLYPH_EMPTY (0x0FFFFFFF), PANGO_GLYPH_INVALID_INPUT (0xFFFFFFFF),
@@ -188,10 +191,10 @@ class PangoGlyphLayout extends GlyphLayout {
                             }
                         }
                         if (size != 0) {
-                            width += g.widths[i];
+                            width += g.width(i);
                             pos[2 + (gii << 1)] = ((float)width) / OSPango.PANGO_SCALE;
                         }
-                        indices[gii] = g.log_clusters[i] + ci;
+                        indices[gii] = g.log_cluster(i) + ci;
                     }
                     if (!rtl) ci += g.num_chars;
                     gi += g.num_glyphs;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,16 +26,39 @@
 package com.sun.javafx.font.freetype;
 
 class PangoGlyphString {
-    /* Fields from PangoItem */
-    int offset;
-    int length;
-    int num_chars;
+    /* Layout of the array returned by OSPango.pango_shape() */
+    private static final int NUM_GLYPHS = 0;
+    private static final int NUM_CHARS = 1;
+    private static final int FONT_LO = 2;
+    private static final int FONT_HI = 3;
+    private static final int HEADER_SIZE = 4;
+
+    /* pangoItem->num_chars */
+    final int num_chars;
     /* pangoItem->analysis->font*/
-    long font;
-    int num_glyphs;
+    final long font;
+    final int num_glyphs;
+    /* Glyphs, widths and char based clusters, one after the other */
+    private final int[] data;
+
+    PangoGlyphString(int[] data) {
+        this.data = data;
+        num_glyphs = data[NUM_GLYPHS];
+        num_chars = data[NUM_CHARS];
+        font = (data[FONT_LO] & 0xFFFFFFFFL) | ((long)data[FONT_HI] << 32);
+    }
+
     /* PangoGlyphInfo->glyph */
-    int[] glyphs;
+    int glyph(int i) {
+        return data[HEADER_SIZE + i];
+    }
+
     /* PangoGlyphInfo->PangoGlyphGeometry->width */
-    int[] widths;
-    int[] log_clusters;
+    int width(int i) {
+        return data[HEADER_SIZE + num_glyphs + i];
+    }
+
+    int log_cluster(int i) {
+        return data[HEADER_SIZE + 2 * num_glyphs + i];
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -74,6 +74,7 @@ import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.Future;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.function.Supplier;
 import com.sun.glass.ui.Application;
 import com.sun.glass.ui.Clipboard;
@@ -119,6 +120,7 @@ import com.sun.prism.BasicStroke;
 import com.sun.prism.Graphics;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.prism.PixelFormat;
+import com.sun.prism.PixelReadback;
 import com.sun.prism.RTTexture;
 import com.sun.prism.ResourceFactory;
 import com.sun.prism.ResourceFactoryListener;
@@ -208,6 +210,8 @@ public final class QuantumToolkit extends Toolkit {
     private PulseTask               animationRunning = new PulseTask(false);
     private PulseTask               nextPulseRequested = new PulseTask(false);
     private AtomicBoolean           pulseRunning = new AtomicBoolean(false);
+    // timer ticks that found the previous pulse still pending
+    private AtomicInteger           droppedPulses = new AtomicInteger();
     private int                     inPulse = 0;
     private CountDownLatch          launchLatch = new CountDownLatch(1);
 
@@ -521,8 +525,13 @@ public final class QuantumToolkit extends Toolkit {
             }
         } else if (!animationRunning.get() && !nextPulseRequested.get() && !pulseRunning.get()) {
             pauseTimer();
-        } else if (debug) {
-            System.err.println("QT.postPulse#(" + System.nanoTime() + "): DROP : " + pulseString());
+        } else {
+            if (toolkitRunning.get() && (animationRunning.get() || nextPulseRequested.get())) {
+                droppedPulses.incrementAndGet();
+            }
+            if (debug) {
+                System.err.println("QT.postPulse#(" + System.nanoTime() + "): DROP : " + pulseString());
+            }
         }
     }
 
@@ -566,6 +575,11 @@ public final class QuantumToolkit extends Toolkit {
     }
 
     void pulseFromQueue() {
+        int dropped = droppedPulses.getAndSet(0);
+        if (verbose && dropped > 0) {
+            System.err.println("QuantumToolkit: dropped " + dropped
+                               + " pulse(s) while the previous one was pending");
+        }
         try {
             pulse();
         } finally {
@@ -1563,6 +1577,22 @@ public final class QuantumToolkit extends Toolkit {
                 Graphics g = rt.createGraphics();
                 draw(g, x + xOffset, y + yOffset, w, h);
                 int[] pixels = rt.getPixels();
+                if (pixels == null) {
+                    // Start reading this tile back and copy the previous one
+                    // while the GPU is busy with it
+                    PixelReadback readback = rt.readPixelsAsync(rt.getContentX(), rt.getContentY(), w, h);
+                    if (readback != null) {
+                        finishPendingTile(buffer, targetImg);
+                        pendingReadback = readback;
+                        pendingXOffset = xOffset;
+                        pendingYOffset = yOffset;
+                        pendingWidth = w;
+                        pendingHeight = h;
+                        rt.unlock();
+                        return;
+                    }
+                }
+                finishPendingTile(buffer, targetImg);
                 if (pixels != null) {
                     buffer.put(pixels);
                 } else {
@@ -1574,6 +1604,23 @@ public final class QuantumToolkit extends Toolkit {
                 rt.unlock();
             }
 
+            // The tile whose asynchronous read back was started last
+            private PixelReadback pendingReadback;
+            private int pendingXOffset, pendingYOffset, pendingWidth, pendingHeight;
+
+            private void finishPendingTile(IntBuffer buffer, QuantumImage targetImg) {
+                if (pendingReadback == null) {
+                    return;
+                }
+                PixelReadback readback = pendingReadback;
+                pendingReadback = null;
+                buffer.clear();
+                if (readback.await(buffer)) {
+                    targetImg.image.setPixels(pendingXOffset, pendingYOffset, pendingWidth, pendingHeight,
+                            javafx.scene.image.PixelFormat.getIntArgbPreInstance(), buffer, pendingWidth);
+                }
+            }
+
             private void renderWholeImage(int x, int y, int w, int h, ResourceFactory rf, QuantumImage pImage) {
                 RTTexture rt = pImage.getRT(w, h, rf);
                 if (rt == null) {
@@ -1586,7 +1633,12 @@ public final class QuantumToolkit extends Toolkit {
                     pImage.setImage(com.sun.prism.Image.fromIntArgbPreData(pixels, w, h));
                 } else {
                     IntBuffer ib = IntBuffer.allocate(w * h);
-                    if (rt.readPixels(ib, rt.getContentX(), rt.getContentY(), w, h)) {
+                    // The read back is queued behind the rendering, so the
+                    // pixels are only copied out once the GPU is done
+                    PixelReadback readback = rt.readPixelsAsync(rt.getContentX(), rt.getContentY(), w, h);
+                    boolean read = readback != null ? readback.await(ib) :
+                            rt.readPixels(ib, rt.getContentX(), rt.getContentY(), w, h);
+                    if (read) {
                         pImage.setImage(com.sun.prism.Image.fromIntArgbPreData(ib, w, h));
                     } else {
                         pImage.dispose();
@@ -1696,6 +1748,7 @@ public final class QuantumToolkit extends Toolkit {
                             renderTile(x, rTileXOffset, y, bTileYOffset, rTileWidth, bTileHeight,
                                     buffer, rf, tileRttCache, pImage);
                         }
+                        finishPendingTile(buffer, pImage);
                     }
                     else {
                         // The requested size for the snapshot fits max texture size,
@@ -1707,6 +1760,10 @@ public final class QuantumToolkit extends Toolkit {
                     errored = true;
                     t.printStackTrace(System.err);
                 } finally {
+                    if (pendingReadback != null) {
+                        pendingReadback.dispose();
+                        pendingReadback = null;
+                    }
                     if (tileRttCache != null) {
                         tileRttCache.dispose();
                     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@ import com.sun.prism.impl.Disposer;
 public abstract class AbstractSurface implements Surface {
 
     private long nativePtr = 0L;
+    private AbstractSurfaceDisposerRecord disposerRecord;
     private int width;
     private int height;
 
@@ -49,7 +50,19 @@ public abstract class AbstractSurface implements Surface {
     }
 
     protected void addDisposerRecord() {
-        Disposer.addRecord(this, new AbstractSurfaceDisposerRecord(nativePtr));
+        disposerRecord = new AbstractSurfaceDisposerRecord(nativePtr);
+        Disposer.addRecord(this, disposerRecord);
+    }
+
+    /**
+     * Releases the native resources of the surface now instead of once it
+     * is collected. The surface must not be rendered to afterwards.
+     */
+    public void dispose() {
+        if (disposerRecord != null) {
+            disposerRecord.dispose();
+        }
+        nativePtr = 0L;
     }
 
     @Override
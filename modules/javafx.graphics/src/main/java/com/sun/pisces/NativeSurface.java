@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.pisces;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.IntBuffer;
+
+/**
+ * A surface whose pixels live in native memory, so that the renderer never
+ * has to pin a Java array. The pixels are either allocated by the surface,
+ * 64-byte aligned and optionally with each row padded to a multiple of 64
+ * bytes, or provided by the caller as a direct buffer, which lets the
+ * surface share memory with, for example, a window system buffer.
+ * <p>
+ * The pixels are accessible through {@link #getDataIntBuffer()}. Memory
+ * allocated by the surface is released by {@link #dispose()} or once the
+ * surface is collected, so the buffer must not be used after either.
+ */
+public final class NativeSurface extends AbstractSurface {
+
+    // rows of aligned surfaces start on 64-byte boundaries
+    private static final int ROW_ALIGNMENT = 16;
+
+    private final IntBuffer dataBuffer;
+    private final int scanlineStride;
+
+    // keeps memory provided by the caller alive
+    private final ByteBuffer sharedBuffer;
+
+    /**
+     * Creates a surface backed by newly allocated, cleared native memory.
+     *
+     * @param dataType the pixel type, which must be TYPE_INT_ARGB_PRE
+     * @param width the width in pixels
+     * @param height the height in pixels
+     * @param alignRows whether to pad each row to a multiple of 64 bytes,
+     * otherwise rows are tightly packed
+     */
+    public NativeSurface(int dataType, int width, int height, boolean alignRows) {
+        super(width, height);
+        this.scanlineStride = alignRows
+                ? (width + ROW_ALIGNMENT - 1) & ~(ROW_ALIGNMENT - 1)
+                : width;
+        if (this.scanlineStride < 0 || (long) scanlineStride * height > Integer.MAX_VALUE) {
+            throw new IllegalArgumentException("SCAN-LENGTH * HEIGHT is too large");
+        }
+        this.sharedBuffer = null;
+
+        ByteBuffer data = initialize(dataType, width, height, scanlineStride);
+        addDisposerRecord();
+        this.dataBuffer = data.order(ByteOrder.nativeOrder()).asIntBuffer();
+    }
+
+    /**
+     * Creates a surface that renders into the given direct buffer.
+     *
+     * @param buffer a direct buffer holding at least scanlineStride * height
+     * 32-bit pixels in native byte order, starting at its current position
+     * @param dataType the pixel type, which must be TYPE_INT_ARGB_PRE
+     * @param width the width in pixels
+     * @param height the height in pixels
+     * @param scanlineStride the distance between rows in pixels
+     */
+    public NativeSurface(ByteBuffer buffer, int dataType, int width, int height, int scanlineStride) {
+        super(width, height);
+        if (!buffer.isDirect()) {
+            throw new IllegalArgumentException("buffer must be direct");
+        }
+        if (scanlineStride < width) {
+            throw new IllegalArgumentException("SCAN-LENGTH must be >= WIDTH");
+        }
+        if ((long) scanlineStride * height * 4 > buffer.remaining()) {
+            throw new IllegalArgumentException("SCAN-LENGTH * HEIGHT exceeds length of buffer");
+        }
+        this.scanlineStride = scanlineStride;
+        this.sharedBuffer = buffer.slice().order(ByteOrder.nativeOrder());
+
+        initializeShared(sharedBuffer, dataType, width, height, scanlineStride);
+        addDisposerRecord();
+        this.dataBuffer = sharedBuffer.asIntBuffer();
+    }
+
+    /**
+     * Returns the pixels of the surface, {@link #getScanlineStride()} pixels
+     * per row.
+     */
+    public IntBuffer getDataIntBuffer() {
+        return this.dataBuffer;
+    }
+
+    public int getScanlineStride() {
+        return this.scanlineStride;
+    }
+
+    private native ByteBuffer initialize(int dataType, int width, int height, int scanlineStride);
+
+    private native void initializeShared(ByteBuffer buffer, int dataType, int width, int height,
+                                         int scanlineStride);
+}
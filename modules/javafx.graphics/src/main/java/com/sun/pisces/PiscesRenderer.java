@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -77,6 +77,8 @@ public final class PiscesRenderer {
     public static final int ARC_CHORD = 1;
     public static final int ARC_PIE = 2;
 
+    private static int bandThreads = 1;
+
     private long nativePtr = 0L;
     private AbstractSurface surface;
 
@@ -439,6 +441,45 @@ public final class PiscesRenderer {
         }
     }
 
+    /**
+     * Enables or disables the vectorized compositing loops. They are
+     * enabled by default and produce the same pixels as the scalar loops.
+     *
+     * @param enabled whether the vectorized loops may be used
+     * @return true if the vectorized loops are in use, which requires
+     * a CPU with SSE4.1, AVX2 or NEON
+     */
+    public static boolean setSIMDEnabled(boolean enabled) {
+        return setSIMDEnabledImpl(enabled);
+    }
+
+    private static native boolean setSIMDEnabledImpl(boolean enabled);
+
+    /**
+     * Sets the number of threads that render large rectangle, image and
+     * alpha mask fills in horizontal bands. One thread, the default,
+     * renders everything on the calling thread.
+     *
+     * @param threads the number of threads, including the calling one
+     * @return the number of threads in use, which is 1 on platforms
+     * without band rendering
+     */
+    public static int setBandThreads(int threads) {
+        bandThreads = setBandThreadsImpl(threads);
+        return bandThreads;
+    }
+
+    /**
+     * Returns the number of threads that render fills in horizontal bands.
+     *
+     * @return the number of threads, including the calling one
+     */
+    public static int getBandThreads() {
+        return bandThreads;
+    }
+
+    private static native int setBandThreadsImpl(int threads);
+
     private static native void disposeNative(long nativeHandle);
 
     private static class PiscesRendererDisposerRecord implements Disposer.Record {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,5 +31,14 @@ public interface RTTexture extends Texture, RenderTarget {
     public int[] getPixels();
     public boolean readPixels(Buffer pixels);
     public boolean readPixels(Buffer pixels, int x, int y, int width, int height);
+
+    /**
+     * Starts reading back a region without waiting for the rendering into
+     * the texture to complete. Returns null when the pipeline can only read
+     * back synchronously, in which case readPixels has to be used instead.
+     */
+    public default PixelReadback readPixelsAsync(int x, int y, int width, int height) {
+        return null;
+    }
     public boolean isVolatile();
 }
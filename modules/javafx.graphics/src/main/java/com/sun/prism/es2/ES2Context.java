@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,11 +37,13 @@ import com.sun.javafx.sg.prism.NGDefaultCamera;
 import com.sun.prism.CompositeMode;
 import com.sun.prism.Graphics;
 import com.sun.prism.Material;
+import com.sun.prism.PhongMaterial;
 import com.sun.prism.RTTexture;
 import com.sun.prism.RenderTarget;
 import com.sun.prism.Texture;
 import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.impl.ps.BaseShaderContext;
+import com.sun.prism.paint.Color;
 import com.sun.prism.ps.Shader;
 import com.sun.prism.ps.ShaderFactory;
 
@@ -68,6 +70,20 @@ class ES2Context extends BaseShaderContext {
     private GLDrawable currentDrawable = null;
     private int indexBuffer = 0;
     private int shaderProgram;
+    private final ES2ProgramCache programCache;
+
+    // Consecutive mesh views that only differ in their world transform and
+    // diffuse color are queued here and drawn as instances of the first one,
+    // see renderMeshView() and flushMeshInstances()
+    private static final int MAX_MESH_INSTANCES = 1024;
+    private final boolean meshInstancing;
+    private final float[] instanceData;
+    private int instanceCount;
+    private ES2MeshView instancedView;
+    private ES2Shader instancedShader;
+    private Color instancedSpecularColor;
+    private final Texture[] instancedTextures = new Texture[PhongMaterial.MAX_MAP_TYPE];
+    private float instancedScaleX, instancedScaleY;
 
     public static final int NUM_QUADS = PrismSettings.superShader ? 4096 : 256;
 
@@ -88,9 +104,18 @@ class ES2Context extends BaseShaderContext {
         makeCurrent(dummyGLDrawable);
 
         glContext.enableVertexAttributes();
+        glContext.setVertexRingSize(PrismSettings.vertexRingSize);
+        if (PrismSettings.pboUpload) {
+            glContext.initUploadBuffers();
+        }
+        programCache = ES2ProgramCache.create(glContext, glF.getDriverInfo());
         quadIndices = genQuadsIndexBuffer(NUM_QUADS);
         setIndexBuffer(quadIndices);
         state = new State();
+        meshInstancing = PrismSettings.meshInstancing &&
+                glContext.getMeshInstancing() != GLContext.INSTANCING_NONE;
+        instanceData = meshInstancing ?
+                new float[MAX_MESH_INSTANCES * GLContext.MESH_INSTANCE_SIZE] : null;
     }
 
     static short [] getQuadIndices16bit(int numQuads) {
@@ -134,6 +159,10 @@ class ES2Context extends BaseShaderContext {
         return glContext;
     }
 
+    ES2ProgramCache getProgramCache() {
+        return programCache;
+    }
+
     GLPixelFormat getPixelFormat() {
         return pixelFormat;
     }
@@ -165,6 +194,8 @@ class ES2Context extends BaseShaderContext {
      * force a call to [NSOpenGLContext update].
      */
     void forceRenderTarget(ES2Graphics g) {
+        // Queued quads and mesh instances belong to the previous viewport
+        flushVertexBuffer();
         updateRenderTarget(g.getRenderTarget(), g.getCameraNoClone(),
                 g.isDepthTest() && g.isDepthBuffer());
     }
@@ -367,6 +398,13 @@ class ES2Context extends BaseShaderContext {
         }
     }
 
+    @Override
+    public void dispose() {
+        makeCurrent(dummyGLDrawable);
+        glContext.disposeBuffers();
+        super.dispose();
+    }
+
     @Override
     public void setDeviceParametersFor2D() {
         // invalidate cache data
@@ -392,19 +430,29 @@ class ES2Context extends BaseShaderContext {
 
     // TODO: 3D - Should this be called dispose?
     void releaseES2Mesh(long nativeHandle) {
+        flushMeshInstances();
         glContext.releaseES2Mesh(nativeHandle);
     }
 
     boolean buildNativeGeometry(long nativeHandle, float[] vertexBuffer,
-            int vertexBufferLength, short[] indexBuffer, int indexBufferLength) {
+            int vertexBufferLength, short[] indexBuffer, int indexBufferLength,
+            boolean dynamic) {
+        flushMeshInstances();
         return glContext.buildNativeGeometry(nativeHandle, vertexBuffer,
-                vertexBufferLength, indexBuffer, indexBufferLength);
+                vertexBufferLength, indexBuffer, indexBufferLength, dynamic);
     }
 
     boolean buildNativeGeometry(long nativeHandle, float[] vertexBuffer,
-            int vertexBufferLength, int[] indexBuffer, int indexBufferLength) {
+            int vertexBufferLength, int[] indexBuffer, int indexBufferLength,
+            boolean dynamic) {
+        flushMeshInstances();
         return glContext.buildNativeGeometry(nativeHandle, vertexBuffer,
-                vertexBufferLength, indexBuffer, indexBufferLength);
+                vertexBufferLength, indexBuffer, indexBufferLength, dynamic);
+    }
+
+    boolean updateNativeGeometry(long nativeHandle, float[] vertexBuffer, int from, int to) {
+        flushMeshInstances();
+        return glContext.updateNativeGeometry(nativeHandle, vertexBuffer, from, to);
     }
 
     long createES2PhongMaterial() {
@@ -413,6 +461,7 @@ class ES2Context extends BaseShaderContext {
 
     // TODO: 3D - Should this be called dispose?
     void releaseES2PhongMaterial(long nativeHandle) {
+        flushMeshInstances();
         glContext.releaseES2PhongMaterial(nativeHandle);
     }
 
@@ -430,10 +479,12 @@ class ES2Context extends BaseShaderContext {
 
     // TODO: 3D - Should this be called dispose?
     void releaseES2MeshView(long nativeHandle) {
+        flushMeshInstances();
         glContext.releaseES2MeshView(nativeHandle);
     }
 
     void setCullingMode(long nativeHandle, int cullingMode) {
+        flushMeshInstances(nativeHandle);
         // NOTE: Native code has set clockwise order as front-facing
         glContext.setCullingMode(nativeHandle, cullingMode);
     }
@@ -441,21 +492,25 @@ class ES2Context extends BaseShaderContext {
     void setMaterial(long nativeHandle, Material material) {
         ES2PhongMaterial es2Material = (ES2PhongMaterial)material;
 
+        flushMeshInstances(nativeHandle);
         glContext.setMaterial(nativeHandle,
                 (es2Material).getNativeHandle());
     }
 
     void setWireframe(long nativeHandle, boolean wireframe) {
+       flushMeshInstances(nativeHandle);
        glContext.setWireframe(nativeHandle, wireframe);
     }
 
     void setAmbientLight(long nativeHandle, float r, float g, float b) {
+        flushMeshInstances(nativeHandle);
         glContext.setAmbientLight(nativeHandle, r, g, b);
     }
 
     void setLight(long nativeHandle, int index, float x, float y, float z, float r, float g, float b, float w,
             float ca, float la, float qa, float isAttenuated, float maxRange, float dirX, float dirY, float dirZ,
             float innerAngle, float outerAngle, float falloff) {
+        flushMeshInstances(nativeHandle);
         glContext.setLight(nativeHandle, index, x, y, z, r, g, b, w, ca, la, qa, isAttenuated,
                 maxRange, dirX, dirY, dirZ, innerAngle, outerAngle, falloff);
     }
@@ -475,22 +530,8 @@ class ES2Context extends BaseShaderContext {
 
     void renderMeshView(long nativeHandle, Graphics g, ES2MeshView meshView) {
 
-        ES2Shader shader = getPhongShader(meshView);
-        setShaderProgram(shader.getProgramObject());
-
-        // Support retina display by scaling the projViewTx and pass it to the shader.
         float pixelScaleFactorX = g.getPixelScaleFactorX();
         float pixelScaleFactorY = g.getPixelScaleFactorY();
-        if (pixelScaleFactorX != 1.0 || pixelScaleFactorY != 1.0) {
-            scratchTx = scratchTx.set(projViewTx);
-            scratchTx.scale(pixelScaleFactorX, pixelScaleFactorY, 1.0);
-            updateRawMatrix(scratchTx);
-        } else {
-            updateRawMatrix(projViewTx);
-        }
-        shader.setMatrix("viewProjectionMatrix", rawMatrix);
-        shader.setConstant("camPos", (float) cameraPos.x,
-                (float) cameraPos.y, (float)cameraPos.z);
 
         // Undo the SwapChain scaling done in createGraphics() because 3D needs
         // this information in the shader (via projViewTx)
@@ -503,6 +544,16 @@ class ES2Context extends BaseShaderContext {
         } else {
             updateWorldTransform(xform);
         }
+
+        if (meshInstancing) {
+            queueMeshInstance(meshView, pixelScaleFactorX, pixelScaleFactorY);
+            return;
+        }
+
+        ES2Shader shader = getPhongShader(meshView);
+        setShaderProgram(shader.getProgramObject());
+        setViewProjection(shader, pixelScaleFactorX, pixelScaleFactorY);
+
         updateRawMatrix(worldTx);
 
         shader.setMatrix("worldMatrix", rawMatrix);
@@ -513,6 +564,128 @@ class ES2Context extends BaseShaderContext {
         glContext.renderMeshView(nativeHandle);
     }
 
+    private void setViewProjection(ES2Shader shader, float pixelScaleFactorX, float pixelScaleFactorY) {
+        // Support retina display by scaling the projViewTx and pass it to the shader.
+        if (pixelScaleFactorX != 1.0 || pixelScaleFactorY != 1.0) {
+            scratchTx = scratchTx.set(projViewTx);
+            scratchTx.scale(pixelScaleFactorX, pixelScaleFactorY, 1.0);
+            updateRawMatrix(scratchTx);
+        } else {
+            updateRawMatrix(projViewTx);
+        }
+        shader.setMatrix("viewProjectionMatrix", rawMatrix);
+        shader.setConstant("camPos", (float) cameraPos.x,
+                (float) cameraPos.y, (float)cameraPos.z);
+    }
+
+    /**
+     * Queues the mesh view with the current world transform as an instance,
+     * after drawing the queued instances when it cannot join them.
+     */
+    private void queueMeshInstance(ES2MeshView meshView, float pixelScaleFactorX, float pixelScaleFactorY) {
+        ES2PhongMaterial material = meshView.getMaterial();
+        ES2Shader shader = ES2PhongShader.getShader(meshView, this, true);
+        if (instanceCount == MAX_MESH_INSTANCES ||
+                (instanceCount > 0 && !canInstance(meshView, shader, pixelScaleFactorX, pixelScaleFactorY))) {
+            flushMeshInstances();
+        }
+
+        if (instanceCount == 0) {
+            instancedView = meshView;
+            instancedShader = shader;
+            instancedSpecularColor = material.specularColor;
+            instancedScaleX = pixelScaleFactorX;
+            instancedScaleY = pixelScaleFactorY;
+            // The textures stay locked until the instances are drawn
+            for (int i = 0; i < instancedTextures.length; i++) {
+                Texture texture = material.maps[i].getTexture();
+                if (texture != null) {
+                    texture.lock();
+                }
+                instancedTextures[i] = texture;
+            }
+        }
+
+        int offset = instanceCount++ * GLContext.MESH_INSTANCE_SIZE;
+        // The first three rows of the world matrix, the last one is 0 0 0 1
+        for (int i = 0; i < 12; i++) {
+            instanceData[offset + i] = (float) worldTx.get(i);
+        }
+        Color diffuseColor = material.diffuseColor;
+        instanceData[offset + 12] = diffuseColor.getRed();
+        instanceData[offset + 13] = diffuseColor.getGreen();
+        instanceData[offset + 14] = diffuseColor.getBlue();
+        instanceData[offset + 15] = diffuseColor.getAlpha();
+    }
+
+    private boolean canInstance(ES2MeshView meshView, ES2Shader shader,
+            float pixelScaleFactorX, float pixelScaleFactorY) {
+        ES2PhongMaterial material = meshView.getMaterial();
+        if (shader != instancedShader || meshView.getMesh() != instancedView.getMesh() ||
+                meshView.getCullingMode() != instancedView.getCullingMode() ||
+                meshView.isWireframe() != instancedView.isWireframe() ||
+                pixelScaleFactorX != instancedScaleX || pixelScaleFactorY != instancedScaleY ||
+                !material.specularColor.equals(instancedSpecularColor) ||
+                meshView.getAmbientLightRed() != instancedView.getAmbientLightRed() ||
+                meshView.getAmbientLightGreen() != instancedView.getAmbientLightGreen() ||
+                meshView.getAmbientLightBlue() != instancedView.getAmbientLightBlue()) {
+            return false;
+        }
+        for (int i = 0; i < instancedTextures.length; i++) {
+            if (material.maps[i].getTexture() != instancedTextures[i]) {
+                return false;
+            }
+        }
+        ES2Light[] lights = meshView.getLights();
+        ES2Light[] instancedLights = instancedView.getLights();
+        for (int i = 0; i < lights.length; i++) {
+            if (lights[i] != instancedLights[i] &&
+                    (lights[i] == null || !lights[i].hasSameValues(instancedLights[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Draws the queued instances when the given mesh view is the one they use
+    private void flushMeshInstances(long nativeHandle) {
+        if (instanceCount > 0 && instancedView.getNativeHandle() == nativeHandle) {
+            flushMeshInstances();
+        }
+    }
+
+    private void flushMeshInstances() {
+        if (instanceCount == 0) {
+            return;
+        }
+        int count = instanceCount;
+        instanceCount = 0;
+
+        if (!checkDisposed()) {
+            setShaderProgram(instancedShader.getProgramObject());
+            setViewProjection(instancedShader, instancedScaleX, instancedScaleY);
+            ES2PhongShader.setInstancedShaderParameters(instancedShader, instancedView,
+                    instancedSpecularColor, instancedTextures, this);
+            glContext.renderMeshViewInstances(instancedView.getNativeHandle(), instanceData, count);
+        }
+
+        for (int i = 0; i < instancedTextures.length; i++) {
+            if (instancedTextures[i] != null) {
+                instancedTextures[i].unlock();
+                instancedTextures[i] = null;
+            }
+        }
+        instancedView = null;
+        instancedShader = null;
+        instancedSpecularColor = null;
+    }
+
+    @Override
+    public void flushVertexBuffer() {
+        flushMeshInstances();
+        super.flushVertexBuffer();
+    }
+
     @Override
     protected void renderQuads(float coordArray[], byte colorArray[], int numVertices) {
         glContext.drawIndexedQuads(coordArray, colorArray, numVertices);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,4 +68,15 @@ class ES2Light {
         // testing if w is 0 or 1 using <0.5 since equality check for floating points might not work well
         return isAttenuated < 0.5;
     }
+
+    boolean hasSameValues(ES2Light light) {
+        return light != null &&
+                x == light.x && y == light.y && z == light.z &&
+                r == light.r && g == light.g && b == light.b && w == light.w &&
+                ca == light.ca && la == light.la && qa == light.qa &&
+                isAttenuated == light.isAttenuated && maxRange == light.maxRange &&
+                dirX == light.dirX && dirY == light.dirY && dirZ == light.dirZ &&
+                innerAngle == light.innerAngle && outerAngle == light.outerAngle &&
+                falloff == light.falloff;
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.prism.es2;
 
 import com.sun.prism.impl.BaseMesh;
 import com.sun.prism.impl.Disposer;
+import java.util.Arrays;
 
 /**
  * TODO: 3D - Need documentation
@@ -37,6 +38,16 @@ class ES2Mesh extends BaseMesh {
     private final ES2Context context;
     private final long nativeHandle;
 
+    // Once a mesh is built a second time it is treated as dynamic: copies of
+    // the uploaded buffers are kept so that later builds only upload the
+    // range of vertices that changed
+    private boolean built;
+    private float[] uploadedVertices;
+    private int uploadedVertexLength;
+    private int[] uploadedIndicesInt;
+    private short[] uploadedIndicesShort;
+    private int uploadedIndexLength;
+
     private ES2Mesh(ES2Context context, long nativeHandle, Disposer.Record disposerRecord) {
         super(disposerRecord);
         this.context = context;
@@ -67,15 +78,69 @@ class ES2Mesh extends BaseMesh {
     @Override
     public boolean buildNativeGeometry(float[] vertexBuffer, int vertexBufferLength,
             int[] indexBufferInt, int indexBufferLength) {
+        if (built && uploadedIndicesInt != null && indexBufferLength == uploadedIndexLength &&
+                Arrays.equals(indexBufferInt, 0, indexBufferLength,
+                              uploadedIndicesInt, 0, indexBufferLength) &&
+                vertexBufferLength == uploadedVertexLength &&
+                updateVertices(vertexBuffer, vertexBufferLength)) {
+            return true;
+        }
+        // Also rebuilds the whole geometry when the partial update failed
+        boolean dynamic = built;
+        built = true;
+        if (dynamic) {
+            uploadedIndicesInt = Arrays.copyOf(indexBufferInt, indexBufferLength);
+            uploadedIndicesShort = null;
+            keepVertices(vertexBuffer, vertexBufferLength, indexBufferLength);
+        }
         return context.buildNativeGeometry(nativeHandle, vertexBuffer,
-                vertexBufferLength, indexBufferInt, indexBufferLength);
+                vertexBufferLength, indexBufferInt, indexBufferLength, dynamic);
     }
 
     @Override
     public boolean buildNativeGeometry(float[] vertexBuffer, int vertexBufferLength,
             short[] indexBufferShort, int indexBufferLength) {
+        if (built && uploadedIndicesShort != null && indexBufferLength == uploadedIndexLength &&
+                Arrays.equals(indexBufferShort, 0, indexBufferLength,
+                              uploadedIndicesShort, 0, indexBufferLength) &&
+                vertexBufferLength == uploadedVertexLength &&
+                updateVertices(vertexBuffer, vertexBufferLength)) {
+            return true;
+        }
+        // Also rebuilds the whole geometry when the partial update failed
+        boolean dynamic = built;
+        built = true;
+        if (dynamic) {
+            uploadedIndicesShort = Arrays.copyOf(indexBufferShort, indexBufferLength);
+            uploadedIndicesInt = null;
+            keepVertices(vertexBuffer, vertexBufferLength, indexBufferLength);
+        }
         return context.buildNativeGeometry(nativeHandle, vertexBuffer,
-                vertexBufferLength, indexBufferShort, indexBufferLength);
+                vertexBufferLength, indexBufferShort, indexBufferLength, dynamic);
+    }
+
+    private void keepVertices(float[] vertexBuffer, int vertexBufferLength, int indexBufferLength) {
+        if (uploadedVertices == null || uploadedVertices.length < vertexBufferLength) {
+            uploadedVertices = new float[vertexBufferLength];
+        }
+        System.arraycopy(vertexBuffer, 0, uploadedVertices, 0, vertexBufferLength);
+        uploadedVertexLength = vertexBufferLength;
+        uploadedIndexLength = indexBufferLength;
+    }
+
+    // Uploads the range of vertices that differs from the last upload
+    private boolean updateVertices(float[] vertexBuffer, int vertexBufferLength) {
+        int from = Arrays.mismatch(vertexBuffer, 0, vertexBufferLength,
+                                   uploadedVertices, 0, vertexBufferLength);
+        if (from < 0) {
+            return true;
+        }
+        int to = vertexBufferLength;
+        while (to - 1 > from && vertexBuffer[to - 1] == uploadedVertices[to - 1]) {
+            to--;
+        }
+        System.arraycopy(vertexBuffer, from, uploadedVertices, from, to - from);
+        return context.updateNativeGeometry(nativeHandle, vertexBuffer, from, to);
     }
 
     static class ES2MeshDisposerRecord implements Disposer.Record {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,8 @@ class ES2MeshView extends BaseMeshView {
     private float ambientLightRed = 0;
     private float ambientLightBlue = 0;
     private float ambientLightGreen = 0;
+    private int cullingMode;
+    private boolean wireframe;
 
     // NOTE: We only support up to 3 point lights at the present
     private ES2Light[] lights = new ES2Light[3];
@@ -66,9 +68,14 @@ class ES2MeshView extends BaseMeshView {
 
     @Override
     public void setCullingMode(int cullingMode) {
+        this.cullingMode = cullingMode;
         context.setCullingMode(nativeHandle, cullingMode);
     }
 
+    int getCullingMode() {
+        return cullingMode;
+    }
+
     @Override
     public void setMaterial(Material material) {
         context.setMaterial(nativeHandle, material);
@@ -77,9 +84,14 @@ class ES2MeshView extends BaseMeshView {
 
     @Override
     public void setWireframe(boolean wireframe) {
+        this.wireframe = wireframe;
         context.setWireframe(nativeHandle, wireframe);
     }
 
+    boolean isWireframe() {
+        return wireframe;
+    }
+
     @Override
     public void setAmbientLight(float r, float g, float b) {
         ambientLightRed = r;
@@ -128,12 +140,21 @@ class ES2MeshView extends BaseMeshView {
         return material;
     }
 
+    ES2Mesh getMesh() {
+        return mesh;
+    }
+
+    long getNativeHandle() {
+        return nativeHandle;
+    }
+
     @Override
     public void dispose() {
         // TODO: 3D - Need a mechanism to "decRefCount" Mesh and Material
+        // The context may still draw this mesh view as queued instances
+        disposerRecord.dispose();
         material = null;
         lights = null;
-        disposerRecord.dispose();
         count--;
     }
 
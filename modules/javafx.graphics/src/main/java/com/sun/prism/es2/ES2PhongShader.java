@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package com.sun.prism.es2;
 
+import com.sun.prism.Texture;
+import com.sun.prism.paint.Color;
 import java.util.HashMap;
 import java.util.Map;
 
@@ -35,6 +37,8 @@ class ES2PhongShader {
 
     //dimensions:
     static ES2Shader shaders[][][][][] = null;
+    // the same shaders taking the world matrix and diffuse color per instance
+    static ES2Shader instancedShaders[][][][][] = null;
     static String vertexShaderSource;
     static String mainFragShaderSource;
 
@@ -74,6 +78,8 @@ class ES2PhongShader {
     static {
         shaders = new ES2Shader[DiffuseState.values().length][SpecularState.values().length]
                 [SelfIllumState.values().length][BumpMapState.values().length][lightStateCount];
+        instancedShaders = new ES2Shader[DiffuseState.values().length][SpecularState.values().length]
+                [SelfIllumState.values().length][BumpMapState.values().length][lightStateCount];
 
         //NOTE: When creating new shaders, underscore denotes a "shader part"
         diffuseShaderParts[DiffuseState.NONE.ordinal()] =
@@ -125,6 +131,10 @@ class ES2PhongShader {
     }
 
     static ES2Shader getShader(ES2MeshView meshView, ES2Context context) {
+        return getShader(meshView, context, false);
+    }
+
+    static ES2Shader getShader(ES2MeshView meshView, ES2Context context, boolean instanced) {
 
         ES2PhongMaterial material = meshView.getMaterial();
 
@@ -150,13 +160,19 @@ class ES2PhongShader {
             if (light != null && light.w > 0) { numLights++; }
         }
 
-        ES2Shader shader = shaders[diffuseState.ordinal()][specularState.ordinal()]
+        ES2Shader[][][][][] cache = instanced ? instancedShaders : shaders;
+        ES2Shader shader = cache[diffuseState.ordinal()][specularState.ordinal()]
                 [selfIllumState.ordinal()][bumpState.ordinal()][numLights];
         if (shader == null) {
             String fragShader = lightingShaderParts[numLights].replace("vec4 apply_diffuse();", diffuseShaderParts[diffuseState.ordinal()]);
             fragShader = fragShader.replace("vec4 apply_specular();", specularShaderParts[specularState.ordinal()]);
             fragShader = fragShader.replace("vec3 apply_normal();", normalMapShaderParts[bumpState.ordinal()]);
             fragShader = fragShader.replace("vec4 apply_selfIllum();", selfIllumShaderParts[selfIllumState.ordinal()]);
+            String vertShader = vertexShaderSource;
+            if (instanced) {
+                vertShader = "#define INSTANCED\n" + vertShader;
+                fragShader = "#define INSTANCED\n" + fragShader;
+            }
 
             String[] pixelShaders = new String[]{
                 fragShader
@@ -167,6 +183,13 @@ class ES2PhongShader {
             attributes.put("pos", 0);
             attributes.put("texCoords", 1);
             attributes.put("tangent", 2);
+            if (instanced) {
+                // see WR0_3D_INDEX - IC_3D_INDEX in PrismES2Defs.h
+                attributes.put("worldRow0", 3);
+                attributes.put("worldRow1", 4);
+                attributes.put("worldRow2", 5);
+                attributes.put("instanceColor", 6);
+            }
 
             Map<String, Integer> samplers = new HashMap<>();
             samplers.put("diffuseTexture", 0);
@@ -174,10 +197,10 @@ class ES2PhongShader {
             samplers.put("normalMap", 2);
             samplers.put("selfIllumTexture", 3);
 
-            shader = ES2Shader.createFromSource(context, vertexShaderSource, pixelShaders, samplers, attributes, 1, false);
+            shader = ES2Shader.createFromSource(context, vertShader, pixelShaders, samplers, attributes, 1, false);
 
 
-            shaders[diffuseState.ordinal()][specularState.ordinal()][selfIllumState.ordinal()]
+            cache[diffuseState.ordinal()][specularState.ordinal()][selfIllumState.ordinal()]
                     [bumpState.ordinal()][numLights] = shader;
         }
         return shader;
@@ -200,6 +223,30 @@ class ES2PhongShader {
         context.updateTexture(2, material.maps[ES2PhongMaterial.BUMP].getTexture());
         context.updateTexture(3, material.maps[ES2PhongMaterial.SELF_ILLUM].getTexture());
 
+        setLightParameters(shader, meshView);
+    }
+
+    /**
+     * Sets the parameters of an instanced shader, which takes the diffuse
+     * color per instance, from the specular color and the textures the
+     * material had when the instances were queued.
+     */
+    static void setInstancedShaderParameters(ES2Shader shader, ES2MeshView meshView,
+            Color specularColor, Texture[] textures, ES2Context context) {
+
+        shader.setConstant("specularColor", specularColor.getRed(),
+                specularColor.getGreen(), specularColor.getBlue(),
+                specularColor.getAlpha());
+
+        context.updateTexture(0, textures[ES2PhongMaterial.DIFFUSE]);
+        context.updateTexture(1, textures[ES2PhongMaterial.SPECULAR]);
+        context.updateTexture(2, textures[ES2PhongMaterial.BUMP]);
+        context.updateTexture(3, textures[ES2PhongMaterial.SELF_ILLUM]);
+
+        setLightParameters(shader, meshView);
+    }
+
+    private static void setLightParameters(ES2Shader shader, ES2MeshView meshView) {
         shader.setConstant("ambientColor", meshView.getAmbientLightRed(),
                 meshView.getAmbientLightGreen(), meshView.getAmbientLightBlue());
 
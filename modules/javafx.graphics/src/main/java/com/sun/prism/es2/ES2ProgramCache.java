@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.es2;
+
+import com.sun.prism.impl.PrismSettings;
+import java.io.ByteArrayOutputStream;
+import java.io.DataOutputStream;
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.StandardOpenOption;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.zip.CRC32;
+
+/**
+ * On-disk cache of linked shader program binaries, so that shaders do not
+ * have to be compiled and linked from source again on every launch. Each
+ * program is stored in its own file, named by a SHA-256 digest of the GL
+ * vendor, renderer and version strings, the shader sources and the
+ * attribute bindings.
+ * <p>
+ * File layout, big endian: magic, version, binary format, binary length,
+ * CRC-32 of the binary, a SHA-256 digest of the driver strings, the digest
+ * of the program, then the binary itself. A file that does not validate, or
+ * whose binary the driver rejects, is deleted and the program is compiled
+ * from source instead. Files written by another driver can never be looked
+ * up again, so they are deleted when the cache is first opened.
+ */
+final class ES2ProgramCache {
+
+    private static final int MAGIC = 0x4A465850; // "JFXP"
+    private static final int VERSION = 2;
+    private static final int DIGEST_SIZE = 32;
+    private static final int DRIVER_OFFSET = 4 + 4 + 4 + 4 + 8;
+    private static final int HEADER_SIZE = DRIVER_OFFSET + 2 * DIGEST_SIZE;
+    private static final String SUFFIX = ".bin";
+
+    private static boolean purged;
+
+    private final GLContext glContext;
+    private final File dir;
+    private final byte[] driverKey;
+
+    private ES2ProgramCache(GLContext glContext, byte[] driverKey) {
+        this.glContext = glContext;
+        this.driverKey = driverKey;
+        String cacheDir = System.getProperty("javafx.cachedir", "");
+        if (cacheDir.isEmpty()) {
+            cacheDir = System.getProperty("user.home") + "/.openjfx/cache";
+        }
+        dir = new File(new File(cacheDir, "prism"), "shaders");
+    }
+
+    /**
+     * Returns the cache for the given context, or null if it is disabled or
+     * the driver cannot save and restore program binaries.
+     */
+    static ES2ProgramCache create(GLContext glContext, String driverInfo) {
+        if (!PrismSettings.programBinaryCache || !glContext.initProgramBinaries()) {
+            return null;
+        }
+        byte[] driverKey;
+        try {
+            driverKey = MessageDigest.getInstance("SHA-256").digest(
+                    driverInfo.getBytes(StandardCharsets.UTF_8));
+        } catch (NoSuchAlgorithmException e) {
+            return null;
+        }
+        ES2ProgramCache cache = new ES2ProgramCache(glContext, driverKey);
+        synchronized (ES2ProgramCache.class) {
+            if (!purged) {
+                purged = true;
+                cache.purge();
+            }
+        }
+        return cache;
+    }
+
+    /**
+     * Deletes the files that are not valid or were written by another
+     * driver. Only the headers are read.
+     */
+    private void purge() {
+        File[] files = dir.listFiles((d, name) -> name.endsWith(SUFFIX));
+        if (files == null) {
+            return;
+        }
+        ByteBuffer header = ByteBuffer.allocate(HEADER_SIZE);
+        byte[] driver = new byte[DIGEST_SIZE];
+        for (File file : files) {
+            header.clear();
+            try (FileChannel channel = FileChannel.open(file.toPath(), StandardOpenOption.READ)) {
+                while (header.hasRemaining() && channel.read(header) >= 0) {
+                }
+            } catch (IOException | RuntimeException e) {
+                continue;
+            }
+            header.flip();
+            if (header.remaining() < HEADER_SIZE ||
+                    header.getInt() != MAGIC || header.getInt() != VERSION) {
+                invalid(file, "bad header");
+                continue;
+            }
+            header.position(DRIVER_OFFSET);
+            header.get(driver);
+            if (!MessageDigest.isEqual(driver, driverKey)) {
+                invalid(file, "written by another driver");
+            }
+        }
+    }
+
+    /**
+     * Returns the key of the program linked from the given shaders and
+     * attribute bindings, or null if no digest is available.
+     */
+    byte[] getKey(String vert, String[] frag, String[] attrs, int[] indexs) {
+        try {
+            MessageDigest md = MessageDigest.getInstance("SHA-256");
+            md.update(driverKey);
+            update(md, vert);
+            for (String f : frag) {
+                update(md, f);
+            }
+            for (int i = 0; i < attrs.length; i++) {
+                update(md, attrs[i]);
+                update(md, Integer.toString(indexs[i]));
+            }
+            return md.digest();
+        } catch (NoSuchAlgorithmException e) {
+            return null;
+        }
+    }
+
+    private static void update(MessageDigest md, String s) {
+        md.update(s.getBytes(StandardCharsets.UTF_8));
+        // Separate the strings so that moving text between them changes the key
+        md.update((byte) 0);
+    }
+
+    private File getFile(byte[] key) {
+        StringBuilder name = new StringBuilder(key.length * 2 + SUFFIX.length());
+        for (byte b : key) {
+            name.append(Character.forDigit((b >> 4) & 0xF, 16));
+            name.append(Character.forDigit(b & 0xF, 16));
+        }
+        return new File(dir, name.append(SUFFIX).toString());
+    }
+
+    /**
+     * Returns a program created from the binary stored for the key, or 0 if
+     * there is none or it is not valid.
+     */
+    int load(byte[] key) {
+        File file = getFile(key);
+        if (!file.isFile()) {
+            return 0;
+        }
+        byte[] binary;
+        int format;
+        try (FileChannel channel = FileChannel.open(file.toPath(), StandardOpenOption.READ)) {
+            long size = channel.size();
+            if (size < HEADER_SIZE || size > Integer.MAX_VALUE) {
+                return invalid(file, "bad size");
+            }
+            ByteBuffer buffer = ByteBuffer.allocate((int) size);
+            while (buffer.hasRemaining()) {
+                if (channel.read(buffer) < 0) {
+                    return invalid(file, "truncated");
+                }
+            }
+            buffer.flip();
+            if (buffer.getInt() != MAGIC || buffer.getInt() != VERSION) {
+                return invalid(file, "bad header");
+            }
+            format = buffer.getInt();
+            int length = buffer.getInt();
+            long crc = buffer.getLong();
+            byte[] driver = new byte[DIGEST_SIZE];
+            buffer.get(driver);
+            byte[] digest = new byte[DIGEST_SIZE];
+            buffer.get(digest);
+            if (length != buffer.remaining() || !MessageDigest.isEqual(driver, driverKey) ||
+                    !MessageDigest.isEqual(digest, key)) {
+                return invalid(file, "bad header");
+            }
+            binary = new byte[length];
+            buffer.get(binary);
+            CRC32 crc32 = new CRC32();
+            crc32.update(binary);
+            if (crc32.getValue() != crc) {
+                return invalid(file, "bad checksum");
+            }
+        } catch (IOException | RuntimeException e) {
+            return invalid(file, e.toString());
+        }
+        int programID = glContext.createProgramFromBinary(format, binary);
+        if (programID == 0) {
+            return invalid(file, "rejected by the driver");
+        }
+        return programID;
+    }
+
+    private static int invalid(File file, String reason) {
+        if (PrismSettings.verbose) {
+            System.err.println("Ignoring program binary " + file + ": " + reason);
+        }
+        try {
+            Files.deleteIfExists(file.toPath());
+        } catch (IOException e) {
+        }
+        return 0;
+    }
+
+    /**
+     * Stores the binary of the given linked program for the key. The file is
+     * written to a temporary file first, so concurrent readers never see a
+     * partial file.
+     */
+    void store(byte[] key, int programID) {
+        int[] format = new int[1];
+        byte[] binary = glContext.getProgramBinary(programID, format);
+        if (binary == null) {
+            return;
+        }
+        File file = getFile(key);
+        Path tmp = null;
+        try {
+            CRC32 crc32 = new CRC32();
+            crc32.update(binary);
+            ByteArrayOutputStream bytes = new ByteArrayOutputStream(HEADER_SIZE + binary.length);
+            DataOutputStream out = new DataOutputStream(bytes);
+            out.writeInt(MAGIC);
+            out.writeInt(VERSION);
+            out.writeInt(format[0]);
+            out.writeInt(binary.length);
+            out.writeLong(crc32.getValue());
+            out.write(driverKey);
+            out.write(key);
+            out.write(binary);
+            out.flush();
+
+            if (!dir.isDirectory() && !dir.mkdirs()) {
+                return;
+            }
+            tmp = Files.createTempFile(dir.toPath(), file.getName(), ".tmp");
+            try (FileChannel channel = FileChannel.open(tmp, StandardOpenOption.WRITE)) {
+                ByteBuffer buffer = ByteBuffer.wrap(bytes.toByteArray());
+                while (buffer.hasRemaining()) {
+                    channel.write(buffer);
+                }
+            }
+            Files.move(tmp, file.toPath(), StandardCopyOption.REPLACE_EXISTING,
+                       StandardCopyOption.ATOMIC_MOVE);
+            tmp = null;
+        } catch (IOException | RuntimeException e) {
+            if (PrismSettings.verbose) {
+                System.err.println("Could not write " + file + ": " + e);
+            }
+        } finally {
+            if (tmp != null) {
+                try {
+                    Files.deleteIfExists(tmp);
+                } catch (IOException e) {
+                }
+            }
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@ import com.sun.glass.ui.Screen;
 import com.sun.prism.Graphics;
 import com.sun.prism.Image;
 import com.sun.prism.PixelFormat;
+import com.sun.prism.PixelReadback;
 import com.sun.prism.RTTexture;
 import com.sun.prism.ReadbackRenderTarget;
 import com.sun.prism.Texture;
@@ -336,6 +337,23 @@ class ES2RTTexture extends ES2Texture<ES2RTTextureData>
         return result;
     }
 
+    @Override
+    public PixelReadback readPixelsAsync(int x, int y, int width, int height) {
+        context.flushVertexBuffer();
+        GLContext glContext = context.getGLContext();
+        int id = glContext.getBoundFBO();
+        int fboID = getFboID();
+        boolean changeBoundFBO = id != fboID;
+        if (changeBoundFBO) {
+            glContext.bindFBO(fboID);
+        }
+        long readback = glContext.readPixelsAsync(x, y, width, height);
+        if (changeBoundFBO) {
+            glContext.bindFBO(id);
+        }
+        return readback != 0 ? new ES2PixelReadback(glContext, readback) : null;
+    }
+
     @Override
     public boolean readPixels(Buffer pixels) {
         return readPixels(pixels, getContentX(), getContentY(),
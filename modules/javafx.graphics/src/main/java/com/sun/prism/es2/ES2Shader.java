@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -117,23 +117,45 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             int maxTexCoordIndex,
             boolean isPixcoordUsed) {
         GLContext glCtx = context.getGLContext();
-        if (!glCtx.isShaderCompilerSupported()) {
-            throw new RuntimeException("Shader compiler not available on this device");
-        }
-
         if (vert == null || frag == null || frag.length == 0) {
             throw new RuntimeException(
                     "Both vertexShaderSource and fragmentShaderSource "
                     + "must be specified");
         }
 
+        String[] attrs = new String[attributes.size()];
+        int[] indexs = new int[attrs.length];
+        int i = 0;
+        for (String attr : attributes.keySet()) {
+            attrs[i] = attr;
+            indexs[i] = attributes.get(attr);
+            i++;
+        }
+
+        ES2ProgramCache programCache = context.getProgramCache();
+        byte[] cacheKey = programCache != null ?
+                programCache.getKey(vert, frag, attrs, indexs) : null;
+        if (cacheKey != null) {
+            int programID = programCache.load(cacheKey);
+            if (programID != 0) {
+                // No shader objects are attached to a program from a binary
+                return new ES2Shader(context,
+                        programID, 0, new int[frag.length],
+                        samplers, maxTexCoordIndex, isPixcoordUsed);
+            }
+        }
+
+        if (!glCtx.isShaderCompilerSupported()) {
+            throw new RuntimeException("Shader compiler not available on this device");
+        }
+
         int vertexShaderID = glCtx.compileShader(vert, true);
         if (vertexShaderID == 0) {
             throw new RuntimeException("Error creating vertex shader");
         }
 
         int[] fragmentShaderID = new int[frag.length];
-        for (int i = 0; i < frag.length; i++) {
+        for (i = 0; i < frag.length; i++) {
             fragmentShaderID[i] = glCtx.compileShader(frag[i], false);
             if (fragmentShaderID[i] == 0) {
                 glCtx.deleteShader(vertexShaderID);
@@ -142,14 +164,6 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             }
         }
 
-        String[] attrs = new String[attributes.size()];
-        int[] indexs = new int[attrs.length];
-        int i = 0;
-        for (String attr : attributes.keySet()) {
-            attrs[i] = attr;
-            indexs[i] = attributes.get(attr);
-            i++;
-        }
         int programID = glCtx.createProgram(vertexShaderID, fragmentShaderID,
                 attrs, indexs);
         if (programID == 0) {
@@ -157,6 +171,9 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             // vertexShader and fragmentShader resources
             throw new RuntimeException("Error creating shader program");
         }
+        if (cacheKey != null) {
+            programCache.store(cacheKey, programID);
+        }
 
         return new ES2Shader(context,
                 programID, vertexShaderID, fragmentShaderID,
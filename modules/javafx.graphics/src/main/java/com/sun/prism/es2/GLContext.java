@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.prism.es2;
 
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.nio.IntBuffer;
 import com.sun.javafx.PlatformUtil;
 import com.sun.prism.MeshView;
@@ -115,6 +116,13 @@ abstract class GLContext {
     // Use by Uniform Matrix
     final static int NUM_MATRIX_ELEMENTS          = 16;
 
+    // Mesh instancing support, see getMeshInstancing()
+    final static int INSTANCING_NONE              = 0;
+    final static int INSTANCING_EMULATED          = 1;
+    final static int INSTANCING_HARDWARE          = 2;
+    // The floats per instance: three rows of the world matrix and the diffuse color
+    final static int MESH_INSTANCE_SIZE           = 16;
+
     long nativeCtxInfo;
     private int maxTextureSize = -1;
     private Boolean nonPowTwoExtAvailable;
@@ -130,6 +138,11 @@ abstract class GLContext {
     private boolean msaa = false;
     private int maxSampleSize = -1;
 
+    // Uploads at least this large are staged through pixel buffer objects
+    private static final int UPLOAD_BUFFER_THRESHOLD = 256 * 1024;
+    private boolean uploadBuffersAvailable = false;
+    private Boolean asyncReadbackAvailable;
+
     private static final int FBO_ID_UNSET = -1;
     private static final int FBO_ID_NOCACHE = -2;
     private int nativeFBOID = PlatformUtil.isMac() || PlatformUtil.isIOS() ? FBO_ID_NOCACHE : FBO_ID_UNSET;
@@ -137,7 +150,7 @@ abstract class GLContext {
     private static native void nActiveTexture(long nativeCtxInfo, int texUnit);
     private static native void nBindFBO(long nativeCtxInfo, int nativeFBOID);
     private static native void nBindTexture(long nativeCtxInfo, int texID);
-    private static native void nBlendFunc(int sFactor, int dFactor);
+    private static native void nBlendFunc(long nativeCtxInfo, int sFactor, int dFactor);
     private static native void nClearBuffers(long nativeCtxInfo,
             float red, float green, float blue, float alpha,
             boolean clearColor, boolean clearDepth, boolean ignoreScissor);
@@ -151,6 +164,11 @@ abstract class GLContext {
     private static native int nCreateProgram(long nativeCtxInfo,
             int vertexShaderID, int[] fragmentShaderID,
             int numAttrs, String[] attrs, int[] indexs);
+    private static native boolean nInitProgramBinaries(long nativeCtxInfo);
+    private static native byte[] nGetProgramBinary(long nativeCtxInfo,
+            int programID, int[] format);
+    private static native int nCreateProgramFromBinary(long nativeCtxInfo,
+            int format, byte[] binary);
     private static native int nCreateTexture(long nativeCtxInfo, int width,
             int height);
     private static native void nDeleteRenderBuffer(long nativeCtxInfo, int rbID);
@@ -160,6 +178,7 @@ abstract class GLContext {
     private static native void nDisposeShaders(long nativeCtxInfo,
             int pID, int vID, int[] fID);
     private static native void nFinish();
+    private static native void nGetStateCounters(long[] counters);
     private static native int nGenAndBindTexture();
     private static native int nGetFBO();
     private static native int nGetIntParam(int pname);
@@ -171,6 +190,14 @@ abstract class GLContext {
             Buffer buffer, byte[] pixelArr, int x, int y, int w, int h);
     private static native boolean nReadPixelsInt(long nativeCtxInfo, int length,
             Buffer buffer, int[] pixelArr, int x, int y, int w, int h);
+    private static native boolean nIsAsyncReadbackSupported(long nativeCtxInfo);
+    private static native long nReadPixelsAsync(long nativeCtxInfo,
+            int x, int y, int w, int h);
+    private static native boolean nFinishReadbackByte(long nativeCtxInfo, long readback,
+            int length, Buffer buffer, byte[] pixelArr);
+    private static native boolean nFinishReadbackInt(long nativeCtxInfo, long readback,
+            int length, Buffer buffer, int[] pixelArr);
+    private static native void nDisposeReadback(long nativeCtxInfo, long readback);
     private static native void nScissorTest(long nativeCtxInfo, boolean enable,
             int x, int y, int w, int h);
     private static native void nSetDepthTest(long nativeCtxInfo, boolean depthTest);
@@ -182,10 +209,13 @@ abstract class GLContext {
     private static native boolean nTexImage2D1(int target, int level, int internalFormat,
             int width, int height, int border, int format,
             int type, Object pixels, int pixelsByteOffset, boolean useMipmap);
-    private static native void nTexSubImage2D0(int target, int level,
+    private static native boolean nInitUploadBuffers(long nativeCtxInfo);
+    private static native void nTexSubImage2D0(long nativeCtxInfo, boolean useUploadBuffer,
+            int target, int level,
             int xoffset, int yoffset, int width, int height, int format,
             int type, Object pixels, int pixelsByteOffset);
-    private static native void nTexSubImage2D1(int target, int level,
+    private static native void nTexSubImage2D1(long nativeCtxInfo, boolean useUploadBuffer,
+            int target, int level,
             int xoffset, int yoffset, int width, int height, int format,
             int type, Object pixels, int pixelsByteOffset);
     private static native void nUpdateViewport(long nativeCtxInfo, int x, int y,
@@ -224,6 +254,10 @@ abstract class GLContext {
     private static native void nDisableVertexAttributes(long nativeCtxInfo);
     private static native void nDrawIndexedQuads(long nativeCtxInfo, int numVertices,
             float dataf[], byte datab[]);
+    private static native ByteBuffer nMapVertexRing(long nativeCtxInfo, int numVertices);
+    private static native boolean nDrawMappedQuads(long nativeCtxInfo, int numVertices);
+    private static native void nSetVertexRingSize(long nativeCtxInfo, long size);
+    private static native void nDisposeBuffers(long nativeCtxInfo);
     private static native int nCreateIndexBuffer16(long nativeCtxInfo, short data[], int n);
     private static native void nSetIndexBuffer(long nativeCtxInfo, int buffer);
 
@@ -232,9 +266,13 @@ abstract class GLContext {
     private static native long nCreateES2Mesh(long nativeCtxInfo);
     private static native void nReleaseES2Mesh(long nativeCtxInfo, long nativeHandle);
     private static native boolean nBuildNativeGeometryShort(long nativeCtxInfo, long nativeHandle,
-            float[] vertexBuffer, int vertexBufferLength, short[] indexBuffer, int indexBufferLength);
+            float[] vertexBuffer, int vertexBufferLength, short[] indexBuffer, int indexBufferLength,
+            boolean dynamic);
     private static native boolean nBuildNativeGeometryInt(long nativeCtxInfo, long nativeHandle,
-            float[] vertexBuffer, int vertexBufferLength, int[] indexBuffer, int indexBufferLength);
+            float[] vertexBuffer, int vertexBufferLength, int[] indexBuffer, int indexBufferLength,
+            boolean dynamic);
+    private static native boolean nUpdateNativeGeometry(long nativeCtxInfo, long nativeHandle,
+            float[] vertexBuffer, int from, int to);
     private static native long nCreateES2PhongMaterial(long nativeCtxInfo);
     private static native void nReleaseES2PhongMaterial(long nativeCtxInfo, long nativeHandle);
     private static native void nSetSolidColor(long nativeCtxInfo, long nativePhongMaterial,
@@ -256,6 +294,9 @@ abstract class GLContext {
             float isAttenuated, float maxRange, float dirX, float dirY, float dirZ,
             float innerAngle, float outerAngle, float falloff);
     private static native void nRenderMeshView(long nativeCtxInfo, long nativeMeshViewInfo);
+    private static native int nGetMeshInstancing(long nativeCtxInfo);
+    private static native void nRenderMeshViewInstances(long nativeCtxInfo, long nativeMeshViewInfo,
+            float[] instanceData, int count);
     private static native void nBlit(long nativeCtxInfo, int srcFBO, int dstFBO,
             int srcX0, int srcY0, int srcX1, int srcY1,
             int dstX0, int dstY0, int dstX1, int dstY1);
@@ -287,7 +328,7 @@ abstract class GLContext {
     }
 
     void blendFunc(int sFactor, int dFactor) {
-        nBlendFunc(sFactor, dFactor);
+        nBlendFunc(nativeCtxInfo, sFactor, dFactor);
     }
 
     boolean canCreateNonPowTwoTextures() {
@@ -386,6 +427,30 @@ abstract class GLContext {
                 attrs.length, attrs, indexs);
     }
 
+    /**
+     * Enables retrieving the binaries of programs linked from now on.
+     * Returns false if the driver cannot save and restore program binaries.
+     */
+    boolean initProgramBinaries() {
+        return nInitProgramBinaries(nativeCtxInfo);
+    }
+
+    /**
+     * Returns the binary of the given linked program, with its driver
+     * specific format stored in format[0], or null if none is available.
+     */
+    byte[] getProgramBinary(int programID, int[] format) {
+        return nGetProgramBinary(nativeCtxInfo, programID, format);
+    }
+
+    /**
+     * Creates a program from a binary returned by getProgramBinary(). Returns
+     * 0 if the driver rejects the binary, for example after a driver update.
+     */
+    int createProgramFromBinary(int format, byte[] binary) {
+        return nCreateProgramFromBinary(nativeCtxInfo, format, binary);
+    }
+
     int createTexture(int width, int height) {
         return nCreateTexture(nativeCtxInfo, width, height);
     }
@@ -423,6 +488,34 @@ abstract class GLContext {
         nFinish();
     }
 
+    // Names of the state change counters kept by the native code, in order
+    private static final String[] STATE_COUNTER_NAMES = {
+        "activeTexture", "bindTexture", "useProgram", "blendFunc",
+        "scissor", "texParameter", "uniform"
+    };
+    private static long lastStateCountersTime = System.nanoTime();
+
+    /**
+     * Prints, at most once a second, how many state changes were issued to
+     * the driver and how many were skipped as redundant since the last time
+     * and resets the counters. Used for -Dprism.glStateStats=true.
+     */
+    static void printStateCounters() {
+        long now = System.nanoTime();
+        if (now - lastStateCountersTime < 1_000_000_000L) {
+            return;
+        }
+        lastStateCountersTime = now;
+        long[] counters = new long[2 * STATE_COUNTER_NAMES.length];
+        nGetStateCounters(counters);
+        StringBuilder sb = new StringBuilder("GL state changes (issued/skipped):");
+        for (int i = 0; i < STATE_COUNTER_NAMES.length; i++) {
+            sb.append(' ').append(STATE_COUNTER_NAMES[i]).append(' ')
+              .append(counters[2 * i]).append('/').append(counters[2 * i + 1]);
+        }
+        System.err.println(sb);
+    }
+
     int genAndBindTexture() {
         int texID = nGenAndBindTexture();
         boundTextures[activeTexUnit] = texID;
@@ -556,6 +649,38 @@ abstract class GLContext {
         return res;
     }
 
+    /**
+     * Starts reading back pixels of the bound framebuffer into a pixel
+     * buffer object guarded by a fence. Returns 0 when the context has no
+     * support for it.
+     */
+    long readPixelsAsync(int x, int y, int w, int h) {
+        if (asyncReadbackAvailable == null) {
+            asyncReadbackAvailable = nIsAsyncReadbackSupported(nativeCtxInfo);
+        }
+        return asyncReadbackAvailable ? nReadPixelsAsync(nativeCtxInfo, x, y, w, h) : 0;
+    }
+
+    // Waits for the readback and releases it
+    boolean finishReadback(long readback, Buffer buffer) {
+        if (buffer instanceof ByteBuffer) {
+            ByteBuffer buf = (ByteBuffer) buffer;
+            byte[] arr = buf.hasArray() ? buf.array() : null;
+            return nFinishReadbackByte(nativeCtxInfo, readback, buf.capacity(), buffer, arr);
+        } else if (buffer instanceof IntBuffer) {
+            IntBuffer buf = (IntBuffer) buffer;
+            int[] arr = buf.hasArray() ? buf.array() : null;
+            return nFinishReadbackInt(nativeCtxInfo, readback, buf.capacity() * 4, buffer, arr);
+        }
+        nDisposeReadback(nativeCtxInfo, readback);
+        throw new IllegalArgumentException("readPixel: pixel's buffer type is not supported: "
+                + buffer);
+    }
+
+    void disposeReadback(long readback) {
+        nDisposeReadback(nativeCtxInfo, readback);
+    }
+
     void scissorTest(boolean enable, int x, int y, int w, int h) {
         nScissorTest(nativeCtxInfo, enable, x, y, w, h);
     }
@@ -591,15 +716,29 @@ abstract class GLContext {
 
     }
 
+    /**
+     * Lets large texture updates be staged through a small pool of pixel
+     * buffer objects, when the context supports them, so the driver can
+     * transfer them to the texture asynchronously.
+     */
+    void initUploadBuffers() {
+        uploadBuffersAvailable = nInitUploadBuffers(nativeCtxInfo);
+    }
+
     void texSubImage2D(int target, int level, int xoffset, int yoffset,
             int width, int height, int format, int type, java.nio.Buffer pixels) {
         boolean direct = BufferFactory.isDirect(pixels);
+        boolean useUploadBuffer = uploadBuffersAvailable && pixels != null &&
+                ((long) pixels.remaining() << ES2Texture.getBufferElementSizeLog(pixels))
+                        >= UPLOAD_BUFFER_THRESHOLD;
         if (direct) {
-            nTexSubImage2D0(target, level, xoffset, yoffset, width, height,
+            nTexSubImage2D0(nativeCtxInfo, useUploadBuffer,
+                    target, level, xoffset, yoffset, width, height,
                     format, type, pixels,
                     BufferFactory.getDirectBufferByteOffset(pixels));
         } else {
-            nTexSubImage2D1(target, level, xoffset, yoffset, width, height,
+            nTexSubImage2D1(nativeCtxInfo, useUploadBuffer,
+                    target, level, xoffset, yoffset, width, height,
                     format, type, BufferFactory.getArray(pixels),
                     BufferFactory.getIndirectBufferByteOffset(pixels));
         }
@@ -720,10 +859,44 @@ abstract class GLContext {
         nDisableVertexAttributes(nativeCtxInfo);
     }
 
+    // Layout of the quad batches, see VertexBuffer
+    private static final int FLOATS_PER_VERT = 7;
+    private static final int BYTES_PER_VERT = 4;
+
     void drawIndexedQuads(float coords[], byte colors[], int numVertices) {
+        // The vertices are written straight into a mapped range of the
+        // streaming vertex buffer when the context supports it, so the
+        // arrays are never pinned
+        ByteBuffer ring = nMapVertexRing(nativeCtxInfo, numVertices);
+        if (ring != null) {
+            ring.order(ByteOrder.nativeOrder());
+            ring.asFloatBuffer().put(coords, 0, numVertices * FLOATS_PER_VERT);
+            ring.position(numVertices * FLOATS_PER_VERT * Float.BYTES);
+            ring.put(colors, 0, numVertices * BYTES_PER_VERT);
+            if (nDrawMappedQuads(nativeCtxInfo, numVertices)) {
+                return;
+            }
+        }
         nDrawIndexedQuads(nativeCtxInfo, numVertices, coords, colors);
     }
 
+    /**
+     * Streams the quad batches through a vertex buffer object of the given
+     * size in bytes instead of client side arrays. A size of 0 goes back to
+     * client side arrays.
+     */
+    void setVertexRingSize(long size) {
+        nSetVertexRingSize(nativeCtxInfo, size);
+    }
+
+    /**
+     * Deletes the buffer objects owned by this context. The context must be
+     * current.
+     */
+    void disposeBuffers() {
+        nDisposeBuffers(nativeCtxInfo);
+    }
+
     int createIndexBuffer16(short data[]) {
         return nCreateIndexBuffer16(nativeCtxInfo, data, data.length);
     }
@@ -749,15 +922,27 @@ abstract class GLContext {
     }
 
     boolean buildNativeGeometry(long nativeHandle, float[] vertexBuffer,
-            int vertexBufferLength, short[] indexBuffer, int indexBufferLength) {
+            int vertexBufferLength, short[] indexBuffer, int indexBufferLength,
+            boolean dynamic) {
         return nBuildNativeGeometryShort(nativeCtxInfo, nativeHandle,
-                vertexBuffer, vertexBufferLength, indexBuffer, indexBufferLength);
+                vertexBuffer, vertexBufferLength, indexBuffer, indexBufferLength, dynamic);
     }
 
     boolean buildNativeGeometry(long nativeHandle, float[] vertexBuffer,
-            int vertexBufferLength, int[] indexBuffer, int indexBufferLength) {
+            int vertexBufferLength, int[] indexBuffer, int indexBufferLength,
+            boolean dynamic) {
         return nBuildNativeGeometryInt(nativeCtxInfo, nativeHandle, vertexBuffer,
-                vertexBufferLength, indexBuffer, indexBufferLength);
+                vertexBufferLength, indexBuffer, indexBufferLength, dynamic);
+    }
+
+    /**
+     * Uploads the floats from (inclusive) to to (exclusive) of the vertex
+     * buffer of a mesh built as dynamic, which must have the same length.
+     * The update goes to a second vertex buffer that replaces the one
+     * earlier draws may still be reading.
+     */
+    boolean updateNativeGeometry(long nativeHandle, float[] vertexBuffer, int from, int to) {
+        return nUpdateNativeGeometry(nativeCtxInfo, nativeHandle, vertexBuffer, from, to);
     }
 
     long createES2PhongMaterial() {
@@ -820,4 +1005,21 @@ abstract class GLContext {
     void renderMeshView(long nativeMeshViewInfo) {
         nRenderMeshView(nativeCtxInfo, nativeMeshViewInfo);
     }
+
+    /**
+     * Returns whether mesh views can be drawn as instances with one draw
+     * call (INSTANCING_HARDWARE), with one draw call per instance but
+     * without uniform updates (INSTANCING_EMULATED), or not at all.
+     */
+    int getMeshInstancing() {
+        return nGetMeshInstancing(nativeCtxInfo);
+    }
+
+    /**
+     * Draws count instances of the mesh of the given mesh view. Each instance
+     * takes MESH_INSTANCE_SIZE floats of instanceData.
+     */
+    void renderMeshViewInstances(long nativeMeshViewInfo, float[] instanceData, int count) {
+        nRenderMeshViewInstances(nativeCtxInfo, nativeMeshViewInfo, instanceData, count);
+    }
 }
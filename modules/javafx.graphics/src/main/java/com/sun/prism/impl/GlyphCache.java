@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -79,6 +79,9 @@ public class GlyphCache {
 
     private RectanglePacker packer;
 
+    // Scratch space for the glyph codes passed to FontStrike.prepareGlyphs
+    private int[] glyphCodes;
+
     private boolean isLCDCache;
 
     /* Share a RectanglePacker and its associated texture cache
@@ -133,6 +136,7 @@ public class GlyphCache {
         int len = gl.getGlyphCount();
         Color currentColor = null;
         Point2D pt = new Point2D();
+        boolean prepared = false;
 
         for (int gi = 0; gi < len; gi++) {
             int gc = gl.getGlyphCode(gi);
@@ -146,6 +150,11 @@ public class GlyphCache {
             pt.setLocation(x + gl.getPosX(gi), y + gl.getPosY(gi));
             xform.transform(pt, pt);
             int subPixel = strike.getQuantizedPosition(pt);
+            if (!prepared && !isCached(gc, subPixel)) {
+                // Let the strike rasterize the rest of the run at once
+                prepareGlyphs(gl, gi, len);
+                prepared = true;
+            }
             GlyphData data = getCachedGlyph(gc, subPixel);
             if (data != null) {
                 if (clip != null) {
@@ -238,6 +247,30 @@ public class GlyphCache {
         packer.clear();
     }
 
+    private boolean isCached(int glyphCode, int subPixel) {
+        int segIndex = glyphCode >>> SEGSHIFT;
+        int subIndex = glyphCode & SEGMASK;
+        segIndex |= (subPixel << SUBPIXEL_SHIFT);
+        GlyphData[] segment = glyphDataMap.get(segIndex);
+        return segment != null && segment[subIndex] != null;
+    }
+
+    private void prepareGlyphs(GlyphList gl, int start, int end) {
+        if (glyphCodes == null || glyphCodes.length < end - start) {
+            glyphCodes = new int[end - start];
+        }
+        int count = 0;
+        for (int gi = start; gi < end; gi++) {
+            int gc = gl.getGlyphCode(gi);
+            if ((gc & CompositeGlyphMapper.GLYPHMASK) != CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
+                glyphCodes[count++] = gc;
+            }
+        }
+        if (count > 1) {
+            strike.prepareGlyphs(glyphCodes, count);
+        }
+    }
+
     private GlyphData getCachedGlyph(int glyphCode, int subPixel) {
         int segIndex = glyphCode >>> SEGSHIFT;
         int subIndex = glyphCode & SEGMASK;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -71,6 +71,14 @@ public final class PrismSettings {
     public static final boolean allowHiDPIScaling;
     public static final long maxVram;
     public static final long targetVram;
+    public static final long vertexRingSize;
+    public static final boolean pboUpload;
+    public static final boolean programBinaryCache;
+    public static final boolean glStateStats;
+    public static final boolean meshInstancing;
+    public static final boolean swSIMD;
+    public static final int swBandThreads;
+    public static final boolean swNativeSurface;
     public static final boolean poolStats;
     public static final boolean poolDebug;
     public static final boolean disableEffects;
@@ -270,6 +278,28 @@ public final class PrismSettings {
                           "Try -Dprism.maxvram=<long>[kKmMgG]");
         targetVram = getLong(systemProperties, "prism.targetvram", maxVram / 8, maxVram,
                              "Try -Dprism.targetvram=<long>[kKmMgG]|<double(0,100)>%");
+        /*
+         * Size of the buffer the ES2 pipeline streams vertex batches through,
+         * 0 uses client side vertex arrays instead.
+         */
+        vertexRingSize = getLong(systemProperties, "prism.vertexRingSize", 4 * 1024 * 1024,
+                                 "Try -Dprism.vertexRingSize=<long>[kKmMgG]");
+        // Stage large ES2 texture updates through pixel buffer objects
+        pboUpload = getBoolean(systemProperties, "prism.pboUpload", true);
+        // Keep linked ES2 shader programs on disk, see ES2ProgramCache
+        programBinaryCache = getBoolean(systemProperties, "prism.programBinaryCache", true);
+        // Print how many ES2 state changes were issued and skipped as redundant
+        glStateStats = getBoolean(systemProperties, "prism.glStateStats", false);
+        // Draw consecutive ES2 mesh views sharing a mesh and material state as instances
+        meshInstancing = getBoolean(systemProperties, "prism.meshInstancing", true);
+        // Use the vectorized Pisces compositing loops where the CPU supports them
+        swSIMD = getBoolean(systemProperties, "prism.sw.simd", true);
+        // Threads rendering large Pisces fills in horizontal bands, 0 for one per CPU
+        int bandThreads = getInt(systemProperties, "prism.sw.bandThreads", 1,
+                                 "Try -Dprism.sw.bandThreads=<number>");
+        swBandThreads = bandThreads > 0 ? bandThreads : Runtime.getRuntime().availableProcessors();
+        // Render Pisces frames into native memory instead of Java arrays
+        swNativeSurface = getBoolean(systemProperties, "prism.sw.nativeSurface", true);
         poolStats = getBoolean(systemProperties, "prism.poolstats", false);
         poolDebug = getBoolean(systemProperties, "prism.pooldebug", false);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,7 @@ import com.sun.prism.Texture;
 import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.impl.shape.DMarlinPrismUtils;
 import java.lang.ref.SoftReference;
+import java.util.Arrays;
 
 final class SWContext {
 
@@ -57,7 +58,14 @@ final class SWContext {
     }
 
     static final class DirectRTMarlinAlphaConsumer implements MarlinAlphaConsumer {
+        // Shapes large enough for at least two bands of PiscesRenderer are
+        // accumulated into a mask and filled with fillAlphaMask, which
+        // renders them in parallel bands
+        private static final int MIN_MASK_PIXELS = 2 * 64 * 1024;
+
         private byte alpha_map[];
+        private byte mask[];
+        private boolean useMask;
         private int x;
         private int y;
         private int w;
@@ -73,6 +81,21 @@ final class SWContext {
             this.h = h;
             rowNum = 0;
             this.pr = pr;
+
+            useMask = PiscesRenderer.getBandThreads() > 1 && (long) w * h >= MIN_MASK_PIXELS;
+            if (useMask) {
+                if ((mask == null) || (mask.length < w * h)) {
+                    mask = new byte[w * h];
+                } else {
+                    Arrays.fill(mask, 0, w * h, (byte) 0);
+                }
+            }
+        }
+
+        public void fillMask() {
+            if (useMask) {
+                pr.fillAlphaMask(mask, x, y, w, h, 0, w);
+            }
         }
 
         @Override
@@ -120,7 +143,11 @@ final class SWContext {
                                               final int pix_from, final int pix_to)
         {
             // pix_from indicates the first alpha coverage != 0 within [x; pix_to[
-            pr.emitAndClearAlphaRow(alpha_map, alphaDeltas, pix_y, pix_from, pix_to, (pix_from - x), rowNum);
+            if (useMask) {
+                setMaskRow(alphaDeltas, pix_y, pix_from, pix_to);
+            } else {
+                pr.emitAndClearAlphaRow(alpha_map, alphaDeltas, pix_y, pix_from, pix_to, (pix_from - x), rowNum);
+            }
             rowNum++;
 
             // clear properly the end of the alphaDeltas:
@@ -136,6 +163,22 @@ final class SWContext {
             }
         }
 
+        private void setMaskRow(final int[] alphaDeltas, final int pix_y,
+                                final int pix_from, final int pix_to)
+        {
+            // the coverage emitAndClearAlphaRow would blend for the pixels
+            // pix_from to pix_to
+            final int from = pix_from - x;
+            final int to = Math.min(pix_to - x, w - 1);
+            final int offset = (pix_y - y) * w;
+            int sum = 0;
+            for (int i = from; i <= to; i++) {
+                sum += alphaDeltas[i];
+                alphaDeltas[i] = 0;
+                mask[offset + i] = alpha_map[sum];
+            }
+        }
+
         @Override
         public void setAndClearRelativeAlphas(final int[] blkFlags, final int[] alphaDeltas, final int pix_y,
                                               final int pix_from, final int pix_to)
@@ -181,6 +224,7 @@ final class SWContext {
                 }
                 alphaConsumer.initConsumer(outpix_xmin, outpix_ymin, w, h, pr);
                 renderer.produceAlphas(alphaConsumer);
+                alphaConsumer.fillMask();
             } finally {
                 if (renderer != null) {
                     renderer.dispose();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,8 +27,12 @@ package com.sun.prism.sw;
 
 import com.sun.glass.ui.Pixels;
 import com.sun.javafx.geom.Rectangle;
+import com.sun.pisces.JavaSurface;
+import com.sun.pisces.NativeSurface;
+import com.sun.pisces.RendererBase;
 import com.sun.prism.Presentable;
 import com.sun.prism.PresentableState;
+import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.impl.QueuedPixelSource;
 import java.nio.IntBuffer;
 
@@ -39,10 +43,19 @@ final class SWPresentable extends SWRTTexture implements Presentable {
     private QueuedPixelSource pixelSource = new QueuedPixelSource(false);
 
     public SWPresentable(PresentableState pState, SWResourceFactory factory) {
-        super(factory, pState.getRenderWidth(), pState.getRenderHeight());
+        super(factory, pState.getRenderWidth(), pState.getRenderHeight(),
+              createSurface(pState.getRenderWidth(), pState.getRenderHeight()));
         this.pState = pState;
     }
 
+    private static NativeSurface createSurface(int w, int h) {
+        if (!PrismSettings.swNativeSurface || w <= 0 || h <= 0) {
+            return null;
+        }
+        // Glass expects tightly packed rows
+        return new NativeSurface(RendererBase.TYPE_INT_ARGB_PRE, w, h, false);
+    }
+
     @Override
     public boolean lockResources(PresentableState pState) {
         return (getPhysicalWidth() != pState.getRenderWidth() ||
@@ -61,7 +74,22 @@ final class SWPresentable extends SWRTTexture implements Presentable {
             int h = getPhysicalHeight();
             pixels = pixelSource.getUnusedPixels(w, h, 1.0f, 1.0f);
             IntBuffer pixBuf = (IntBuffer) pixels.getPixels();
-            IntBuffer buf = getSurface().getDataIntBuffer();
+            /*
+             * The surface cannot be handed to glass in place, so this copy
+             * must stay. SceneState uploads the pixels later on the event
+             * thread, and neither the GTK nor the Monocle view lock blocks
+             * the render thread meanwhile, so the next frame would be drawn
+             * into memory that is still being uploaded. Rendering into a
+             * fresh buffer each frame is not an option either, because dirty
+             * region painting relies on the surface keeping its contents.
+             * EmbeddedScene also keeps the uploaded buffer until Swing reads
+             * it, after the surface may have been freed by a resize.
+             */
+            if (getSurface() instanceof NativeSurface surface) {
+                surface.getDataIntBuffer().get(0, pixBuf.array(), 0, w*h);
+                return true;
+            }
+            IntBuffer buf = ((JavaSurface) getSurface()).getDataIntBuffer();
             assert buf.hasArray();
             System.arraycopy(buf.array(), 0, pixBuf.array(), 0, w*h);
             return true;
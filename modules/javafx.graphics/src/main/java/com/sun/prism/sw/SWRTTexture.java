@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.prism.sw;
 
 import com.sun.glass.ui.Screen;
 import com.sun.javafx.geom.Rectangle;
+import com.sun.pisces.AbstractSurface;
 import com.sun.pisces.JavaSurface;
 import com.sun.pisces.PiscesRenderer;
 import com.sun.pisces.RendererBase;
@@ -41,24 +42,44 @@ import java.nio.IntBuffer;
 class SWRTTexture extends SWArgbPreTexture implements RTTexture {
 
     private PiscesRenderer pr;
-    private JavaSurface surface;
+    private AbstractSurface surface;
     private final Rectangle dimensions = new Rectangle();
     private boolean isOpaque;
 
     SWRTTexture(SWResourceFactory factory, int w, int h) {
+        this(factory, w, h, null);
+    }
+
+    /**
+     * Creates a render target that renders into the given surface, if any,
+     * instead of a Java array. Such a target can be read back, but not be
+     * drawn as a texture.
+     */
+    SWRTTexture(SWResourceFactory factory, int w, int h, AbstractSurface surface) {
         super(factory, WrapMode.CLAMP_TO_ZERO, w, h);
-        this.allocate();
-        this.surface = new JavaSurface(getDataNoClone(), RendererBase.TYPE_INT_ARGB_PRE, w, h);
+        if (surface == null) {
+            this.allocate();
+            surface = new JavaSurface(getDataNoClone(), RendererBase.TYPE_INT_ARGB_PRE, w, h);
+        }
+        this.surface = surface;
         this.dimensions.setBounds(0, 0, w, h);
     }
 
-    JavaSurface getSurface() {
+    AbstractSurface getSurface() {
         return this.surface;
     }
 
+    @Override
+    public void dispose() {
+        // frees native surfaces right away, as they are reallocated on
+        // every resize of a presentable
+        pr = null;
+        surface.dispose();
+    }
+
     @Override
     public int[] getPixels() {
-        if (contentWidth == physicalWidth) {
+        if (contentWidth == physicalWidth && getDataNoClone() != null) {
             return getDataNoClone();
         } else {
             return null;
@@ -81,19 +102,25 @@ class SWRTTexture extends SWArgbPreTexture implements RTTexture {
             System.out.println("+ SWRTT.readPixels: this: " + this);
         }
 
-        final int pixbuf[] = getDataNoClone();
+        int pixbuf[] = getDataNoClone();
+        int scan = physicalWidth;
+        if (pixbuf == null) {
+            pixbuf = new int[contentWidth * contentHeight];
+            surface.getRGB(pixbuf, 0, contentWidth, 0, 0, contentWidth, contentHeight);
+            scan = contentWidth;
+        }
         pixels.clear();
         // REMIND: This assumes that the caller wants BGRA PRE data...?
         if (pixels instanceof IntBuffer) {
             final IntBuffer iPixels = (IntBuffer)pixels;
             for (int i = 0; i < contentHeight; i++) {
-                iPixels.put(pixbuf, i*physicalWidth, contentWidth);
+                iPixels.put(pixbuf, i*scan, contentWidth);
             }
         } else if (pixels instanceof ByteBuffer) {
             final ByteBuffer bPixels = (ByteBuffer)pixels;
             for (int i = 0; i < contentHeight; i++) {
                 for (int j = 0; j < contentWidth; j++) {
-                    final int argb = pixbuf[i*physicalWidth + j];
+                    final int argb = pixbuf[i*scan + j];
                     final byte a = (byte) (argb >> 24);
                     final byte r = (byte) (argb >> 16);
                     final byte g = (byte) (argb >>  8);
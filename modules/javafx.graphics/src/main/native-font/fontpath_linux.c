@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <limits.h>
+#include <dirent.h>
 
 #include <dlfcn.h>
 #include <fontconfig/fontconfig.h>
@@ -546,18 +547,190 @@ Java_com_sun_javafx_font_FontConfigManager_getFontConfig
 }
 
 
-JNIEXPORT jboolean JNICALL
-Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
-(JNIEnv *env, jclass obj,
- jobject fontToFileMap,
- jobject fontToFamilyNameMap,
- jobject familyToFontListMap,
- jobject locale
- )
+typedef void (*FcConfigDestroyFuncType)(FcConfig *config);
+typedef FcStrList* (*FcConfigGetStrListFuncType)(FcConfig *config);
+typedef FcStrList* (*FcConfigGetCacheDirsFuncType)(const FcConfig *config);
+typedef FcChar8* (*FcStrListNextFuncType)(FcStrList *list);
+typedef void (*FcStrListDoneFuncType)(FcStrList *list);
+
+/* 64 bit FNV-1a */
+#define STAMP_INIT 14695981039346656037ULL
+static unsigned long long stampBytes(unsigned long long h, const void *p, size_t len) {
+    const unsigned char *b = (const unsigned char *)p;
+    size_t i;
+    for (i = 0; i < len; i++) {
+        h = (h ^ b[i]) * 1099511628211ULL;
+    }
+    return h;
+}
+
+static unsigned long long stampFile(unsigned long long h, const char *path) {
+    struct stat st;
+    h = stampBytes(h, path, strlen(path) + 1);
+    if (stat(path, &st) == 0) {
+        h = stampBytes(h, &st.st_mtim, sizeof(st.st_mtim));
+        h = stampBytes(h, &st.st_size, sizeof(st.st_size));
+        h = stampBytes(h, &st.st_ino, sizeof(st.st_ino));
+    }
+    return h;
+}
+
+static unsigned long long stampDir(unsigned long long h, const char *path) {
+    char file[PATH_MAX];
+    struct dirent *entry;
+    DIR *dir;
+
+    h = stampFile(h, path);
+    if ((dir = opendir(path)) == NULL) {
+        return h;
+    }
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        if (snprintf(file, sizeof(file), "%s/%s", path, entry->d_name) < (int)sizeof(file)) {
+            h = stampFile(h, file);
+        }
+    }
+    closedir(dir);
+    return h;
+}
+
+/*
+ * Stamps a font directory and the directories below it. Adding, removing or
+ * renaming a font changes the modification time of the directory holding
+ * it, which is what fontconfig itself checks. Symbolic links are followed,
+ * like fontconfig does, up to a fixed depth so that a loop terminates.
+ * Readdir order is not stable, so subdirectories are combined with a sum
+ * of their individual stamps.
+ */
+#define STAMP_MAX_DEPTH 8
+
+static unsigned long long stampTree(unsigned long long h, const char *path, int depth) {
+    char file[PATH_MAX];
+    struct dirent *entry;
+    struct stat st;
+    unsigned long long sum = 0;
+    DIR *dir;
+
+    h = stampFile(h, path);
+    if (depth >= STAMP_MAX_DEPTH || (dir = opendir(path)) == NULL) {
+        return h;
+    }
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        if (entry->d_type != DT_DIR && entry->d_type != DT_LNK && entry->d_type != DT_UNKNOWN) {
+            continue;
+        }
+        if (snprintf(file, sizeof(file), "%s/%s", path, entry->d_name) < (int)sizeof(file) &&
+            stat(file, &st) == 0 && S_ISDIR(st.st_mode)) {
+            sum += stampTree(STAMP_INIT, file, depth + 1);
+        }
+    }
+    closedir(dir);
+    return stampBytes(h, &sum, sizeof(sum));
+}
+
+/*
+ * Returns a value that changes whenever the set of fonts fontconfig
+ * would list may have changed, or 0 if it cannot be determined.
+ * fontconfig rewrites its per directory cache files when a font
+ * directory changes, so the stamp covers the configuration files, the
+ * configured font directories with their subdirectories and every file
+ * in the cache directories.
+ * Readdir order is not stable, so the cache files are combined with a
+ * sum of their individual stamps.
+ */
+JNIEXPORT jlong JNICALL
+Java_com_sun_javafx_font_FontConfigManager_getFontConfigStamp
+(JNIEnv *env, jclass obj)
 {
     void *libfontconfig;
-    const char *lang;
-    int langLen, f;
+    FcInitLoadConfigFuncType FcInitLoadConfig;
+    FcConfigDestroyFuncType FcConfigDestroy;
+    FcConfigGetStrListFuncType FcConfigGetConfigFiles;
+    FcConfigGetStrListFuncType FcConfigGetFontDirs;
+    FcConfigGetCacheDirsFuncType FcConfigGetCacheDirs;
+    FcStrListNextFuncType FcStrListNext;
+    FcStrListDoneFuncType FcStrListDone;
+    FcConfig *config;
+    FcStrList *list;
+    FcChar8 *path;
+    unsigned long long stamp = STAMP_INIT;
+    unsigned long long cacheStamp = 0;
+
+    if ((libfontconfig = openFontConfig()) == NULL) {
+        return 0;
+    }
+    FcInitLoadConfig =
+        (FcInitLoadConfigFuncType)dlsym(libfontconfig, "FcInitLoadConfig");
+    FcConfigDestroy =
+        (FcConfigDestroyFuncType)dlsym(libfontconfig, "FcConfigDestroy");
+    FcConfigGetConfigFiles =
+        (FcConfigGetStrListFuncType)dlsym(libfontconfig, "FcConfigGetConfigFiles");
+    FcConfigGetFontDirs =
+        (FcConfigGetStrListFuncType)dlsym(libfontconfig, "FcConfigGetFontDirs");
+    FcConfigGetCacheDirs =
+        (FcConfigGetCacheDirsFuncType)dlsym(libfontconfig, "FcConfigGetCacheDirs");
+    FcStrListNext =
+        (FcStrListNextFuncType)dlsym(libfontconfig, "FcStrListNext");
+    FcStrListDone =
+        (FcStrListDoneFuncType)dlsym(libfontconfig, "FcStrListDone");
+
+    if (FcInitLoadConfig       == NULL ||
+        FcConfigDestroy        == NULL ||
+        FcConfigGetConfigFiles == NULL ||
+        FcConfigGetFontDirs    == NULL ||
+        FcConfigGetCacheDirs   == NULL ||
+        FcStrListNext          == NULL ||
+        FcStrListDone          == NULL) {
+        closeFontConfig(libfontconfig, JNI_FALSE);
+        return 0;
+    }
+
+    /* Only the configuration is loaded, not the fonts */
+    if ((config = (*FcInitLoadConfig)()) == NULL) {
+        closeFontConfig(libfontconfig, JNI_FALSE);
+        return 0;
+    }
+    if ((list = (*FcConfigGetConfigFiles)(config)) != NULL) {
+        while ((path = (*FcStrListNext)(list)) != NULL) {
+            stamp = stampFile(stamp, (const char *)path);
+        }
+        (*FcStrListDone)(list);
+    }
+    if ((list = (*FcConfigGetFontDirs)(config)) != NULL) {
+        while ((path = (*FcStrListNext)(list)) != NULL) {
+            stamp = stampTree(stamp, (const char *)path, 0);
+        }
+        (*FcStrListDone)(list);
+    }
+    if ((list = (*FcConfigGetCacheDirs)(config)) != NULL) {
+        while ((path = (*FcStrListNext)(list)) != NULL) {
+            cacheStamp += stampDir(STAMP_INIT, (const char *)path);
+        }
+        (*FcStrListDone)(list);
+    }
+    (*FcConfigDestroy)(config);
+    closeFontConfig(libfontconfig, JNI_TRUE);
+
+    stamp = stampBytes(stamp, &cacheStamp, sizeof(cacheStamp));
+    return stamp != 0 ? (jlong)stamp : 1;
+}
+
+/*
+ * Returns the file, family name and full name of every TrueType and CFF
+ * font fontconfig knows about, flattened into one array, or null. The
+ * array may end with null elements.
+ */
+JNIEXPORT jobjectArray JNICALL
+Java_com_sun_javafx_font_FontConfigManager_getFontConfigFonts
+(JNIEnv *env, jclass obj)
+{
+    void *libfontconfig;
+    int f, count;
     FcPatternBuildFuncType FcPatternBuild;
     FcObjectSetFuncType FcObjectSetBuild;
     FcFontListFuncType FcFontList;
@@ -566,27 +739,15 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
     FcPattern *pattern;
     FcObjectSet *objset;
     FcFontSet *fontSet;
-    jclass classID, arrayListClass;
-    jmethodID arrayListCtr, addMID, getMID;
-    jmethodID toLowerCaseMID;
-    jmethodID putMID, containsKeyMID;
+    jclass stringClass;
+    jobjectArray result = NULL;
     jboolean debugFC = getenv("PRISM_FONTCONFIG_DEBUG") != NULL;
 
-    if (fontToFileMap == NULL ||
-        fontToFamilyNameMap == NULL ||
-        familyToFontListMap == NULL ||
-        locale == NULL)
-    {
-        if (debugFC) {
-            fprintf(stderr, "Null arg to native fontconfig lookup");
-        }
-        return JNI_FALSE;
-    }
     if ((libfontconfig = openFontConfig()) == NULL) {
         if (debugFC) {
             fprintf(stderr,"Could not open libfontconfig\n");
         }
-        return JNI_FALSE;
+        return NULL;
     }
 
     FcPatternBuild     =
@@ -609,71 +770,40 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
            fprintf(stderr,"Could not find symbols in libfontconfig\n");
         }
         closeFontConfig(libfontconfig, JNI_FALSE);
-        return JNI_FALSE;
+        return NULL;
     }
 
-    // Deleting local refs as we go along so this should be plenty
-    // Unlikely to matter even if it fails.
-    (*env)->EnsureLocalCapacity(env, 64);
-    if ((*env)->ExceptionOccurred(env)) {
-        return JNI_FALSE;
-    }
-    classID = (*env)->FindClass(env, "java/util/HashMap");
-    if ((*env)->ExceptionOccurred(env) || classID == NULL) {
-        return JNI_FALSE;
-    }
-    getMID = (*env)->GetMethodID(env, classID, "get",
-                 "(Ljava/lang/Object;)Ljava/lang/Object;");
-    if ((*env)->ExceptionOccurred(env) || getMID == NULL) {
-        return JNI_FALSE;
-    }
-    putMID = (*env)->GetMethodID(env, classID, "put",
-                 "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
-    if ((*env)->ExceptionOccurred(env) || putMID == NULL) {
-        return JNI_FALSE;
-    }
-
-    containsKeyMID = (*env)->GetMethodID(env, classID, "containsKey",
-                                             "(Ljava/lang/Object;)Z");
-    if ((*env)->ExceptionOccurred(env) || containsKeyMID == NULL) {
-        return JNI_FALSE;
-    }
-
-    arrayListClass = (*env)->FindClass(env, "java/util/ArrayList");
-    if ((*env)->ExceptionOccurred(env) || arrayListClass == NULL) {
-        return JNI_FALSE;
-    }
-    arrayListCtr = (*env)->GetMethodID(env, arrayListClass,
-                                              "<init>", "(I)V");
-    if ((*env)->ExceptionOccurred(env) || arrayListCtr == NULL) {
-        return JNI_FALSE;
-    }
-    addMID = (*env)->GetMethodID(env, arrayListClass,
-                                 "add", "(Ljava/lang/Object;)Z");
-    if ((*env)->ExceptionOccurred(env) || addMID == NULL) {
-        return JNI_FALSE;
+    stringClass = (*env)->FindClass(env, "java/lang/String");
+    if ((*env)->ExceptionOccurred(env) || stringClass == NULL) {
+        closeFontConfig(libfontconfig, JNI_FALSE);
+        return NULL;
     }
 
-    classID = (*env)->FindClass(env, "java/lang/String");
-    if ((*env)->ExceptionOccurred(env) || classID == NULL) {
-        return JNI_FALSE;
-    }
-    toLowerCaseMID =
-        (*env)->GetMethodID(env, classID, "toLowerCase",
-                            "(Ljava/util/Locale;)Ljava/lang/String;");
-    if ((*env)->ExceptionOccurred(env) || toLowerCaseMID == NULL) {
-        return JNI_FALSE;
-    }
     pattern = (*FcPatternBuild)(NULL, FC_OUTLINE, FcTypeBool, FcTrue, NULL);
     objset = (*FcObjectSetBuild)(FC_FAMILY, FC_FAMILYLANG,
                                  FC_FULLNAME, FC_FULLNAMELANG,
                                  FC_FILE, FC_FONTFORMAT, NULL);
     fontSet = (*FcFontList)(NULL, pattern, objset);
+    if (fontSet == NULL) {
+        closeFontConfig(libfontconfig, JNI_FALSE);
+        return NULL;
+    }
 
     if (debugFC) {
         fprintf(stderr,"Fontconfig found %d fonts\n", fontSet->nfont);
     }
 
+    /* Sized for every font, the elements of skipped fonts stay null at the end */
+    if ((size_t)fontSet->nfont > INT_MAX / 3) {
+        goto done;
+    }
+    result = (*env)->NewObjectArray(env, fontSet->nfont * 3, stringClass, NULL);
+    if ((*env)->ExceptionOccurred(env) || result == NULL) {
+        result = NULL;
+        goto done;
+    }
+
+    count = 0;
     for (f=0; f < fontSet->nfont; f++) {
         int n=0, done=0;
         FcPattern *fp = fontSet->fonts[f];
@@ -685,12 +815,11 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
         FcChar8 *fullNameEN = NULL;
         FcChar8 *fullNameLang = NULL;
         FcChar8 *file;
-        FcResult res;
         jstring jFileStr;
-        jstring jFamilyStr, jFamilyStrLC;
-        jstring jFullNameStr, jFullNameStrLC;
-        jobject jList;
+        jstring jFamilyStr;
+        jstring jFullNameStr;
         FcChar8 *format = NULL;
+        char pathname[PATH_MAX+1];
 
         /* We only want TrueType & OpenType fonts for Java FX */
         format = NULL;
@@ -706,7 +835,6 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
         if ((*FcPatternGetString)(fp, FC_FILE, 0, &file) != FcResultMatch) {
             continue;
         } else {
-            char pathname[PATH_MAX+1];
             char* path = realpath((char*)file, pathname);
             if (path == NULL) {
                 continue;
@@ -775,81 +903,36 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
             if (debugFC) {
                 fprintf(stderr,"Failed to create string object");
             }
+            (*env)->ExceptionClear(env);
             continue;
         }
 
-        jFamilyStrLC = (*env)->CallObjectMethod(env, jFamilyStr,
-                                                toLowerCaseMID, locale);
-        if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
-        }
-        jFullNameStrLC = (*env)->CallObjectMethod(env, jFullNameStr,
-                                                  toLowerCaseMID, locale);
+        (*env)->SetObjectArrayElement(env, result, count++, jFileStr);
+        (*env)->SetObjectArrayElement(env, result, count++, jFamilyStr);
+        (*env)->SetObjectArrayElement(env, result, count++, jFullNameStr);
         if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
-        }
-        if (jFamilyStrLC == NULL || jFullNameStrLC == NULL) {
-            if (debugFC) {
-                fprintf(stderr,"Failed to create lower case string object");
-                fflush(stderr);
-            }
-            continue;
-        }
-
-        (*env)->CallObjectMethod(env, fontToFileMap, putMID,
-                                 jFullNameStrLC, jFileStr);
-        if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
-        }
-        (*env)->CallObjectMethod(env, fontToFamilyNameMap, putMID,
-                                 jFullNameStrLC, jFamilyStr);
-        if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
-        }
-        jList = (*env)->CallObjectMethod(env, familyToFontListMap,
-                                         getMID, jFamilyStrLC);
-        if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
-        }
-        if (jList == NULL) {
-            jList = (*env)->NewObject(env, arrayListClass, arrayListCtr, 4);
-            if ((*env)->ExceptionOccurred(env)) {
-                return JNI_FALSE;
-            }
-            (*env)->CallObjectMethod(env, familyToFontListMap,
-                                     putMID, jFamilyStrLC, jList);
-            if ((*env)->ExceptionOccurred(env)) {
-                return JNI_FALSE;
-            }
-        }
-        if (jList == NULL) {
+            /* The caller treats a null array as no fontconfig fonts */
             if (debugFC) {
-                fprintf(stderr,"Fontconfig: List is null\n");
-                fflush(stderr);
+                fprintf(stderr,"Failed to store font strings");
             }
-            continue;
-        }
-        (*env)->CallObjectMethod(env, jList, addMID, jFullNameStr);
-        if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
+            (*env)->ExceptionClear(env);
+            result = NULL;
+            goto done;
         }
-        /* Now referenced from the passed in maps, so can delete local refs. */
         (*env)->DeleteLocalRef(env, jFileStr);
         (*env)->DeleteLocalRef(env, jFamilyStr);
-        (*env)->DeleteLocalRef(env, jFamilyStrLC);
         (*env)->DeleteLocalRef(env, jFullNameStr);
-        (*env)->DeleteLocalRef(env, jFullNameStrLC);
-        (*env)->DeleteLocalRef(env, jList);
-
     }
     if (debugFC) {
         fprintf(stderr,"Done enumerating fontconfig fonts\n");
         fflush(stderr);
     }
+
+done:
     (*FcFontSetDestroy)(fontSet);
     closeFontConfig(libfontconfig, JNI_TRUE);
 
-    return JNI_TRUE;
+    return result;
 }
 
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@
 #include <ft2build.h>
 #include <stdint.h>
 #include <errno.h>
+#include <pthread.h>
 #include FT_FREETYPE_H
 #include FT_OUTLINE_H
 #include FT_LCD_FILTER_H
@@ -45,6 +46,7 @@
     }
 
 extern jboolean checkAndClearException(JNIEnv *env);
+static void outlineCachePurgeFace(JNIEnv *env, FT_Face face);
 #ifdef STATIC_BUILD
 JNIEXPORT jint JNICALL
 JNI_OnLoad_javafx_font_freetype(JavaVM * vm, void * reserved) {
@@ -397,6 +399,78 @@ JNIEXPORT jbyteArray JNICALL OS_NATIVE(getBitmapData)(JNIEnv *env, jclass that,
     return result;
 }
 
+/*
+ * Loads and renders glyphCodes[start, start + count) with the given load
+ * flags and packs each bitmap, without row padding, one after the other
+ * into the direct buffer. For every glyph METRICS_SIZE ints are written to
+ * the metrics array: the offset of the bitmap in the buffer (-1 when the
+ * glyph could not be rendered as a gray or LCD bitmap), width, rows,
+ * bitmap_left, bitmap_top, advance.x and advance.y (26.6) and
+ * linearHoriAdvance (16.16).
+ * Returns the number of glyphs processed, which is less than count when
+ * the buffer is full.
+ */
+#define METRICS_SIZE 8
+JNIEXPORT jint JNICALL OS_NATIVE(renderGlyphs)
+    (JNIEnv *env, jclass that, jlong facePtr, jintArray glyphCodes, jint start,
+     jint count, jint loadFlags, jobject buffer, jintArray metrics)
+{
+    FT_Face face = (FT_Face)facePtr;
+    if (!face || !glyphCodes || !buffer || !metrics) return 0;
+    if (start < 0 || count <= 0) return 0;
+    if (start > (*env)->GetArrayLength(env, glyphCodes) - count) return 0;
+    if (count > (*env)->GetArrayLength(env, metrics) / METRICS_SIZE) return 0;
+
+    unsigned char *dst = (unsigned char *)(*env)->GetDirectBufferAddress(env, buffer);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, buffer);
+    if (!dst || capacity <= 0) return 0;
+
+    jint *lpCodes = NULL;
+    jint *lpMetrics = NULL;
+    jint processed = 0;
+    if ((lpCodes = (*env)->GetIntArrayElements(env, glyphCodes, NULL)) == NULL) goto fail;
+    if ((lpMetrics = (*env)->GetIntArrayElements(env, metrics, NULL)) == NULL) goto fail;
+
+    jlong offset = 0;
+    for (; processed < count; processed++) {
+        jint *m = lpMetrics + processed * METRICS_SIZE;
+        m[0] = -1;
+        if (FT_Load_Glyph(face, (FT_UInt)lpCodes[start + processed], (FT_Int32)loadFlags)) {
+            continue;
+        }
+        FT_GlyphSlot slot = face->glyph;
+        FT_Bitmap *bitmap = &slot->bitmap;
+        if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY && bitmap->pixel_mode != FT_PIXEL_MODE_LCD) {
+            continue;
+        }
+        size_t width = bitmap->width;
+        size_t rows = bitmap->rows;
+        if (width && rows) {
+            if (!bitmap->buffer || bitmap->pitch < (int)width) continue;
+            if (rows > (size_t)(capacity - offset) / width) break;
+        }
+        unsigned char *src = bitmap->buffer;
+        for (size_t y = 0; y < rows; y++) {
+            memcpy(dst + offset + y * width, src, width);
+            src += bitmap->pitch;
+        }
+        m[0] = (jint)offset;
+        m[1] = (jint)width;
+        m[2] = (jint)rows;
+        m[3] = (jint)slot->bitmap_left;
+        m[4] = (jint)slot->bitmap_top;
+        m[5] = (jint)slot->advance.x;
+        m[6] = (jint)slot->advance.y;
+        m[7] = (jint)slot->linearHoriAdvance;
+        offset += width * rows;
+    }
+
+fail:
+    if (lpMetrics) (*env)->ReleaseIntArrayElements(env, metrics, lpMetrics, 0);
+    if (lpCodes) (*env)->ReleaseIntArrayElements(env, glyphCodes, lpCodes, JNI_ABORT);
+    return processed;
+}
+
 JNIEXPORT void JNICALL OS_NATIVE(FT_1Set_1Transform)
     (JNIEnv *env, jclass that, jlong arg0, jobject arg1, jlong arg2, jlong arg3)
 {
@@ -423,6 +497,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FT_1Library_1SetLcdFilter)
 JNIEXPORT jint JNICALL OS_NATIVE(FT_1Done_1Face)
     (JNIEnv *env, jclass that, jlong arg0)
 {
+    outlineCachePurgeFace(env, (FT_Face)arg0);
     return (jint)FT_Done_Face((FT_Face)arg0);
 }
 
@@ -494,11 +569,13 @@ JNIEXPORT jint JNICALL OS_NATIVE(FT_1Set_1Char_1Size)
 #define F26DOT6TOFLOAT(n) (float)n/64.0;
 static const size_t DEFAULT_LEN_TYPES = 10;
 static const size_t DEFAULT_LEN_COORDS = 50;
+
+/* Coordinates are kept in 26.6 fixed point, with y already flipped */
 typedef struct _PathData {
     jbyte* pointTypes;
     size_t numTypes;
     size_t lenTypes;
-    jfloat* pointCoords;
+    jint* pointCoords;
     size_t numCoords;
     size_t lenCoords;
 } PathData;
@@ -520,7 +597,7 @@ static PathData* checkSize(void* user, int coordCount)
         if (info->lenCoords > SIZE_MAX - DEFAULT_LEN_COORDS) goto fail;
         info->lenCoords += DEFAULT_LEN_COORDS;
 
-        jfloat* newPointCoords = (jfloat*)realloc(info->pointCoords, info->lenCoords * sizeof(jfloat));
+        jint* newPointCoords = (jint*)realloc(info->pointCoords, info->lenCoords * sizeof(jint));
         if (newPointCoords == NULL) goto fail;
         info->pointCoords = newPointCoords;
     }
@@ -541,8 +618,8 @@ static int JFX_Outline_MoveToFunc(const FT_Vector*   to,
         return FT_Err_Array_Too_Large;
     }
     info->pointTypes[info->numTypes++] = 0;
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(to->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(to->y);
+    info->pointCoords[info->numCoords++] = (jint)to->x;
+    info->pointCoords[info->numCoords++] = (jint)-to->y;
     return 0;
 }
 
@@ -554,8 +631,8 @@ static int JFX_Outline_LineToFunc(const FT_Vector*   to,
         return FT_Err_Array_Too_Large;
     }
     info->pointTypes[info->numTypes++] = 1;
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(to->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(to->y);
+    info->pointCoords[info->numCoords++] = (jint)to->x;
+    info->pointCoords[info->numCoords++] = (jint)-to->y;
     return 0;
 }
 
@@ -568,10 +645,10 @@ static int JFX_Outline_ConicToFunc(const FT_Vector*  control,
         return FT_Err_Array_Too_Large;
     }
     info->pointTypes[info->numTypes++] = 2;
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(control->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(control->y);
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(to->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(to->y);
+    info->pointCoords[info->numCoords++] = (jint)control->x;
+    info->pointCoords[info->numCoords++] = (jint)-control->y;
+    info->pointCoords[info->numCoords++] = (jint)to->x;
+    info->pointCoords[info->numCoords++] = (jint)-to->y;
     return 0;
 }
 
@@ -585,12 +662,12 @@ static int JFX_Outline_CubicToFunc(const FT_Vector*  control1,
         return FT_Err_Array_Too_Large;
     }
     info->pointTypes[info->numTypes++] = 3;
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(control1->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(control1->y);
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(control2->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(control2->y);
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(to->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(to->y);
+    info->pointCoords[info->numCoords++] = (jint)control1->x;
+    info->pointCoords[info->numCoords++] = (jint)-control1->y;
+    info->pointCoords[info->numCoords++] = (jint)control2->x;
+    info->pointCoords[info->numCoords++] = (jint)-control2->y;
+    info->pointCoords[info->numCoords++] = (jint)to->x;
+    info->pointCoords[info->numCoords++] = (jint)-to->y;
     return 0;
 }
 
@@ -603,80 +680,333 @@ static const  FT_Outline_Funcs JFX_Outline_Funcs =
     0, 0
 };
 
-JNIEXPORT jobject JNICALL OS_NATIVE(FT_1Outline_1Decompose)
-    (JNIEnv *env, jclass that, jlong arg0)
+/* Decomposes the outline in the glyph slot of the face, the caller frees data */
+static jboolean decomposeOutline(FT_Face face, PathData* data)
 {
-    FT_Face face = (FT_Face)arg0;
-    if (face == NULL) return NULL;
+    data->pointTypes = NULL;
+    data->numTypes = 0;
+    data->lenTypes = 0;
+    data->pointCoords = NULL;
+    data->numCoords = 0;
+    data->lenCoords = 0;
+    if (face == NULL) return JNI_FALSE;
     FT_GlyphSlot slot = face->glyph;
-    if (slot == NULL) return NULL;
+    if (slot == NULL) return JNI_FALSE;
     FT_Outline* outline = &slot->outline;
-    if (outline == NULL) return NULL;
 
-    jobject path2D = NULL;
-    PathData data;
-    data.pointTypes = (jbyte*)malloc(sizeof(jbyte) * DEFAULT_LEN_TYPES);
-    data.numTypes = 0;
-    data.lenTypes = DEFAULT_LEN_TYPES;
-    if (data.pointTypes == NULL) {
-        data.pointCoords = NULL;
-        goto fail;
-    }
+    data->pointTypes = (jbyte*)malloc(sizeof(jbyte) * DEFAULT_LEN_TYPES);
+    if (data->pointTypes == NULL) return JNI_FALSE;
+    data->lenTypes = DEFAULT_LEN_TYPES;
 
-    data.pointCoords = (jfloat*)malloc(sizeof(jfloat) * DEFAULT_LEN_COORDS);
-    data.numCoords = 0;
-    data.lenCoords = DEFAULT_LEN_COORDS;
-    if (data.pointCoords == NULL) goto fail;
+    data->pointCoords = (jint*)malloc(sizeof(jint) * DEFAULT_LEN_COORDS);
+    if (data->pointCoords == NULL) return JNI_FALSE;
+    data->lenCoords = DEFAULT_LEN_COORDS;
 
-    /* Decompose outline */
-    FT_Error ftError = FT_Outline_Decompose(outline, &JFX_Outline_Funcs, &data);
-    if (ftError != FT_Err_Ok) goto fail;
+    FT_Error ftError = FT_Outline_Decompose(outline, &JFX_Outline_Funcs, data);
+    return ftError == FT_Err_Ok ? JNI_TRUE : JNI_FALSE;
+}
 
+static jobject newPath2D(JNIEnv *env, const jbyte* pointTypes, jint numTypes,
+                         const jfloat* pointCoords, jint numCoords)
+{
     static jclass path2DClass = NULL;
     static jmethodID path2DCtr = NULL;
     if (path2DClass == NULL) {
         jclass tmpClass = (*env)->FindClass(env, "com/sun/javafx/geom/Path2D");
         if ((*env)->ExceptionOccurred(env) || !tmpClass) {
             fprintf(stderr, "OS_NATIVE error: JNI exception or tmpClass == NULL");
-            goto fail;
+            return NULL;
         }
         path2DClass = (jclass)(*env)->NewGlobalRef(env, tmpClass);
         path2DCtr = (*env)->GetMethodID(env, path2DClass, "<init>", "(I[BI[FI)V");
         if ((*env)->ExceptionOccurred(env) || !path2DCtr) {
             fprintf(stderr, "OS_NATIVE error: JNI exception or path2DCtr == NULL");
-            goto fail;
+            return NULL;
         }
     }
 
-    jbyteArray types = (*env)->NewByteArray(env, data.numTypes);
-    jfloatArray coords = (*env)->NewFloatArray(env, data.numCoords);
+    jobject path2D = NULL;
+    jbyteArray types = (*env)->NewByteArray(env, numTypes);
+    jfloatArray coords = (*env)->NewFloatArray(env, numCoords);
     if (types && coords) {
-        (*env)->SetByteArrayRegion(env, types, 0, data.numTypes, data.pointTypes);
+        (*env)->SetByteArrayRegion(env, types, 0, numTypes, pointTypes);
         if ((*env)->ExceptionOccurred(env)) {
             fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
+            return NULL;
         }
-        (*env)->SetFloatArrayRegion(env, coords, 0, data.numCoords, data.pointCoords);
+        (*env)->SetFloatArrayRegion(env, coords, 0, numCoords, pointCoords);
         if ((*env)->ExceptionOccurred(env)) {
             fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
+            return NULL;
         }
         path2D = (*env)->NewObject(env, path2DClass, path2DCtr,
                                    0 /*winding rule*/,
-                                   types, data.numTypes,
-                                   coords, data.numCoords);
+                                   types, numTypes,
+                                   coords, numCoords);
         if ((*env)->ExceptionOccurred(env) || !path2D) {
             fprintf(stderr, "OS_NATIVE error: JNI exception or path2D == NULL");
-            goto fail;
+            return NULL;
         }
     }
+    return path2D;
+}
+
+JNIEXPORT jobject JNICALL OS_NATIVE(FT_1Outline_1Decompose)
+    (JNIEnv *env, jclass that, jlong arg0)
+{
+    jobject path2D = NULL;
+    jfloat* floatCoords = NULL;
+    PathData data;
+    if (!decomposeOutline((FT_Face)arg0, &data)) goto fail;
+
+    floatCoords = (jfloat*)malloc(sizeof(jfloat) * (data.numCoords + 1));
+    if (floatCoords == NULL) goto fail;
+    for (size_t i = 0; i < data.numCoords; i++) {
+        floatCoords[i] = F26DOT6TOFLOAT(data.pointCoords[i]);
+    }
+    path2D = newPath2D(env, data.pointTypes, (jint)data.numTypes,
+                       floatCoords, (jint)data.numCoords);
 
 fail:
     SAFE_FREE(data.pointTypes);
     SAFE_FREE(data.pointCoords);
+    SAFE_FREE(floatCoords);
     return path2D;
 }
 
+/***********************************************/
+/*             Glyph Outline Cache             */
+/***********************************************/
+
+/*
+ * Glyph outlines shared by all the strikes of a face, keyed by the face,
+ * the glyph, the size in 26.6 and the load flags. Outlines are loaded with
+ * FT_LOAD_IGNORE_TRANSFORM so no other state of the face affects them.
+ *
+ * An entry holds a global reference to the Path2D built on the first
+ * request, and that same Path2D is returned on every hit, so neither the
+ * outline nor its Java arrays are created again. Its users only read it
+ * through a PathIterator. The memory held by the entries, the Java arrays
+ * included, is bounded by a global budget and the least recently used
+ * entries are evicted first.
+ */
+typedef struct _OutlineEntry {
+    struct _OutlineEntry* hashNext;
+    struct _OutlineEntry* lruPrev;
+    struct _OutlineEntry* lruNext;
+    FT_Face face;
+    FT_UInt glyph;
+    FT_F26Dot6 size;
+    FT_Int32 loadFlags;
+    jobject path;
+    size_t bytes;
+} OutlineEntry;
+
+#define OUTLINE_CACHE_BUCKETS 4096
+#define OUTLINE_CACHE_DEFAULT_LIMIT (2 * 1024 * 1024)
+/* Approximate size of a Path2D and the headers of its two arrays */
+#define OUTLINE_PATH_OVERHEAD 96
+
+static OutlineEntry* outlineBuckets[OUTLINE_CACHE_BUCKETS];
+static OutlineEntry* outlineLRUHead = NULL; /* most recently used */
+static OutlineEntry* outlineLRUTail = NULL;
+static size_t outlineCacheBytes = 0;
+static size_t outlineCacheLimit = OUTLINE_CACHE_DEFAULT_LIMIT;
+static jlong outlineCacheEntries = 0;
+static jlong outlineCacheHits = 0;
+static jlong outlineCacheMisses = 0;
+static pthread_mutex_t outlineCacheLock = PTHREAD_MUTEX_INITIALIZER;
+
+static size_t outlineHash(FT_Face face, FT_UInt glyph, FT_F26Dot6 size, FT_Int32 loadFlags)
+{
+    uintptr_t h = (uintptr_t)face;
+    h ^= h >> 7;
+    h = h * 31 + glyph;
+    h = h * 31 + (uintptr_t)size;
+    h = h * 31 + (uintptr_t)loadFlags;
+    h ^= h >> 13;
+    return (size_t)(h % OUTLINE_CACHE_BUCKETS);
+}
+
+/* Must be called with the lock held */
+static OutlineEntry* outlineCacheFind(size_t bucket, FT_Face face, FT_UInt glyph,
+                                      FT_F26Dot6 size, FT_Int32 loadFlags)
+{
+    OutlineEntry* entry = outlineBuckets[bucket];
+    while (entry != NULL &&
+           (entry->face != face || entry->glyph != glyph ||
+            entry->size != size || entry->loadFlags != loadFlags)) {
+        entry = entry->hashNext;
+    }
+    return entry;
+}
+
+static void outlineLRUUnlink(OutlineEntry* entry)
+{
+    if (entry->lruPrev) entry->lruPrev->lruNext = entry->lruNext;
+    else outlineLRUHead = entry->lruNext;
+    if (entry->lruNext) entry->lruNext->lruPrev = entry->lruPrev;
+    else outlineLRUTail = entry->lruPrev;
+    entry->lruPrev = entry->lruNext = NULL;
+}
+
+static void outlineLRUPush(OutlineEntry* entry)
+{
+    entry->lruPrev = NULL;
+    entry->lruNext = outlineLRUHead;
+    if (outlineLRUHead) outlineLRUHead->lruPrev = entry;
+    outlineLRUHead = entry;
+    if (outlineLRUTail == NULL) outlineLRUTail = entry;
+}
+
+/* Must be called with the lock held */
+static void outlineCacheRemove(JNIEnv *env, OutlineEntry* entry)
+{
+    OutlineEntry** link = &outlineBuckets[outlineHash(entry->face, entry->glyph,
+                                                      entry->size, entry->loadFlags)];
+    while (*link != entry) {
+        link = &(*link)->hashNext;
+    }
+    *link = entry->hashNext;
+    outlineLRUUnlink(entry);
+    outlineCacheBytes -= entry->bytes;
+    outlineCacheEntries--;
+    (*env)->DeleteGlobalRef(env, entry->path);
+    free(entry);
+}
+
+/* Must be called with the lock held */
+static void outlineCacheTrim(JNIEnv *env, size_t limit)
+{
+    while (outlineLRUTail != NULL && outlineCacheBytes > limit) {
+        outlineCacheRemove(env, outlineLRUTail);
+    }
+}
+
+/* Drops all the outlines of a face, called before the face is released */
+static void outlineCachePurgeFace(JNIEnv *env, FT_Face face)
+{
+    pthread_mutex_lock(&outlineCacheLock);
+    OutlineEntry* entry = outlineLRUHead;
+    while (entry != NULL) {
+        OutlineEntry* next = entry->lruNext;
+        if (entry->face == face) {
+            outlineCacheRemove(env, entry);
+        }
+        entry = next;
+    }
+    pthread_mutex_unlock(&outlineCacheLock);
+}
+
+/*
+ * Returns the outline of the glyph at the given size, decomposing and
+ * caching it on a miss, or NULL if the glyph cannot be loaded. The
+ * returned Path2D may be shared and must not be modified. The caller
+ * serializes access to the face.
+ */
+JNIEXPORT jobject JNICALL OS_NATIVE(getGlyphOutline)
+    (JNIEnv *env, jclass that, jlong facePtr, jint glyphCode, jint size26dot6, jint loadFlags)
+{
+    FT_Face face = (FT_Face)facePtr;
+    if (face == NULL) return NULL;
+    FT_UInt glyph = (FT_UInt)glyphCode;
+    FT_F26Dot6 size = (FT_F26Dot6)size26dot6;
+    FT_Int32 flags = (FT_Int32)loadFlags;
+    size_t bucket = outlineHash(face, glyph, size, flags);
+
+    pthread_mutex_lock(&outlineCacheLock);
+    OutlineEntry* entry = outlineCacheFind(bucket, face, glyph, size, flags);
+    if (entry != NULL) {
+        outlineCacheHits++;
+        outlineLRUUnlink(entry);
+        outlineLRUPush(entry);
+        jobject path2D = (*env)->NewLocalRef(env, entry->path);
+        pthread_mutex_unlock(&outlineCacheLock);
+        return path2D;
+    }
+    outlineCacheMisses++;
+    pthread_mutex_unlock(&outlineCacheLock);
+
+    /* Nothing is cached for a glyph that fails to load, so a later
+     * request tries again instead of getting a stale outline */
+    if (FT_Set_Char_Size(face, 0, size, 72, 72) != FT_Err_Ok ||
+        FT_Load_Glyph(face, glyph, flags) != FT_Err_Ok) {
+        return NULL;
+    }
+
+    jobject path2D = NULL;
+    jfloat* pointCoords = NULL;
+    PathData data;
+    if (!decomposeOutline(face, &data)) goto fail;
+    pointCoords = (jfloat*)malloc(sizeof(jfloat) * (data.numCoords + 1));
+    if (pointCoords == NULL) goto fail;
+    for (size_t i = 0; i < data.numCoords; i++) {
+        pointCoords[i] = F26DOT6TOFLOAT(data.pointCoords[i]);
+    }
+    path2D = newPath2D(env, data.pointTypes, (jint)data.numTypes,
+                       pointCoords, (jint)data.numCoords);
+    if (path2D == NULL) goto fail;
+
+    size_t bytes = sizeof(OutlineEntry) + OUTLINE_PATH_OVERHEAD +
+                   data.numTypes * sizeof(jbyte) + data.numCoords * sizeof(jfloat);
+    pthread_mutex_lock(&outlineCacheLock);
+    if (bytes <= outlineCacheLimit &&
+        (entry = (OutlineEntry*)calloc(1, sizeof(OutlineEntry))) != NULL) {
+        entry->path = (*env)->NewGlobalRef(env, path2D);
+        if (entry->path == NULL) {
+            free(entry);
+        } else {
+            /* Replace an entry added meanwhile by a concurrent caller */
+            OutlineEntry* other = outlineCacheFind(bucket, face, glyph, size, flags);
+            if (other != NULL) {
+                outlineCacheRemove(env, other);
+            }
+            entry->face = face;
+            entry->glyph = glyph;
+            entry->size = size;
+            entry->loadFlags = flags;
+            entry->bytes = bytes;
+            entry->hashNext = outlineBuckets[bucket];
+            outlineBuckets[bucket] = entry;
+            outlineLRUPush(entry);
+            outlineCacheBytes += bytes;
+            outlineCacheEntries++;
+            outlineCacheTrim(env, outlineCacheLimit);
+        }
+    }
+    pthread_mutex_unlock(&outlineCacheLock);
+
+fail:
+    SAFE_FREE(data.pointTypes);
+    SAFE_FREE(data.pointCoords);
+    SAFE_FREE(pointCoords);
+    return path2D;
+}
+
+JNIEXPORT void JNICALL OS_NATIVE(setGlyphOutlineCacheLimit)
+    (JNIEnv *env, jclass that, jlong limit)
+{
+    pthread_mutex_lock(&outlineCacheLock);
+    outlineCacheLimit = limit > 0 ? (size_t)limit : 0;
+    outlineCacheTrim(env, outlineCacheLimit);
+    pthread_mutex_unlock(&outlineCacheLock);
+}
+
+JNIEXPORT void JNICALL OS_NATIVE(getGlyphOutlineCacheStats)
+    (JNIEnv *env, jclass that, jlongArray stats)
+{
+    jlong values[5];
+    pthread_mutex_lock(&outlineCacheLock);
+    values[0] = (jlong)outlineCacheBytes;
+    values[1] = (jlong)outlineCacheLimit;
+    values[2] = outlineCacheEntries;
+    values[3] = outlineCacheHits;
+    values[4] = outlineCacheMisses;
+    pthread_mutex_unlock(&outlineCacheLock);
+    jsize length = (*env)->GetArrayLength(env, stats);
+    (*env)->SetLongArrayRegion(env, stats, 0, length < 5 ? length : 5, values);
+}
+
 JNIEXPORT jboolean JNICALL JNICALL OS_NATIVE(isPangoEnabled)
     (JNIEnv *env, jclass that) {
     #ifdef _ENABLE_PANGO
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -72,74 +72,182 @@ jboolean checkAndClearException(JNIEnv *env)
 
 /**************************************************************************/
 /*                                                                        */
-/*                            Structs                                     */
+/*                           Shaped run cache                             */
 /*                                                                        */
 /**************************************************************************/
 
-typedef struct PangoGlyphString_FID_CACHE {
-    int cached;
-    jclass clazz;
-    jfieldID num_glyphs, glyphs, widths, log_clusters, offset, length, num_chars, font;
-    jmethodID init;
-} PangoGlyphString_FID_CACHE;
+/*
+ * pango_shape returns a single int array: a header with the number of
+ * glyphs, the number of characters and the 64 bits of the PangoFont
+ * pointer, followed by the glyphs, their widths and their clusters.
+ * Must match PangoGlyphString.java.
+ */
+#define SHAPE_NUM_GLYPHS 0
+#define SHAPE_NUM_CHARS 1
+#define SHAPE_FONT_LO 2
+#define SHAPE_FONT_HI 3
+#define SHAPE_HEADER_SIZE 4
+
+/*
+ * Relayout reshapes the same runs over and over, so recently shaped runs
+ * are kept in a small LRU cache. JavaFX only sets font attributes on the
+ * text, which are resolved into the item's font, so the font, text,
+ * bidi level, script, gravity, flags, language and the remaining attributes
+ * of the item identify a run.
+ */
+#define SHAPE_CACHE_SIZE 256
+#define SHAPE_CACHE_MAX_TEXT 4096
+
+typedef struct ShapeCacheEntry {
+    guint hash;
+    PangoFont *font;
+    PangoLanguage *language;
+    guint8 level, gravity, flags, script;
+    gint length;
+    gchar *text;
+    GSList *extraAttrs;
+    jint *data;
+    jsize dataLength;
+    GList *link;
+} ShapeCacheEntry;
 
-PangoGlyphString_FID_CACHE PangoGlyphStringFc;
+static GMutex shapeCacheLock;
+static GHashTable *shapeCache;
+static GQueue shapeCacheLRU = G_QUEUE_INIT;
 
-void cachePangoGlyphStringFields(JNIEnv *env)
+static guint shapeCacheHash(gconstpointer key)
 {
-    if (PangoGlyphStringFc.cached) return;
-    jclass tmpClass = (*env)->FindClass(env, "com/sun/javafx/font/freetype/PangoGlyphString");
-    if (checkAndClearException(env) || !tmpClass) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or tmpClass == NULL");
-        return;
-    }
-    PangoGlyphStringFc.clazz =  (jclass)(*env)->NewGlobalRef(env, tmpClass);
-    PangoGlyphStringFc.num_glyphs = (*env)->GetFieldID(env, PangoGlyphStringFc.clazz, "num_glyphs", "I");
-    if (checkAndClearException(env) || !PangoGlyphStringFc.num_glyphs) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or num_glyphs == NULL");
-        return;
-    }
-    PangoGlyphStringFc.glyphs = (*env)->GetFieldID(env, PangoGlyphStringFc.clazz, "glyphs", "[I");
-    if (checkAndClearException(env) || !PangoGlyphStringFc.glyphs) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or glyphs == NULL");
-        return;
+    return ((const ShapeCacheEntry *)key)->hash;
+}
+
+static gboolean shapeCacheAttrsEqual(GSList *a, GSList *b)
+{
+    for (; a && b; a = a->next, b = b->next) {
+        if (!pango_attribute_equal(a->data, b->data)) {
+            return FALSE;
+        }
     }
-    PangoGlyphStringFc.widths = (*env)->GetFieldID(env, PangoGlyphStringFc.clazz, "widths", "[I");
-    if (checkAndClearException(env) || !PangoGlyphStringFc.widths) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or widths == NULL");
-        return;
+    return a == b;
+}
+
+static gboolean shapeCacheEqual(gconstpointer a, gconstpointer b)
+{
+    const ShapeCacheEntry *e1 = a;
+    const ShapeCacheEntry *e2 = b;
+    return e1->hash == e2->hash &&
+           e1->font == e2->font &&
+           e1->language == e2->language &&
+           e1->level == e2->level &&
+           e1->gravity == e2->gravity &&
+           e1->flags == e2->flags &&
+           e1->script == e2->script &&
+           e1->length == e2->length &&
+           memcmp(e1->text, e2->text, e1->length) == 0 &&
+           shapeCacheAttrsEqual(e1->extraAttrs, e2->extraAttrs);
+}
+
+static gpointer copyOf(gconstpointer mem, gsize size)
+{
+    gpointer copy = g_malloc(size);
+    memcpy(copy, mem, size);
+    return copy;
+}
+
+static void shapeCacheFree(ShapeCacheEntry *entry)
+{
+    g_object_unref(entry->font);
+    g_free(entry->text);
+    g_slist_free_full(entry->extraAttrs, (GDestroyNotify)pango_attribute_destroy);
+    g_free(entry->data);
+    g_free(entry);
+}
+
+/* Fills in the key part of the entry, the text is not copied */
+static void shapeCacheKey(ShapeCacheEntry *key, const gchar *text, gint length, PangoAnalysis *analysis)
+{
+    /* FNV-1a */
+    guint hash = 2166136261u;
+    gint i;
+    for (i = 0; i < length; i++) {
+        hash = (hash ^ (guint8)text[i]) * 16777619u;
     }
-    PangoGlyphStringFc.log_clusters = (*env)->GetFieldID(env, PangoGlyphStringFc.clazz, "log_clusters", "[I");
-    if (checkAndClearException(env) || !PangoGlyphStringFc.log_clusters) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or log_clusters == NULL");
-        return;
+    hash ^= GPOINTER_TO_UINT(analysis->font) ^ GPOINTER_TO_UINT(analysis->language);
+    hash ^= (analysis->level << 24) | (analysis->gravity << 16) |
+            (analysis->flags << 8) | analysis->script;
+    GSList *attr;
+    for (attr = analysis->extra_attrs; attr; attr = attr->next) {
+        hash = (hash ^ ((PangoAttribute *)attr->data)->klass->type) * 16777619u;
     }
-    PangoGlyphStringFc.offset = (*env)->GetFieldID(env, PangoGlyphStringFc.clazz, "offset", "I");
-    if (checkAndClearException(env) || !PangoGlyphStringFc.offset) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or offset == NULL");
-        return;
+
+    key->hash = hash;
+    key->font = analysis->font;
+    key->language = analysis->language;
+    key->level = analysis->level;
+    key->gravity = analysis->gravity;
+    key->flags = analysis->flags;
+    key->script = analysis->script;
+    key->length = length;
+    key->text = (gchar *)text;
+    key->extraAttrs = analysis->extra_attrs;
+}
+
+/* Returns a copy of the cached data, or NULL. Called with the lock held. */
+static jint *shapeCacheLookup(ShapeCacheEntry *key, jsize *dataLength)
+{
+    if (!shapeCache) return NULL;
+    ShapeCacheEntry *entry = g_hash_table_lookup(shapeCache, key);
+    if (!entry) return NULL;
+    g_queue_unlink(&shapeCacheLRU, entry->link);
+    g_queue_push_head_link(&shapeCacheLRU, entry->link);
+    *dataLength = entry->dataLength;
+    return copyOf(entry->data, entry->dataLength * sizeof(jint));
+}
+
+/* Takes ownership of data. Called with the lock held. */
+static void shapeCacheInsert(ShapeCacheEntry *key, jint *data, jsize dataLength)
+{
+    if (!shapeCache) {
+        shapeCache = g_hash_table_new(shapeCacheHash, shapeCacheEqual);
     }
-    PangoGlyphStringFc.length = (*env)->GetFieldID(env, PangoGlyphStringFc.clazz, "length", "I");
-    if (checkAndClearException(env) || !PangoGlyphStringFc.length) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or length == NULL");
+    if (g_hash_table_contains(shapeCache, key)) {
+        /* Shaped by another thread in the meantime */
+        g_free(data);
         return;
     }
-    PangoGlyphStringFc.num_chars = (*env)->GetFieldID(env, PangoGlyphStringFc.clazz, "num_chars", "I");
-    if (checkAndClearException(env) || !PangoGlyphStringFc.num_chars) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or num_chars == NULL");
-        return;
+    if (g_hash_table_size(shapeCache) >= SHAPE_CACHE_SIZE) {
+        ShapeCacheEntry *oldest = g_queue_pop_tail(&shapeCacheLRU);
+        g_hash_table_remove(shapeCache, oldest);
+        shapeCacheFree(oldest);
     }
-    PangoGlyphStringFc.font = (*env)->GetFieldID(env, PangoGlyphStringFc.clazz, "font", "J");
-    if (checkAndClearException(env) || !PangoGlyphStringFc.font) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or font == NULL");
-        return;
+    ShapeCacheEntry *entry = g_new(ShapeCacheEntry, 1);
+    *entry = *key;
+    entry->font = g_object_ref(key->font);
+    entry->text = copyOf(key->text, key->length);
+    entry->extraAttrs = g_slist_copy_deep(key->extraAttrs, (GCopyFunc)pango_attribute_copy, NULL);
+    entry->data = data;
+    entry->dataLength = dataLength;
+    g_queue_push_head(&shapeCacheLRU, entry);
+    entry->link = shapeCacheLRU.head;
+    g_hash_table_add(shapeCache, entry);
+}
+
+/*
+ * Moves the cursor to the given byte index and returns its character
+ * index. Clusters are monotonic within an item, so mapping all of them
+ * walks the text once.
+ */
+static glong clusterToOffset(const gchar *text, gint index, const gchar **cursor, glong *offset)
+{
+    const gchar *p = text + index;
+    while (*cursor < p) {
+        *cursor = g_utf8_next_char(*cursor);
+        (*offset)++;
     }
-    PangoGlyphStringFc.init = (*env)->GetMethodID(env, PangoGlyphStringFc.clazz, "<init>", "()V");
-    if (checkAndClearException(env) || !PangoGlyphStringFc.init) {
-        fprintf(stderr, "cachePangoGlyphStringFields error: JNI exception or init == NULL");
-        return;
+    while (*cursor > p) {
+        *cursor = g_utf8_prev_char(*cursor);
+        (*offset)--;
     }
-    PangoGlyphStringFc.cached = 1;
+    return *offset;
 }
 
 /**************************************************************************/
@@ -150,84 +258,83 @@ void cachePangoGlyphStringFields(JNIEnv *env)
 
 /** Custom **/
 
-JNIEXPORT jobject JNICALL OS_NATIVE(pango_1shape)
+JNIEXPORT jintArray JNICALL OS_NATIVE(pango_1shape)
     (JNIEnv *env, jclass that, jlong str, jlong pangoItem)
 {
     if (!str) return NULL;
     if (!pangoItem) return NULL;
     PangoItem *item = (PangoItem *)pangoItem;
     PangoAnalysis analysis = item->analysis;
-    if (!pangoItem) return NULL;
     const gchar *text= (const gchar *)(str + item->offset);
-    PangoGlyphString *glyphString = pango_glyph_string_new();
-    if (!glyphString) return NULL;
-
-    jobject result = NULL;
-    pango_shape(text, item->length, &analysis, glyphString);
-    int count = glyphString->num_glyphs;
-    jint *glyphs = NULL;
-    jint *widths = NULL;
-    jint *cluster = NULL;
-    if (count <= 0) goto fail;
-    if ((size_t)count >= INT_MAX / sizeof(jint)) {
-        fprintf(stderr, "OS_NATIVE error: large glyph count value in pango_1shape\n");
-        goto fail;
+
+    jint *data = NULL;
+    jsize dataLength = 0;
+    ShapeCacheEntry key;
+    gboolean cacheable = analysis.font && item->length <= SHAPE_CACHE_MAX_TEXT;
+    if (cacheable) {
+        shapeCacheKey(&key, text, item->length, &analysis);
+        g_mutex_lock(&shapeCacheLock);
+        data = shapeCacheLookup(&key, &dataLength);
+        g_mutex_unlock(&shapeCacheLock);
     }
 
-    jintArray glyphsArray = (*env)->NewIntArray(env, count);
-    jintArray widthsArray = (*env)->NewIntArray(env, count);
-    jintArray clusterArray = (*env)->NewIntArray(env, count);
-    if (glyphsArray && widthsArray && clusterArray) {
-        glyphs = (jint*) malloc(count * sizeof(jint));
-        widths = (jint*) malloc(count * sizeof(jint));
-        cluster = (jint*) malloc(count * sizeof(jint));
-        if (glyphs == NULL ||
-            widths == NULL ||
-            cluster == NULL) {
+    if (!data) {
+        PangoGlyphString *glyphString = pango_glyph_string_new();
+        if (!glyphString) return NULL;
+        pango_shape(text, item->length, &analysis, glyphString);
+        int count = glyphString->num_glyphs;
+        if (count <= 0) {
+            pango_glyph_string_free(glyphString);
+            return NULL;
+        }
+        if ((size_t)count >= (INT_MAX - SHAPE_HEADER_SIZE) / (3 * sizeof(jint))) {
+            fprintf(stderr, "OS_NATIVE error: large glyph count value in pango_1shape\n");
+            pango_glyph_string_free(glyphString);
+            return NULL;
+        }
+        dataLength = SHAPE_HEADER_SIZE + 3 * count;
+        data = g_try_new(jint, dataLength);
+        if (!data) {
             fprintf(stderr, "OS_NATIVE error: Unable to allocate memory in pango_1shape\n");
-            goto fail;
+            pango_glyph_string_free(glyphString);
+            return NULL;
         }
+        jlong font = (jlong)analysis.font;
+        data[SHAPE_NUM_GLYPHS] = count;
+        data[SHAPE_NUM_CHARS] = item->num_chars;
+        data[SHAPE_FONT_LO] = (jint)font;
+        data[SHAPE_FONT_HI] = (jint)(font >> 32);
+        jint *glyphs = data + SHAPE_HEADER_SIZE;
+        jint *widths = glyphs + count;
+        jint *cluster = widths + count;
+        const gchar *cursor = text;
+        glong offset = 0;
         int i;
         for (i = 0; i < count; i++) {
             glyphs[i] = glyphString->glyphs[i].glyph;
             widths[i] = glyphString->glyphs[i].geometry.width;
             /* translate byte index to char index */
-            cluster[i] = (jint)g_utf8_pointer_to_offset(text, text + glyphString->log_clusters[i]);
-        }
-        (*env)->SetIntArrayRegion(env, glyphsArray, 0, count, glyphs);
-        if ((*env)->ExceptionOccurred(env)) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
+            cluster[i] = (jint)clusterToOffset(text, glyphString->log_clusters[i], &cursor, &offset);
         }
-        (*env)->SetIntArrayRegion(env, widthsArray, 0, count, widths);
-        if ((*env)->ExceptionOccurred(env)) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
+        pango_glyph_string_free(glyphString);
+
+        if (cacheable) {
+            jint *copy = copyOf(data, dataLength * sizeof(jint));
+            g_mutex_lock(&shapeCacheLock);
+            shapeCacheInsert(&key, copy, dataLength);
+            g_mutex_unlock(&shapeCacheLock);
         }
-        (*env)->SetIntArrayRegion(env, clusterArray, 0, count, cluster);
+    }
+
+    jintArray result = (*env)->NewIntArray(env, dataLength);
+    if (result) {
+        (*env)->SetIntArrayRegion(env, result, 0, dataLength, data);
         if ((*env)->ExceptionOccurred(env)) {
             fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
-        }
-        if (!PangoGlyphStringFc.cached) cachePangoGlyphStringFields(env);
-        result = (*env)->NewObject(env, PangoGlyphStringFc.clazz, PangoGlyphStringFc.init);
-        if (result) {
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.num_glyphs, count);
-            (*env)->SetObjectField(env, result, PangoGlyphStringFc.glyphs, glyphsArray);
-            (*env)->SetObjectField(env, result, PangoGlyphStringFc.widths, widthsArray);
-            (*env)->SetObjectField(env, result, PangoGlyphStringFc.log_clusters, clusterArray);
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.offset, item->offset);
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.length, item->length);
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.num_chars, item->num_chars);
-            (*env)->SetLongField(env, result, PangoGlyphStringFc.font, (jlong)analysis.font);
+            result = NULL;
         }
     }
-
-fail:
-    pango_glyph_string_free(glyphString);
-    SAFE_FREE(glyphs);
-    SAFE_FREE(widths);
-    SAFE_FREE(cluster);
+    g_free(data);
     return result;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -362,6 +362,22 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication_staticTimer_1get
     return 10000; // There are no restrictions on period in g_threads
 }
 
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkApplication
+ * Method:    _getVideoRefreshPeriod
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1getVideoRefreshPeriod
+  (JNIEnv * env, jobject obj)
+{
+    (void)env;
+    (void)obj;
+
+    // Pulse at the rate of the fastest monitor so that none of them judders
+    int rate = wrapped_gdk_display_get_max_refresh_rate(gdk_display_get_default());
+    return rate > 0 ? 1000000.0 / rate : 0.0; // rate is in millihertz
+}
+
 /*
  * Class:     com_sun_glass_ui_gtk_GtkApplication
  * Method:    staticView_getMultiClickTime
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -259,16 +259,12 @@ static void set_uri_data(GtkSelectionData *selection_data, jobject data) {
     g_free(uris);
 }
 
+// The image of the current clipboard contents, encoded for the last target
+static EncodedImage clipboard_image = { NULL, NULL };
+
 static void set_image_data(GtkSelectionData *selection_data, jobject pixels)
 {
-    GdkPixbuf *pixbuf = NULL;
-
-    mainEnv->CallVoidMethod(pixels, jPixelsAttachData, PTR_TO_JLONG(&pixbuf));
-    if (!EXCEPTION_OCCURED(mainEnv)) {
-        gtk_selection_data_set_pixbuf(selection_data, pixbuf);
-    }
-
-    g_object_unref(pixbuf);
+    set_selection_data_pixels(mainEnv, selection_data, pixels, &clipboard_image);
 }
 
 static void set_data(GdkAtom target, GtkSelectionData *selection_data, jobject data)
@@ -331,6 +327,8 @@ static void clear_data_func(GtkClipboard *clipboard, gpointer user_data)
 
     jobject data =(jobject) user_data;
     mainEnv->DeleteGlobalRef(data);
+
+    clear_encoded_image(&clipboard_image);
 }
 
 static jobject get_data_text(JNIEnv *env)
@@ -352,54 +350,17 @@ static jobject get_data_uri_list(JNIEnv *env, gboolean files)
 
 static jobject get_data_image(JNIEnv* env) {
     GdkPixbuf* pixbuf;
-    guchar *data;
-    jbyteArray data_array;
-    jobject buffer, result;
-    int w,h,stride;
+    jobject result;
 
     pixbuf = gtk_clipboard_wait_for_image(get_clipboard());
     if (pixbuf == NULL) {
         return NULL;
     }
 
-    if (!gdk_pixbuf_get_has_alpha(pixbuf)) {
-        GdkPixbuf *tmp_buf = gdk_pixbuf_add_alpha(pixbuf, FALSE, 0, 0, 0);
-        g_object_unref(pixbuf);
-        pixbuf = tmp_buf;
-    }
-    w = gdk_pixbuf_get_width(pixbuf);
-    h = gdk_pixbuf_get_height(pixbuf);
-    stride = gdk_pixbuf_get_rowstride(pixbuf);
-
-    if (stride <= 0 || h <= 0 || (h > INT_MAX / stride)) {
-        g_object_unref(pixbuf);
-        return NULL;
-    }
-
-    data = gdk_pixbuf_get_pixels(pixbuf);
-
-    //Actually, we are converting RGBA to BGRA, but that's the same operation
-    data = (guchar*) convert_BGRA_to_RGBA((int*)data, stride, h);
-    if (!data) {
-        g_object_unref(pixbuf);
-        return NULL;
-    }
-
-    data_array = env->NewByteArray(stride*h);
-    EXCEPTION_OCCURED(env);
-    env->SetByteArrayRegion(data_array, 0, stride*h, (jbyte*)data);
-    EXCEPTION_OCCURED(env);
-
-    buffer = env->CallStaticObjectMethod(jByteBufferCls, jByteBufferWrap, data_array);
-    EXCEPTION_OCCURED(env);
-    result = env->NewObject(jGtkPixelsCls, jGtkPixelsInit, w, h, buffer);
-    EXCEPTION_OCCURED(env);
-
-    g_free(data);
+    result = pixbuf_to_java_pixels(env, pixbuf);
     g_object_unref(pixbuf);
 
     return result;
-
 }
 
 static jobject get_data_raw(JNIEnv *env, const char* mime, gboolean string_data)
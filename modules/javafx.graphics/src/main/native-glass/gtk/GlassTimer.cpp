@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,11 +27,51 @@
 
 #include <glib.h>
 #include <gdk/gdk.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
 
 static gboolean call_runnable_in_timer
   (gpointer);
 
+/*
+ * A vsync timer runs the runnable on its own thread at the refresh period of
+ * the display. The deadlines are absolute, so the ticks do not drift, and the
+ * thread stays attached to the JVM while it runs. Should reading the timerfd
+ * ever fail, the thread keeps ticking at the same period with
+ * clock_nanosleep, as pulses would otherwise stop for good.
+ *
+ * The timer thread and the Java timer each hold a reference to the context,
+ * and whichever drops the last one frees it. _stopVsync can not wait for the
+ * thread, because it runs under the lock of the Timer, which the pulse
+ * runnable may need.
+ */
+typedef struct {
+    jobject runnable;
+    jlong period;
+    int timerfd;
+    gint stopped;
+    gint refs;
+    // attached is -1 until the thread knows whether it could attach
+    GMutex lock;
+    GCond started;
+    gint attached;
+} VsyncTimerContext;
+
+static gpointer run_vsync_timer
+  (gpointer);
+
+static void destroy_vsync_timer
+  (VsyncTimerContext*, JNIEnv*);
+
+static void release_vsync_timer
+  (VsyncTimerContext*, JNIEnv*);
+
 extern "C" {
 
 /*
@@ -59,10 +99,10 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1start
 
 /*
  * Class:     com_sun_glass_ui_gtk_GtkTimer
- * Method:    _stop
+ * Method:    _stopTimer
  * Signature: (J)V
  */
-JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1stop
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1stopTimer
   (JNIEnv * env, jobject obj, jlong ptr)
 {
     (void)obj;
@@ -73,6 +113,95 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1stop
     context->runnable = NULL;
 }
 
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkTimer
+ * Method:    _startVsync
+ * Signature: (Ljava/lang/Runnable;D)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1startVsync
+  (JNIEnv * env, jobject obj, jobject runnable, jdouble period)
+{
+    (void)obj;
+
+    jlong periodNanos = (jlong) (period * 1000000.0);
+    if (periodNanos <= 0) {
+        return 0L;
+    }
+
+    VsyncTimerContext* context = (VsyncTimerContext*) malloc(sizeof(VsyncTimerContext));
+    if (context == NULL) {
+        return 0L;
+    }
+    context->period = periodNanos;
+    context->stopped = 0;
+    context->refs = 2;
+    context->attached = -1;
+    context->timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if (context->timerfd == -1) {
+        free(context);
+        return 0L;
+    }
+
+    struct timespec now;
+    struct itimerspec spec;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    jlong first = (jlong) now.tv_sec * 1000000000L + now.tv_nsec + periodNanos;
+    spec.it_value.tv_sec = (time_t) (first / 1000000000L);
+    spec.it_value.tv_nsec = (long) (first % 1000000000L);
+    spec.it_interval.tv_sec = (time_t) (periodNanos / 1000000000L);
+    spec.it_interval.tv_nsec = (long) (periodNanos % 1000000000L);
+    if (timerfd_settime(context->timerfd, TFD_TIMER_ABSTIME, &spec, NULL) == -1) {
+        close(context->timerfd);
+        free(context);
+        return 0L;
+    }
+
+    context->runnable = env->NewGlobalRef(runnable);
+    g_mutex_init(&context->lock);
+    g_cond_init(&context->started);
+    GThread* thread = g_thread_try_new("GtkVsyncTimer", run_vsync_timer, context, NULL);
+    if (thread == NULL) {
+        destroy_vsync_timer(context, env);
+        return 0L;
+    }
+
+    g_mutex_lock(&context->lock);
+    while (context->attached < 0) {
+        g_cond_wait(&context->started, &context->lock);
+    }
+    gint attached = context->attached;
+    g_mutex_unlock(&context->lock);
+    if (!attached) {
+        // the thread has not used the context and is about to exit
+        g_thread_join(thread);
+        destroy_vsync_timer(context, env);
+        return 0L;
+    }
+    g_thread_unref(thread);
+    return PTR_TO_JLONG(context);
+}
+
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkTimer
+ * Method:    _stopVsync
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1stopVsync
+  (JNIEnv * env, jobject obj, jlong ptr)
+{
+    (void)obj;
+
+    VsyncTimerContext* context = (VsyncTimerContext*) JLONG_TO_PTR(ptr);
+    g_atomic_int_set(&context->stopped, 1);
+
+    // wake the thread up now rather than at the next tick
+    struct itimerspec spec = {};
+    spec.it_value.tv_nsec = 1;
+    timerfd_settime(context->timerfd, 0, &spec, NULL);
+
+    release_vsync_timer(context, env);
+}
+
 } // extern "C"
 
 
@@ -101,3 +230,92 @@ static gboolean call_runnable_in_timer
     return TRUE;
 }
 
+// Sleeps until the next multiple of the period after the last deadline,
+// skipping the ones already missed like the timerfd does
+static void sleep_until_next_tick
+  (struct timespec* deadline, jlong period)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    jlong last = (jlong) deadline->tv_sec * 1000000000L + deadline->tv_nsec;
+    jlong current = (jlong) now.tv_sec * 1000000000L + now.tv_nsec;
+    jlong next = last + period;
+    if (next <= current) {
+        next += ((current - next) / period + 1) * period;
+    }
+    deadline->tv_sec = (time_t) (next / 1000000000L);
+    deadline->tv_nsec = (long) (next % 1000000000L);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline, NULL) == EINTR) {
+    }
+}
+
+static gpointer run_vsync_timer
+  (gpointer data)
+{
+    VsyncTimerContext* context = (VsyncTimerContext*) data;
+    JNIEnv *env;
+    JavaVMAttachArgs args;
+    args.version = JNI_VERSION_1_6;
+    args.name = (char *) "GtkVsyncTimer";
+    args.group = NULL;
+    gint attached = javaVM->AttachCurrentThreadAsDaemon((void **)&env, &args) == JNI_OK;
+
+    g_mutex_lock(&context->lock);
+    context->attached = attached;
+    g_cond_signal(&context->started);
+    g_mutex_unlock(&context->lock);
+    if (!attached) {
+        // _startVsync frees the context and reports the failure
+        return NULL;
+    }
+
+    gboolean sleeping = FALSE;
+    struct timespec deadline;
+    while (!g_atomic_int_get(&context->stopped)) {
+        if (sleeping) {
+            sleep_until_next_tick(&deadline, context->period);
+        } else {
+            uint64_t expirations;
+            ssize_t n = read(context->timerfd, &expirations, sizeof(expirations));
+            if (n != sizeof(expirations)) {
+                if (n == -1 && errno == EINTR) {
+                    continue;
+                }
+                fprintf(stderr, "Glass GTK vsync timer: read failed (%s), "
+                        "continuing with clock_nanosleep\n",
+                        n == -1 ? strerror(errno) : "short read");
+                sleeping = TRUE;
+                clock_gettime(CLOCK_MONOTONIC, &deadline);
+                continue;
+            }
+        }
+        if (g_atomic_int_get(&context->stopped)) {
+            break;
+        }
+
+        env->CallVoidMethod(context->runnable, jRunnableRun, NULL);
+        LOG_EXCEPTION(env);
+    }
+
+    release_vsync_timer(context, env);
+    javaVM->DetachCurrentThread();
+    return NULL;
+}
+
+static void destroy_vsync_timer
+  (VsyncTimerContext* context, JNIEnv* env)
+{
+    env->DeleteGlobalRef(context->runnable);
+    close(context->timerfd);
+    g_cond_clear(&context->started);
+    g_mutex_clear(&context->lock);
+    free(context);
+}
+
+static void release_vsync_timer
+  (VsyncTimerContext* context, JNIEnv* env)
+{
+    if (g_atomic_int_dec_and_test(&context->refs)) {
+        destroy_vsync_timer(context, env);
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -434,51 +434,8 @@ static jobject dnd_target_get_image(JNIEnv *env)
                     (GDestroyNotify)g_free);
             buf = gdk_pixbuf_new_from_stream(stream, NULL, NULL);
             if (buf) {
-                int w;
-                int h;
-                int stride;
-                guchar *data;
-                jbyteArray data_array;
-                jobject buffer;
-
-                if (!gdk_pixbuf_get_has_alpha(buf)) {
-                    GdkPixbuf *tmp_buf = gdk_pixbuf_add_alpha(buf, FALSE, 0, 0, 0);
-                    g_object_unref(buf);
-                    buf = tmp_buf;
-                }
-
-                w = gdk_pixbuf_get_width(buf);
-                h = gdk_pixbuf_get_height(buf);
-                stride = gdk_pixbuf_get_rowstride(buf);
-
-                if (h <= 0 || stride <= 0 || h >= INT_MAX / stride) {
-                    g_object_unref(buf);
-                    g_object_unref(stream);
-                    continue;
-                }
-
-                data = gdk_pixbuf_get_pixels(buf);
-
-                //Actually, we are converting RGBA to BGRA, but that's the same operation
-                data = (guchar*) convert_BGRA_to_RGBA((int*) data, stride, h);
-                if (!data) {
-                    g_object_unref(buf);
-                    g_object_unref(stream);
-                    continue;
-                }
-
-                data_array = env->NewByteArray(stride * h);
-                EXCEPTION_OCCURED(env);
-                env->SetByteArrayRegion(data_array, 0, stride*h, (jbyte*) data);
-                EXCEPTION_OCCURED(env);
-
-                buffer = env->CallStaticObjectMethod(jByteBufferCls, jByteBufferWrap, data_array);
-                EXCEPTION_OCCURED(env);
-                result = env->NewObject(jGtkPixelsCls, jGtkPixelsInit, w, h, buffer);
-                EXCEPTION_OCCURED(env);
-
+                result = pixbuf_to_java_pixels(env, buf);
                 g_object_unref(buf);
-                g_free(data); // data from convert_BGRA_to_RGBA
             }
             g_object_unref(stream);
         }
@@ -547,6 +504,7 @@ jobject dnd_target_get_data(JNIEnv *env, jstring mime)
 static jint dnd_performed_action;
 
 const char * const SOURCE_DND_DATA = "fx-dnd-data";
+const char * const SOURCE_DND_IMAGE = "fx-dnd-image";
 
 static void dnd_set_performed_action(jint performed_action)
 {
@@ -657,6 +615,12 @@ static gboolean dnd_source_set_string(GtkWidget *widget, GtkSelectionData *data,
     return is_data_set;
 }
 
+static void free_encoded_image(gpointer data)
+{
+    clear_encoded_image((EncodedImage *) data);
+    g_free(data);
+}
+
 static gboolean dnd_source_set_image(GtkWidget *widget, GtkSelectionData *data, GdkAtom atom)
 {
     jobject pixels = dnd_source_get_data(widget, "application/x-java-rawimage");
@@ -664,21 +628,14 @@ static gboolean dnd_source_set_image(GtkWidget *widget, GtkSelectionData *data,
         return FALSE;
     }
 
-    gchar *buffer;
-    gsize size;
-    const char * type;
-    GdkPixbuf *pixbuf = NULL;
-    gboolean is_data_set;
-
-    mainEnv->CallVoidMethod(pixels, jPixelsAttachData, PTR_TO_JLONG(&pixbuf));
-
-    if (!EXCEPTION_OCCURED(mainEnv)) {
-        is_data_set = gtk_selection_data_set_pixbuf(data, pixbuf);
+    // Kept for the drag, the widget is destroyed when it ends
+    EncodedImage *image = (EncodedImage *)g_object_get_data(G_OBJECT(widget), SOURCE_DND_IMAGE);
+    if (!image) {
+        image = g_new0(EncodedImage, 1);
+        g_object_set_data_full(G_OBJECT(widget), SOURCE_DND_IMAGE, image, free_encoded_image);
     }
 
-    g_object_unref(pixbuf);
-
-    return is_data_set;
+    return set_selection_data_pixels(mainEnv, data, pixels, image);
 }
 
 static gboolean dnd_source_set_uri(GtkWidget *widget, GtkSelectionData *data, GdkAtom atom)
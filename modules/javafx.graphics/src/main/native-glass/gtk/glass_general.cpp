@@ -26,6 +26,14 @@
 
 #include <jni.h>
 #include <gtk/gtk.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define GLASS_SWAP_NEON
+#include <arm_neon.h>
+#endif
 
 char const * const GDK_WINDOW_DATA_CONTEXT = "glass_window_context";
 
@@ -406,6 +414,41 @@ glass_throw_oom(JNIEnv * env, const char * message) {
 }
 
 
+/*
+ * Converts count native-endian ARGB ints to RGBA bytes, which is the same
+ * as swapping the first and third byte of every pixel on little-endian CPUs.
+ * src and dst may be the same buffer.
+ */
+static void swap_red_blue(guint8* dst, const int* src, gsize count) {
+    gsize i = 0;
+#if defined(__SSE2__)
+    const __m128i ag = _mm_set1_epi32((int) 0xFF00FF00);
+    const __m128i b = _mm_set1_epi32(0xFF);
+    for (; i + 4 <= count; i += 4) {
+        __m128i p = _mm_loadu_si128((const __m128i*) (src + i));
+        __m128i q = _mm_or_si128(_mm_and_si128(p, ag),
+                _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p, 16), b),
+                             _mm_slli_epi32(_mm_and_si128(p, b), 16)));
+        _mm_storeu_si128((__m128i*) (dst + i * 4), q);
+    }
+#elif defined(GLASS_SWAP_NEON)
+    for (; i + 16 <= count; i += 16) {
+        uint8x16x4_t p = vld4q_u8((const uint8_t*) (src + i));
+        uint8x16_t t = p.val[0];
+        p.val[0] = p.val[2];
+        p.val[2] = t;
+        vst4q_u8(dst + i * 4, p);
+    }
+#endif
+    for (; i < count; i++) {
+        int p = src[i];
+        dst[i * 4] = (guint8)(p >> 16);
+        dst[i * 4 + 1] = (guint8)(p >> 8);
+        dst[i * 4 + 2] = (guint8)(p);
+        dst[i * 4 + 3] = (guint8)(p >> 24);
+    }
+}
+
 guint8* convert_BGRA_to_RGBA(const int* pixels, int stride, int height) {
   if (stride <= 0 || height <= 0 || (height > INT_MAX / stride)) {
     return NULL;
@@ -416,19 +459,144 @@ guint8* convert_BGRA_to_RGBA(const int* pixels, int stride, int height) {
     return NULL;
   }
 
-  int i = 0;
-
-  for (i = 0; i < height * stride; i += 4) {
-      new_pixels[i] = (guint8)(*pixels >> 16);
-      new_pixels[i + 1] = (guint8)(*pixels >> 8);
-      new_pixels[i + 2] = (guint8)(*pixels);
-      new_pixels[i + 3] = (guint8)(*pixels >> 24);
-      pixels++;
-  }
+  swap_red_blue(new_pixels, pixels, (gsize) height * stride / 4);
 
   return new_pixels;
 }
 
+jobject pixbuf_to_java_pixels(JNIEnv* env, GdkPixbuf* pixbuf) {
+    GdkPixbuf* rgba = pixbuf;
+    jobject result = NULL;
+
+    if (!gdk_pixbuf_get_has_alpha(pixbuf)) {
+        rgba = gdk_pixbuf_add_alpha(pixbuf, FALSE, 0, 0, 0);
+        if (!rgba) {
+            return NULL;
+        }
+    }
+
+    int w = gdk_pixbuf_get_width(rgba);
+    int h = gdk_pixbuf_get_height(rgba);
+    int stride = gdk_pixbuf_get_rowstride(rgba);
+
+    if (w > 0 && h > 0 && stride >= w * 4 && w <= INT_MAX / 4 / h) {
+        // Rows are swizzled straight into the Java array, packed to w * 4
+        // bytes as GtkPixels expects, without an intermediate copy
+        jbyteArray data_array = env->NewByteArray(w * 4 * h);
+        if (!EXCEPTION_OCCURED(env) && data_array) {
+            const guint8* src = gdk_pixbuf_get_pixels(rgba);
+            guint8* dst = (guint8*) env->GetPrimitiveArrayCritical(data_array, NULL);
+            if (dst) {
+                for (int y = 0; y < h; y++) {
+                    //Actually, we are converting RGBA to BGRA, but that's the same operation
+                    swap_red_blue(dst + (gsize) y * w * 4,
+                            (const int*) (src + (gsize) y * stride), w);
+                }
+                env->ReleasePrimitiveArrayCritical(data_array, dst, 0);
+
+                jobject buffer = env->CallStaticObjectMethod(jByteBufferCls, jByteBufferWrap, data_array);
+                if (!EXCEPTION_OCCURED(env)) {
+                    result = env->NewObject(jGtkPixelsCls, jGtkPixelsInit, w, h, buffer);
+                    EXCEPTION_OCCURED(env);
+                }
+            } else {
+                EXCEPTION_OCCURED(env);
+            }
+        }
+    }
+
+    if (rgba != pixbuf) {
+        g_object_unref(rgba);
+    }
+    return result;
+}
+
+void clear_encoded_image(EncodedImage* image) {
+    g_free(image->mime);
+    image->mime = NULL;
+    if (image->bytes) {
+        g_bytes_unref(image->bytes);
+        image->bytes = NULL;
+    }
+}
+
+// Returns the name of the writable gdk-pixbuf format for the mime type
+static gchar* get_writable_format(const gchar* mime) {
+    gchar* type = NULL;
+    GSList* formats = gdk_pixbuf_get_formats();
+    for (GSList* f = formats; f != NULL && type == NULL; f = f->next) {
+        GdkPixbufFormat* format = (GdkPixbufFormat*) f->data;
+        if (!gdk_pixbuf_format_is_writable(format)) {
+            continue;
+        }
+        gchar** mimes = gdk_pixbuf_format_get_mime_types(format);
+        for (gchar** m = mimes; *m != NULL; m++) {
+            if (strcmp(*m, mime) == 0) {
+                type = gdk_pixbuf_format_get_name(format);
+                break;
+            }
+        }
+        g_strfreev(mimes);
+    }
+    g_slist_free(formats);
+    return type;
+}
+
+gboolean set_selection_data_pixels(JNIEnv* env, GtkSelectionData* selection_data,
+        jobject pixels, EncodedImage* cache) {
+    GdkAtom target = gtk_selection_data_get_target(selection_data);
+    gchar* mime = gdk_atom_name(target);
+
+    if (cache->mime == NULL || strcmp(cache->mime, mime) != 0) {
+        GdkPixbuf* pixbuf = NULL;
+        env->CallVoidMethod(pixels, jPixelsAttachData, PTR_TO_JLONG(&pixbuf));
+        // GtkPixels leaves it NULL without an exception for invalid sizes
+        if (EXCEPTION_OCCURED(env) || !pixbuf) {
+            if (pixbuf) {
+                g_object_unref(pixbuf);
+            }
+            g_free(mime);
+            return FALSE;
+        }
+
+        gchar* type = get_writable_format(mime);
+        if (!type) {
+            gboolean result = gtk_selection_data_set_pixbuf(selection_data, pixbuf);
+            g_object_unref(pixbuf);
+            g_free(mime);
+            return result;
+        }
+
+        gchar* buffer = NULL;
+        gsize size = 0;
+        gboolean saved;
+        if (strcmp(type, "png") == 0) {
+            // The level gtk_selection_data_set_pixbuf uses for PNG
+            saved = gdk_pixbuf_save_to_buffer(pixbuf, &buffer, &size, type, NULL,
+                    "compression", "2", NULL);
+        } else {
+            saved = gdk_pixbuf_save_to_buffer(pixbuf, &buffer, &size, type, NULL, NULL);
+        }
+        g_free(type);
+        g_object_unref(pixbuf);
+        if (!saved) {
+            g_free(mime);
+            return FALSE;
+        }
+
+        // Targets are usually requested one at a time, mostly the same one
+        clear_encoded_image(cache);
+        cache->mime = mime;
+        cache->bytes = g_bytes_new_take(buffer, size);
+    } else {
+        g_free(mime);
+    }
+
+    gsize size;
+    const guchar* data = (const guchar*) g_bytes_get_data(cache->bytes, &size);
+    gtk_selection_data_set(selection_data, target, 8, data, (gint) size);
+    return TRUE;
+}
 
 void dump_jstring_array(JNIEnv* env, jobjectArray arr) {
     if (arr == NULL) {
@@ -278,6 +278,23 @@ private:
 
     guint8* convert_BGRA_to_RGBA(const int* pixels, int stride, int height);
 
+    // Converts an RGB or RGBA pixbuf to GtkPixels, NULL if it fails
+    jobject pixbuf_to_java_pixels(JNIEnv* env, GdkPixbuf* pixbuf);
+
+    // The last encoding of an exported image
+    typedef struct {
+        gchar* mime;
+        GBytes* bytes;
+    } EncodedImage;
+
+    void clear_encoded_image(EncodedImage* image);
+
+    // Sets the Pixels as the selection data, encoded for the requested target.
+    // Only the last encoding is kept in the cache, the pixels are converted
+    // for the encoder alone and released as soon as it is done
+    gboolean set_selection_data_pixels(JNIEnv* env, GtkSelectionData* selection_data,
+            jobject pixels, EncodedImage* cache);
+
     gboolean check_and_clear_exception(JNIEnv *env);
 
     jboolean is_display_valid();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -148,3 +148,36 @@ void wrapped_gdk_x11_display_set_window_scale (GdkDisplay *display,
     }
 }
 
+static int (*_gdk_display_get_n_monitors) (GdkDisplay *display);
+static void * (*_gdk_display_get_monitor) (GdkDisplay *display, int monitor_num);
+static int (*_gdk_monitor_get_refresh_rate) (void *monitor);
+
+// Note added in libgdk 3.22 which is > our OEL 7.0 version of 3.8
+int wrapped_gdk_display_get_max_refresh_rate (GdkDisplay *display)
+{
+    int rate = 0;
+    int i, n;
+    if (_gdk_monitor_get_refresh_rate == NULL) {
+        _gdk_display_get_n_monitors = dlsym(RTLD_DEFAULT, "gdk_display_get_n_monitors");
+        _gdk_display_get_monitor = dlsym(RTLD_DEFAULT, "gdk_display_get_monitor");
+        _gdk_monitor_get_refresh_rate = dlsym(RTLD_DEFAULT, "gdk_monitor_get_refresh_rate");
+        if (gtk_verbose && _gdk_monitor_get_refresh_rate) {
+            fprintf(stderr, "loaded gdk_monitor_get_refresh_rate\n"); fflush(stderr);
+        }
+    }
+
+    if (_gdk_display_get_n_monitors != NULL && _gdk_display_get_monitor != NULL
+            && _gdk_monitor_get_refresh_rate != NULL) {
+        n = (*_gdk_display_get_n_monitors)(display);
+        for (i = 0; i < n; i++) {
+            void *monitor = (*_gdk_display_get_monitor)(display, i);
+            if (monitor != NULL) {
+                int r = (*_gdk_monitor_get_refresh_rate)(monitor);
+                if (r > rate) {
+                    rate = r;
+                }
+            }
+        }
+    }
+    return rate;
+}
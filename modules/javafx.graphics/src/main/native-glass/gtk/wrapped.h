@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,12 @@ void wrapped_g_settings_schema_unref (GSettingsSchema *schema);
 
 void wrapped_gdk_x11_display_set_window_scale (GdkDisplay *display, gint scale);
 
+/**
+ * Returns the highest refresh rate of the monitors of the display in
+ * millihertz, or 0 if it is not known.
+ */
+int wrapped_gdk_display_get_max_refresh_rate (GdkDisplay *display);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -92,6 +92,31 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL_eglGetDisplay
     return asJLong(dpy);
 }
 
+typedef EGLDisplay (*eglGetPlatformDisplayEXT_t)(EGLenum platform,
+                                                 void *nativeDisplay,
+                                                 const EGLint *attribs);
+
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL_eglGetPlatformDisplay
+    (JNIEnv *UNUSED(env), jclass UNUSED(clazz), jint platform, jlong display) {
+    // Looked up at runtime since EGL_EXT_platform_base is a client extension
+    // that older EGL libraries do not export
+    eglGetPlatformDisplayEXT_t getPlatformDisplay = (eglGetPlatformDisplayEXT_t)
+            eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay == NULL) {
+        return asJLong(EGL_NO_DISPLAY);
+    }
+    return asJLong(getPlatformDisplay((EGLenum) platform, asPtr(display), NULL));
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_glass_ui_monocle_EGL_eglQueryString
+    (JNIEnv *env, jclass UNUSED(clazz), jlong eglDisplay, jint name) {
+    const char *value = eglQueryString(asPtr(eglDisplay), name);
+    if (value == NULL) {
+        return NULL;
+    }
+    return (*env)->NewStringUTF(env, value);
+}
+
 JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_EGL_eglInitialize
     (JNIEnv *env, jclass UNUSED(clazz), jlong eglDisplay, jintArray majorArray,
      jintArray minorArray){
@@ -169,6 +194,24 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL__1eglCreateWindowSurfa
     return asJLong(eglSurface);
 }
 
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL_eglCreatePbufferSurface
+    (JNIEnv *env, jclass UNUSED(clazz), jlong eglDisplay, jlong config,
+     jintArray attribs) {
+
+    EGLSurface eglSurface;
+    EGLint *attrArray = NULL;
+
+    if (attribs != NULL)
+        attrArray = (*env)->GetIntArrayElements(env, attribs, JNI_FALSE);
+
+    eglSurface = eglCreatePbufferSurface(asPtr(eglDisplay), asPtr(config),
+                                         attrArray);
+    if (attrArray != NULL) {
+        (*env)->ReleaseIntArrayElements(env, attribs, attrArray, JNI_ABORT);
+    }
+    return asJLong(eglSurface);
+}
+
 JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL_eglCreateContext
     (JNIEnv *UNUSED(env), jclass UNUSED(clazz), jlong eglDisplay, jlong config,
       jlong UNUSED(shareContext), jintArray UNUSED(attribs)){
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <GLES2/gl2.h>
+#include <GLES2/gl2ext.h>
+
+#include "com_sun_glass_ui_monocle_HeadlessEGLAcceleratedScreen.h"
+#include "Monocle.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Frames are read back on the render thread only
+static GLubyte *readBuffer;
+static size_t readBufferSize;
+static int readFormat;
+
+// Reads BGRA directly when GL_EXT_read_format_bgra is supported
+static GLenum getReadFormat() {
+    if (readFormat == 0) {
+        const char *extensions = (const char *) glGetString(GL_EXTENSIONS);
+        readFormat = extensions != NULL &&
+                strstr(extensions, "GL_EXT_read_format_bgra") != NULL ?
+                GL_BGRA_EXT : GL_RGBA;
+    }
+    return (GLenum) readFormat;
+}
+
+/*
+ * Copies the default framebuffer of the current context into pixels as
+ * premultiplied BGRA, top row first, the layout of HeadlessScreen.
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_HeadlessEGLAcceleratedScreen__1readPixels
+    (JNIEnv *env, jobject UNUSED(obj), jbyteArray pixels, jint width, jint height) {
+    if (width <= 0 || height <= 0 ||
+            (jlong) width * height * 4 > (*env)->GetArrayLength(env, pixels)) {
+        return JNI_FALSE;
+    }
+    size_t stride = (size_t) width * 4;
+    if (readBufferSize < stride * height) {
+        free(readBuffer);
+        readBuffer = (GLubyte *) malloc(stride * height);
+        readBufferSize = readBuffer != NULL ? stride * height : 0;
+        if (readBuffer == NULL) {
+            return JNI_FALSE;
+        }
+    }
+
+    GLint fbo = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &fbo);
+    if (fbo != 0) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+    GLenum format = getReadFormat();
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, width, height, format, GL_UNSIGNED_BYTE, readBuffer);
+    GLenum err = glGetError();
+    if (fbo != 0) {
+        glBindFramebuffer(GL_FRAMEBUFFER, (GLuint) fbo);
+    }
+    if (err != GL_NO_ERROR) {
+        return JNI_FALSE;
+    }
+
+    jbyte *dst = (jbyte *) (*env)->GetPrimitiveArrayCritical(env, pixels, NULL);
+    if (dst == NULL) {
+        return JNI_FALSE;
+    }
+    // GL rows go bottom up
+    for (jint y = 0; y < height; y++) {
+        const GLubyte *s = readBuffer + (size_t) (height - 1 - y) * stride;
+        jbyte *d = dst + (size_t) y * stride;
+        if (format == GL_BGRA_EXT) {
+            memcpy(d, s, stride);
+            continue;
+        }
+        for (jint x = 0; x < width; x++, s += 4, d += 4) {
+            d[0] = (jbyte) s[2];
+            d[1] = (jbyte) s[1];
+            d[2] = (jbyte) s[0];
+            d[3] = (jbyte) s[3];
+        }
+    }
+    (*env)->ReleasePrimitiveArrayCritical(env, pixels, dst, 0);
+    return JNI_TRUE;
+}
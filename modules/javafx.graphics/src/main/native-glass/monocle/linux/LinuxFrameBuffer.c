@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "com_sun_glass_ui_monocle_LinuxFrameBuffer.h"
+#include "Monocle.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/**
+ * Converts n pixels of 32-bit xRGB to RGB565 by truncating each component,
+ * the same conversion as Framebuffer.write().
+ */
+static void convertToRGB565(uint16_t *dst, const uint32_t *src, jint n) {
+    jint i = 0;
+#if defined(__SSE2__)
+    const __m128i maskR = _mm_set1_epi32(0xf800);
+    const __m128i maskG = _mm_set1_epi32(0x07e0);
+    const __m128i maskB = _mm_set1_epi32(0x001f);
+    for (; i + 8 <= n; i += 8) {
+        __m128i p0 = _mm_loadu_si128((const __m128i *) (src + i));
+        __m128i p1 = _mm_loadu_si128((const __m128i *) (src + i + 4));
+        __m128i q0 = _mm_or_si128(
+                _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p0, 8), maskR),
+                             _mm_and_si128(_mm_srli_epi32(p0, 5), maskG)),
+                _mm_and_si128(_mm_srli_epi32(p0, 3), maskB));
+        __m128i q1 = _mm_or_si128(
+                _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p1, 8), maskR),
+                             _mm_and_si128(_mm_srli_epi32(p1, 5), maskG)),
+                _mm_and_si128(_mm_srli_epi32(p1, 3), maskB));
+        // Sign extend the low halves so that the saturating pack keeps them
+        q0 = _mm_srai_epi32(_mm_slli_epi32(q0, 16), 16);
+        q1 = _mm_srai_epi32(_mm_slli_epi32(q1, 16), 16);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_packs_epi32(q0, q1));
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 8 <= n; i += 8) {
+        // Little endian xRGB pixels are stored as B, G, R, x bytes
+        uint8x8x4_t p = vld4_u8((const uint8_t *) (src + i));
+        uint16x8_t q = vshll_n_u8(p.val[2], 8);
+        q = vsriq_n_u16(q, vshll_n_u8(p.val[1], 8), 5);
+        q = vsriq_n_u16(q, vshll_n_u8(p.val[0], 8), 11);
+        vst1q_u16(dst + i, q);
+    }
+#endif
+    for (; i < n; i++) {
+        uint32_t p = src[i];
+        dst[i] = (uint16_t) (((p >> 8) & 0xf800) | ((p >> 5) & 0x07e0)
+                             | ((p >> 3) & 0x001f));
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_LinuxFrameBuffer__1copyRows
+  (JNIEnv *env, jclass UNUSED(cls), jlong srcAddr, jint width, jint height,
+   jlong dstAddr, jint dstStride, jint dstDepth,
+   jintArray startsArray, jintArray endsArray) {
+    const uint32_t *src = (const uint32_t *) asPtr(srcAddr);
+    uint8_t *dst = (uint8_t *) asPtr(dstAddr);
+    jint *starts = (*env)->GetPrimitiveArrayCritical(env, startsArray, NULL);
+    jint *ends;
+    jint y;
+    if (starts == NULL) {
+        return;
+    }
+    ends = (*env)->GetPrimitiveArrayCritical(env, endsArray, NULL);
+    if (ends == NULL) {
+        (*env)->ReleasePrimitiveArrayCritical(env, startsArray, starts, JNI_ABORT);
+        return;
+    }
+    for (y = 0; y < height; y++) {
+        jint start = starts[y] < 0 ? 0 : starts[y];
+        jint end = ends[y] > width ? width : ends[y];
+        const uint32_t *srcRow = src + (size_t) y * width;
+        uint8_t *dstRow = dst + (size_t) y * dstStride;
+        if (start >= end) {
+            continue;
+        }
+        if (dstDepth == 16) {
+            convertToRGB565((uint16_t *) dstRow + start, srcRow + start,
+                            end - start);
+        } else {
+            memcpy((uint32_t *) dstRow + start, srcRow + start,
+                   (size_t) (end - start) * 4);
+        }
+    }
+    (*env)->ReleasePrimitiveArrayCritical(env, endsArray, ends, JNI_ABORT);
+    (*env)->ReleasePrimitiveArrayCritical(env, startsArray, starts, JNI_ABORT);
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "com_sun_glass_ui_monocle_LinuxInputMultiplexer.h"
+#include "Monocle.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+/** The number of ready devices handled per call to epoll_wait */
+#define MAX_READY_DEVICES 32
+
+/**
+ * Each record written by _readEvents starts with the id of the device and
+ * the number of event bytes that follow, or -1 if the device was dropped.
+ */
+#define RECORD_HEADER_SIZE 8
+
+static void monocle_IOException(JNIEnv *env, const char *msg) {
+    char msgBuffer[1024];
+    snprintf(msgBuffer, sizeof(msgBuffer),
+            "%s (errno=%i, %s)", msg, errno, strerror(errno));
+    jclass cls = (*env)->FindClass(env, "java/io/IOException");
+    if (cls) {
+        (*env)->ThrowNew(env, cls, msgBuffer);
+    } else {
+        fprintf(stderr, "IOException: %s", msgBuffer);
+        exit(1);
+    }
+}
+
+static void putRecordHeader(char *record, jint id, jint length) {
+    memcpy(record, &id, sizeof(jint));
+    memcpy(record + sizeof(jint), &length, sizeof(jint));
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_sun_glass_ui_monocle_LinuxInputMultiplexer__1open
+(JNIEnv *env, jobject UNUSED(obj)) {
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epfd == -1) {
+        monocle_IOException(env, "Cannot create epoll instance");
+        return 0l;
+    }
+    return (jlong) epfd;
+}
+
+JNIEXPORT void JNICALL
+Java_com_sun_glass_ui_monocle_LinuxInputMultiplexer__1addDevice
+(JNIEnv *env, jobject UNUSED(obj), jlong epfdL, jlong fdL, jint id) {
+    int epfd = (int) epfdL;
+    int fd = (int) fdL;
+    struct epoll_event event;
+    int flags;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.u64 = ((uint64_t) (uint32_t) id << 32) | (uint32_t) fd;
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &event) == -1) {
+        monocle_IOException(env, "Cannot add input device to epoll instance");
+        return;
+    }
+    // Ready devices are drained until read() returns EAGAIN
+    flags = fcntl(fd, F_GETFL);
+    if (flags == -1 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1) {
+        int error = errno;
+        epoll_ctl(epfd, EPOLL_CTL_DEL, fd, &event);
+        errno = error;
+        monocle_IOException(env, "Cannot make input device non-blocking");
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_sun_glass_ui_monocle_LinuxInputMultiplexer__1removeDevice
+(JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong epfdL, jlong fdL) {
+    struct epoll_event event;
+    // Kernels before 2.6.9 require a non-NULL event for EPOLL_CTL_DEL
+    epoll_ctl((int) epfdL, EPOLL_CTL_DEL, (int) fdL, &event);
+}
+
+/**
+ * Waits until at least one device has input and reads everything that is
+ * pending on all ready devices into the buffer, using one read() per device
+ * for as long as the buffer has room. Records are written as
+ * [id][byte count][raw input_event structs]. Devices that report an error
+ * or hang up are removed from the epoll set and recorded with a byte count
+ * of -1. Returns the number of bytes written.
+ */
+JNIEXPORT jint JNICALL
+Java_com_sun_glass_ui_monocle_LinuxInputMultiplexer__1readEvents
+(JNIEnv *env, jobject UNUSED(obj), jlong epfdL, jobject bufferObj,
+        jint eventSize) {
+    int epfd = (int) epfdL;
+    char *buffer = (char *) (*env)->GetDirectBufferAddress(env, bufferObj);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, bufferObj);
+    struct epoll_event ready[MAX_READY_DEVICES];
+    jlong offset = 0;
+    int count;
+    int i;
+    if (buffer == NULL || eventSize <= 0
+            || capacity < RECORD_HEADER_SIZE + eventSize) {
+        errno = EINVAL;
+        monocle_IOException(env, "Invalid buffer");
+        return 0;
+    }
+    do {
+        count = epoll_wait(epfd, ready, MAX_READY_DEVICES, -1);
+    } while (count == -1 && errno == EINTR);
+    if (count == -1) {
+        monocle_IOException(env, "Error waiting for input events");
+        return 0;
+    }
+    for (i = 0; i < count; i++) {
+        int fd = (int) (uint32_t) ready[i].data.u64;
+        jint id = (jint) (ready[i].data.u64 >> 32);
+        char *record = buffer + offset;
+        jlong length = 0;
+        jboolean dropped = JNI_FALSE;
+        if (capacity - offset < RECORD_HEADER_SIZE + eventSize) {
+            // Level-triggered, so the rest is reported again by the next wait
+            break;
+        }
+        while (1) {
+            jlong space = capacity - offset - RECORD_HEADER_SIZE - length;
+            ssize_t bytesRead;
+            space -= space % eventSize;
+            if (space == 0) {
+                break;
+            }
+            bytesRead = read(fd, record + RECORD_HEADER_SIZE + length,
+                             (size_t) space);
+            if (bytesRead > 0) {
+                length += bytesRead;
+            } else if (bytesRead == -1 && errno == EINTR) {
+                continue;
+            } else {
+                if (bytesRead == 0
+                        || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                    dropped = JNI_TRUE;
+                }
+                break;
+            }
+        }
+        if (!dropped && length == 0
+                && (ready[i].events & (EPOLLERR | EPOLLHUP))) {
+            dropped = JNI_TRUE;
+        }
+        if (length > 0) {
+            putRecordHeader(record, id, (jint) length);
+            offset += RECORD_HEADER_SIZE + length;
+        }
+        if (dropped && capacity - offset >= RECORD_HEADER_SIZE) {
+            struct epoll_event event;
+            epoll_ctl(epfd, EPOLL_CTL_DEL, fd, &event);
+            putRecordHeader(buffer + offset, id, -1);
+            offset += RECORD_HEADER_SIZE;
+        }
+    }
+    return (jint) offset;
+}
+
+JNIEXPORT void JNICALL
+Java_com_sun_glass_ui_monocle_LinuxInputMultiplexer__1close
+(JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong epfdL) {
+    close((int) epfdL);
+}
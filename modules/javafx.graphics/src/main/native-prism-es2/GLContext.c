@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,12 @@
 
 #include "PrismES2Defs.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 extern char *strJavaToC(JNIEnv *env, jstring str);
 
 void printGLError(GLenum errCode) {
@@ -63,6 +69,224 @@ void printGLError(GLenum errCode) {
     }
 }
 
+/*
+ * Redundant state change elimination
+ *
+ * Bindings and other per context state are shadowed in ContextInfo.state.
+ * Texture parameters and uniform values are state of the texture and
+ * program objects, which all Prism contexts share, so they are cached here
+ * by object name. Creating or deleting a texture or program invalidates its
+ * entries and bumps objectGeneration, which makes every context forget its
+ * bindings since the names may have been reused. This is only used from
+ * the render thread.
+ */
+
+/* Keep in sync with STATE_COUNTER_NAMES in GLContext.java */
+enum {
+    STATE_ACTIVE_TEXTURE,
+    STATE_BIND_TEXTURE,
+    STATE_USE_PROGRAM,
+    STATE_BLEND_FUNC,
+    STATE_SCISSOR,
+    STATE_TEX_PARAMETER,
+    STATE_UNIFORM,
+    NUM_STATE_COUNTERS
+};
+
+static jlong stateIssued[NUM_STATE_COUNTERS];
+static jlong stateSkipped[NUM_STATE_COUNTERS];
+static GLuint objectGeneration = 0;
+
+/* Counts a state change and returns whether it can be skipped */
+static jboolean countState(int counter, jboolean redundant) {
+    if (redundant) {
+        stateSkipped[counter]++;
+    } else {
+        stateIssued[counter]++;
+    }
+    return redundant;
+}
+
+#define NUM_CACHED_TEXTURES 256
+
+typedef struct {
+    GLuint texID;
+    GLint filter;   /* 0 if not known */
+    GLint wrap;     /* 0 if not known */
+} TextureParams;
+
+static TextureParams textureParams[NUM_CACHED_TEXTURES];
+
+static TextureParams *getTextureParams(GLuint texID) {
+    TextureParams *params = &textureParams[texID % NUM_CACHED_TEXTURES];
+    if (params->texID != texID) {
+        params->texID = texID;
+        params->filter = 0;
+        params->wrap = 0;
+    }
+    return params;
+}
+
+static void forgetTexture(GLuint texID) {
+    TextureParams *params = &textureParams[texID % NUM_CACHED_TEXTURES];
+    if (params->texID == texID) {
+        params->filter = 0;
+        params->wrap = 0;
+    }
+    objectGeneration++;
+}
+
+#define NUM_CACHED_PROGRAMS 64
+#define NUM_CACHED_UNIFORMS 32
+#define NUM_CACHED_MATRICES 2
+#define UNIFORM_INT 8
+
+typedef struct {
+    GLuint program;
+    unsigned int valid; /* one bit per uniform location */
+    GLubyte kinds[NUM_CACHED_UNIFORMS]; /* components, or'ed with UNIFORM_INT */
+    GLint values[NUM_CACHED_UNIFORMS][4];
+    GLint matrixLocations[NUM_CACHED_MATRICES];
+    GLfloat matrices[NUM_CACHED_MATRICES][16];
+} UniformValues;
+
+static UniformValues uniformValues[NUM_CACHED_PROGRAMS];
+
+static void forgetProgram(GLuint program) {
+    UniformValues *values = &uniformValues[program % NUM_CACHED_PROGRAMS];
+    if (values->program == program) {
+        values->program = 0;
+    }
+    objectGeneration++;
+}
+
+static void validateBindings(ContextInfo *ctxInfo) {
+    int i;
+    if (ctxInfo->state.objectGeneration == objectGeneration) {
+        return;
+    }
+    ctxInfo->state.objectGeneration = objectGeneration;
+    for (i = 0; i < NUM_CACHED_TEXTURE_UNITS; i++) {
+        ctxInfo->state.boundTextures[i] = UNKNOWN_BINDING;
+    }
+    ctxInfo->state.program = UNKNOWN_BINDING;
+}
+
+/* Returns the cached uniforms of the current program, or NULL */
+static UniformValues *getUniformValues(ContextInfo *ctxInfo) {
+    GLuint program;
+    UniformValues *values;
+    validateBindings(ctxInfo);
+    program = ctxInfo->state.program;
+    if ((program == 0) || (program == UNKNOWN_BINDING)) {
+        return NULL;
+    }
+    values = &uniformValues[program % NUM_CACHED_PROGRAMS];
+    if (values->program != program) {
+        values->program = program;
+        values->valid = 0;
+        values->matrixLocations[0] = -1;
+        values->matrixLocations[1] = -1;
+    }
+    return values;
+}
+
+/*
+ * Returns whether the uniform at the location of the current program
+ * already holds the given values, and records them otherwise.
+ */
+static jboolean isUniformRedundant(ContextInfo *ctxInfo, GLint location,
+        GLubyte kind, const GLint *v) {
+    UniformValues *values = getUniformValues(ctxInfo);
+    size_t size = (kind & ~UNIFORM_INT) * sizeof(GLint);
+    unsigned int bit;
+    if ((values == NULL) || (location < 0) || (location >= NUM_CACHED_UNIFORMS)) {
+        return countState(STATE_UNIFORM, JNI_FALSE);
+    }
+    bit = 1u << location;
+    if ((values->valid & bit) && (values->kinds[location] == kind)
+            && (memcmp(values->values[location], v, size) == 0)) {
+        return countState(STATE_UNIFORM, JNI_TRUE);
+    }
+    memcpy(values->values[location], v, size);
+    values->kinds[location] = kind;
+    values->valid |= bit;
+    return countState(STATE_UNIFORM, JNI_FALSE);
+}
+
+/* Floats are compared by their bits, so -0.0 and 0.0 count as different */
+static jboolean isUniformfRedundant(ContextInfo *ctxInfo, GLint location,
+        GLubyte count, const GLfloat *v) {
+    GLint bits[4];
+    memcpy(bits, v, count * sizeof(GLfloat));
+    return isUniformRedundant(ctxInfo, location, count, bits);
+}
+
+/* Forgets the values of the elements of a uniform array */
+static void forgetUniforms(ContextInfo *ctxInfo, GLint location, GLsizei count) {
+    UniformValues *values = getUniformValues(ctxInfo);
+    GLint i;
+    countState(STATE_UNIFORM, JNI_FALSE);
+    if ((values == NULL) || (location < 0)) {
+        return;
+    }
+    for (i = location; (i < location + count) && (i < NUM_CACHED_UNIFORMS); i++) {
+        values->valid &= ~(1u << i);
+    }
+}
+
+/* Transposed matrices are not cached */
+static jboolean isUniformMatrixRedundant(ContextInfo *ctxInfo, GLint location,
+        jboolean transpose, const GLfloat *m) {
+    UniformValues *values = getUniformValues(ctxInfo);
+    int i, slot = NUM_CACHED_MATRICES - 1;
+    if ((values == NULL) || (location < 0)) {
+        return countState(STATE_UNIFORM, JNI_FALSE);
+    }
+    if (transpose || (m == NULL)) {
+        for (i = 0; i < NUM_CACHED_MATRICES; i++) {
+            if (values->matrixLocations[i] == location) {
+                values->matrixLocations[i] = -1;
+            }
+        }
+        return countState(STATE_UNIFORM, JNI_FALSE);
+    }
+    for (i = 0; i < NUM_CACHED_MATRICES; i++) {
+        if (values->matrixLocations[i] == location) {
+            if (memcmp(values->matrices[i], m, sizeof(values->matrices[i])) == 0) {
+                return countState(STATE_UNIFORM, JNI_TRUE);
+            }
+            slot = i;
+            break;
+        }
+        if (values->matrixLocations[i] < 0) {
+            slot = i;
+            break;
+        }
+    }
+    values->matrixLocations[slot] = location;
+    memcpy(values->matrices[slot], m, sizeof(values->matrices[slot]));
+    return countState(STATE_UNIFORM, JNI_FALSE);
+}
+
+static void blendFunc(ContextInfo *ctxInfo, GLenum src, GLenum dst) {
+    if (countState(STATE_BLEND_FUNC,
+            (ctxInfo->state.blendSrc == src) && (ctxInfo->state.blendDst == dst))) {
+        return;
+    }
+    glBlendFunc(src, dst);
+    ctxInfo->state.blendSrc = src;
+    ctxInfo->state.blendDst = dst;
+}
+
+/* Records a texture bound to the active texture unit outside of nBindTexture */
+static void textureBound(ContextInfo *ctxInfo, GLuint texID) {
+    validateBindings(ctxInfo);
+    if (ctxInfo->state.activeTexture < NUM_CACHED_TEXTURE_UNITS) {
+        ctxInfo->state.boundTextures[ctxInfo->state.activeTexture] = texID;
+    }
+}
+
 void initializeCtxInfo(ContextInfo *ctxInfo) {
     if (ctxInfo == NULL) {
         return;
@@ -117,12 +341,24 @@ void deleteCtxInfo(ContextInfo *ctxInfo) {
 }
 
 void initState(ContextInfo *ctxInfo) {
+    int i;
     if (ctxInfo == NULL) {
         return;
     }
 
     glEnable(GL_BLEND);
     glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    ctxInfo->state.blendSrc = GL_ONE;
+    ctxInfo->state.blendDst = GL_ONE_MINUS_SRC_ALPHA;
+
+    // a new context has texture unit 0 active and nothing bound
+    ctxInfo->state.objectGeneration = objectGeneration;
+    ctxInfo->state.activeTexture = 0;
+    for (i = 0; i < NUM_CACHED_TEXTURE_UNITS; i++) {
+        ctxInfo->state.boundTextures[i] = 0;
+    }
+    ctxInfo->state.program = 0;
+    ctxInfo->state.scissorBox[2] = -1;
 
     // initialize states and properties to
     // match cached states and properties
@@ -221,7 +457,11 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nActiveTexture
     if ((ctxInfo == NULL) || (ctxInfo->glActiveTexture == NULL)) {
         return;
     }
+    if (countState(STATE_ACTIVE_TEXTURE, ctxInfo->state.activeTexture == (GLuint) texUnit)) {
+        return;
+    }
     ctxInfo->glActiveTexture(GL_TEXTURE0 + texUnit);
+    ctxInfo->state.activeTexture = (GLuint) texUnit;
 }
 
 /*
@@ -242,6 +482,22 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nBindFBO
  */
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nBindTexture
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texID) {
+    GLuint unit;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if (ctxInfo == NULL) {
+        return;
+    }
+    validateBindings(ctxInfo);
+    unit = ctxInfo->state.activeTexture;
+    if (unit < NUM_CACHED_TEXTURE_UNITS) {
+        if (countState(STATE_BIND_TEXTURE,
+                ctxInfo->state.boundTextures[unit] == (GLuint) texID)) {
+            return;
+        }
+        ctxInfo->state.boundTextures[unit] = (GLuint) texID;
+    } else {
+        countState(STATE_BIND_TEXTURE, JNI_FALSE);
+    }
     glBindTexture(GL_TEXTURE_2D, texID);
 }
 
@@ -286,11 +542,15 @@ GLenum translateScaleFactor(jint scaleFactor) {
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nBlendFunc
- * Signature: (II)V
+ * Signature: (JII)V
  */
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nBlendFunc
-(JNIEnv *env, jclass class, jint sFactor, jint dFactor) {
-    glBlendFunc(translateScaleFactor(sFactor), translateScaleFactor(dFactor));
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint sFactor, jint dFactor) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if (ctxInfo == NULL) {
+        return;
+    }
+    blendFunc(ctxInfo, translateScaleFactor(sFactor), translateScaleFactor(dFactor));
 }
 
 /*
@@ -575,6 +835,12 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgram
         free(attrNameString);
     }
 
+    // ask for a retrievable binary if it is going to be cached
+    if (ctxInfo->retrieveProgramBinary) {
+        ctxInfo->glProgramParameteri(shaderProgram,
+                GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     // link the program
     ctxInfo->glLinkProgram(shaderProgram);
     ctxInfo->glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
@@ -604,6 +870,7 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgram
 
     (*env)->ReleaseIntArrayElements(env, fragIDArr, fragIDs, JNI_ABORT);
 
+    forgetProgram(shaderProgram);
     return shaderProgram;
 }
 
@@ -665,6 +932,112 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCompileShader
     return shaderID;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nInitProgramBinaries
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nInitProgramBinaries
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
+    GLint numFormats = 0;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glGetProgramBinary == NULL)
+            || (ctxInfo->glProgramBinary == NULL)
+            || (ctxInfo->glProgramParameteri == NULL)
+            || (ctxInfo->versionStr == NULL) || (ctxInfo->glExtensionStr == NULL)) {
+        return JNI_FALSE;
+    }
+    /* Core in OpenGL ES 3.0 and OpenGL 4.1 */
+    if (strncmp(ctxInfo->versionStr, "OpenGL ES ", 10) == 0) {
+        if (atoi(ctxInfo->versionStr + 10) < 3) {
+            return JNI_FALSE;
+        }
+    } else if (!isExtensionSupported(ctxInfo->glExtensionStr, "GL_ARB_get_program_binary")) {
+        return JNI_FALSE;
+    }
+    /* Drivers may support the entry points but no binary format */
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    ctxInfo->retrieveProgramBinary = numFormats > 0 ? JNI_TRUE : JNI_FALSE;
+    return ctxInfo->retrieveProgramBinary;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetProgramBinary
+ * Signature: (JI[I)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_com_sun_prism_es2_GLContext_nGetProgramBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint programID, jintArray formatArr) {
+    GLint length = 0;
+    GLsizei written = 0;
+    GLenum binaryFormat = 0;
+    jint format;
+    void *binary;
+    jbyteArray result = NULL;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || !ctxInfo->retrieveProgramBinary || (formatArr == NULL)
+            || ((*env)->GetArrayLength(env, formatArr) < 1)) {
+        return NULL;
+    }
+
+    ctxInfo->glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return NULL;
+    }
+    binary = malloc(length);
+    if (binary == NULL) {
+        return NULL;
+    }
+    ctxInfo->glGetProgramBinary(programID, length, &written, &binaryFormat, binary);
+    if (written > 0) {
+        result = (*env)->NewByteArray(env, written);
+        if (result != NULL) {
+            (*env)->SetByteArrayRegion(env, result, 0, written, (jbyte *) binary);
+            format = (jint) binaryFormat;
+            (*env)->SetIntArrayRegion(env, formatArr, 0, 1, &format);
+        }
+    }
+    free(binary);
+    return result;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCreateProgramFromBinary
+ * Signature: (JI[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgramFromBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint binaryFormat, jbyteArray binaryArr) {
+    GLuint shaderProgram;
+    GLint success = GL_FALSE;
+    jsize length;
+    jbyte *binary;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || !ctxInfo->retrieveProgramBinary || (binaryArr == NULL)) {
+        return 0;
+    }
+
+    length = (*env)->GetArrayLength(env, binaryArr);
+    binary = (*env)->GetByteArrayElements(env, binaryArr, NULL);
+    if (binary == NULL) {
+        return 0;
+    }
+    shaderProgram = ctxInfo->glCreateProgram();
+    ctxInfo->glProgramBinary(shaderProgram, (GLenum) binaryFormat, binary, length);
+    (*env)->ReleaseByteArrayElements(env, binaryArr, binary, JNI_ABORT);
+
+    // The driver rejects binaries of other drivers or driver versions
+    ctxInfo->glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if (success == GL_FALSE) {
+        ctxInfo->glDeleteProgram(shaderProgram);
+        // clear GL_INVALID_ENUM for an unknown format
+        glGetError();
+        return 0;
+    }
+    forgetProgram(shaderProgram);
+    return shaderProgram;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCreateTexture
@@ -686,7 +1059,9 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateTexture
         return (jint) texID;
     }
 
+    forgetTexture(texID);
     glBindTexture(GL_TEXTURE_2D, texID);
+    textureBound(ctxInfo, texID);
 
     // Reset Error
     glGetError();
@@ -746,6 +1121,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDisposeShaders
     (*env)->ReleaseIntArrayElements(env, fragIDArr, fragIDs, JNI_ABORT);
 
     ctxInfo->glDeleteProgram(shaderProgram);
+    forgetProgram(shaderProgram);
 }
 
 /*
@@ -806,6 +1182,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDeleteTexture
     GLuint tID = (GLuint) texID;
     if (tID != 0) {
         glDeleteTextures(1, &tID);
+        forgetTexture(tID);
     }
 }
 
@@ -828,6 +1205,8 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nGenAndBindTexture
 (JNIEnv *env, jclass class) {
     GLuint texID;
     glGenTextures(1, &texID);
+    // forgets the bindings, which this function has no context to update
+    forgetTexture(texID);
     glBindTexture(GL_TEXTURE_2D, texID);
     return texID;
 }
@@ -1001,6 +1380,38 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nPixelStorei
     glPixelStorei((GLenum) translatePixelStore(pname), (GLint) value);
 }
 
+/*
+ * Swaps the red and blue components of count RGBA pixels, src and dst may
+ * be the same.
+ */
+static void swizzleRGBAtoBGRA(const GLubyte *src, GLubyte *dst, size_t count) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i ga = _mm_set1_epi32(0xff00ff00);
+    for (; i + 4 <= count; i += 4) {
+        __m128i p = _mm_loadu_si128((const __m128i *) (src + i * 4));
+        __m128i rb = _mm_andnot_si128(ga, p);
+        rb = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+        _mm_storeu_si128((__m128i *) (dst + i * 4), _mm_or_si128(_mm_and_si128(p, ga), rb));
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    for (; i + 16 <= count; i += 16) {
+        uint8x16x4_t p = vld4q_u8(src + i * 4);
+        uint8x16_t r = p.val[0];
+        p.val[0] = p.val[2];
+        p.val[2] = r;
+        vst4q_u8(dst + i * 4, p);
+    }
+#endif
+    for (; i < count; i++) {
+        GLubyte r = src[i * 4];
+        dst[i * 4 + 3] = src[i * 4 + 3];
+        dst[i * 4 + 1] = src[i * 4 + 1];
+        dst[i * 4] = src[i * 4 + 2];
+        dst[i * 4 + 2] = r;
+    }
+}
+
 jboolean doReadPixels(JNIEnv *env, jlong nativeCtxInfo, jint length, jobject buffer,
         jarray pixelArr, jint x, jint y, jint width, jint height) {
     GLvoid *ptr = NULL;
@@ -1037,18 +1448,9 @@ jboolean doReadPixels(JNIEnv *env, jlong nativeCtxInfo, jint length, jobject buf
         glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
                     GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, ptr);
     } else {
-        jint i;
-        GLubyte* c = (GLubyte*) ptr;
-        GLubyte temp;
         glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
                 GL_RGBA, GL_UNSIGNED_BYTE, ptr);
-
-        for (i = 0; i < width * height; i++) {
-            temp = c[0];
-            c[0] = c[2];
-            c[2] = temp;
-            c += 4;
-        }
+        swizzleRGBAtoBGRA((GLubyte *) ptr, (GLubyte *) ptr, (size_t) width * height);
     }
 
     if (pixelArr != NULL) {
@@ -1079,6 +1481,215 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nReadPixelsInt
     return doReadPixels(env, nativeCtxInfo, length, buffer, pixelArr, x, y, w, h);
 }
 
+/*
+ * Returns the version of the context as major * 10 + minor, or 0 if it
+ * cannot be parsed, and whether it is an OpenGL ES context.
+ */
+static int getGLVersion(ContextInfo *ctxInfo, jboolean *es) {
+    int major = 0, minor = 0;
+    const char *version = ctxInfo->versionStr;
+    *es = JNI_FALSE;
+    if (version == NULL) {
+        return 0;
+    }
+    if (strncmp(version, "OpenGL ES ", 10) == 0) {
+        *es = JNI_TRUE;
+        version += 10;
+    }
+    if (sscanf(version, "%d.%d", &major, &minor) < 1) {
+        return 0;
+    }
+    return major * 10 + minor;
+}
+
+/* Returns whether buffers can be mapped with glMapBufferRange and fenced */
+static jboolean isMapBufferRangeSupported(ContextInfo *ctxInfo) {
+    jboolean es;
+    int version;
+    if ((ctxInfo->glMapBufferRange == NULL) || (ctxInfo->glUnmapBuffer == NULL) ||
+            (ctxInfo->glFenceSync == NULL) || (ctxInfo->glClientWaitSync == NULL) ||
+            (ctxInfo->glDeleteSync == NULL) || (ctxInfo->glExtensionStr == NULL)) {
+        return JNI_FALSE;
+    }
+    /* Both are core in OpenGL ES 3.0 and OpenGL 3.2 */
+    version = getGLVersion(ctxInfo, &es);
+    if (version >= (es ? 30 : 32)) {
+        return JNI_TRUE;
+    }
+    return !es && isExtensionSupported(ctxInfo->glExtensionStr, "GL_ARB_sync") &&
+            isExtensionSupported(ctxInfo->glExtensionStr, "GL_ARB_map_buffer_range") ?
+            JNI_TRUE : JNI_FALSE;
+}
+
+/* A readback into a pixel buffer object the GPU completes asynchronously */
+typedef struct {
+    GLuint buffer;
+    GLsync fence;
+    GLsizeiptr size;
+    jboolean swizzle;
+} PendingReadback;
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nIsAsyncReadbackSupported
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nIsAsyncReadbackSupported
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glGenBuffers == NULL) ||
+            (ctxInfo->glBindBuffer == NULL) || (ctxInfo->glBufferData == NULL) ||
+            (ctxInfo->glDeleteBuffers == NULL)) {
+        return JNI_FALSE;
+    }
+    return isMapBufferRangeSupported(ctxInfo);
+}
+
+static void deletePendingReadback(ContextInfo *ctxInfo, PendingReadback *readback) {
+    if (readback->fence != NULL) {
+        ctxInfo->glDeleteSync(readback->fence);
+    }
+    if (readback->buffer != 0) {
+        ctxInfo->glDeleteBuffers(1, &readback->buffer);
+    }
+    free(readback);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nReadPixelsAsync
+ * Signature: (JIIII)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nReadPixelsAsync
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint x, jint y, jint width, jint height) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glFenceSync == NULL) ||
+            width <= 0 || height <= 0) {
+        return 0;
+    }
+
+    PendingReadback *readback = calloc(1, sizeof(PendingReadback));
+    if (readback == NULL) {
+        return 0;
+    }
+    readback->size = (GLsizeiptr) width * height * 4;
+    readback->swizzle = !ctxInfo->gl2;
+
+    glGetError();
+    ctxInfo->glGenBuffers(1, &readback->buffer);
+    ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffer);
+    ctxInfo->glBufferData(GL_PIXEL_PACK_BUFFER, readback->size, NULL, GL_STREAM_READ);
+    if (ctxInfo->gl2) {
+        glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
+                GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, (GLvoid *) 0);
+    } else {
+        glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
+                GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid *) 0);
+    }
+    ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readback->fence = ctxInfo->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    /* Submit the fence so that polling it can succeed */
+    glFlush();
+
+    if (readback->buffer == 0 || readback->fence == NULL || glGetError() != GL_NO_ERROR) {
+        deletePendingReadback(ctxInfo, readback);
+        return 0;
+    }
+    return ptr_to_jlong(readback);
+}
+
+/*
+ * Waits for the readback to complete and copies the pixels out in the
+ * format doReadPixels produces. The readback is deleted in any case.
+ */
+static jboolean finishReadback(JNIEnv *env, jlong nativeCtxInfo, jlong handle,
+        jint length, jobject buffer, jarray pixelArr) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    PendingReadback *readback = (PendingReadback *) jlong_to_ptr(handle);
+    if ((ctxInfo == NULL) || (readback == NULL)) {
+        return JNI_FALSE;
+    }
+
+    jboolean result = JNI_FALSE;
+    GLenum status;
+    do {
+        status = ctxInfo->glClientWaitSync(readback->fence,
+                GL_SYNC_FLUSH_COMMANDS_BIT, 100000000 /* 100ms */);
+    } while (status == GL_TIMEOUT_EXPIRED);
+    if (status == GL_WAIT_FAILED) {
+        fprintf(stderr, "finishReadback: glClientWaitSync failed\n");
+        deletePendingReadback(ctxInfo, readback);
+        return JNI_FALSE;
+    }
+    if (length < readback->size) {
+        fprintf(stderr, "finishReadback: pixel buffer too small - length = %d\n",
+                (int) length);
+        deletePendingReadback(ctxInfo, readback);
+        return JNI_FALSE;
+    }
+
+    ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffer);
+    GLubyte *src = (GLubyte *) ctxInfo->glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+            readback->size, GL_MAP_READ_BIT);
+    if (src != NULL) {
+        GLubyte *dst = (GLubyte *) (pixelArr ?
+                (*env)->GetPrimitiveArrayCritical(env, pixelArr, NULL) :
+                (*env)->GetDirectBufferAddress(env, buffer));
+        if (dst != NULL) {
+            if (readback->swizzle) {
+                swizzleRGBAtoBGRA(src, dst, (size_t) readback->size / 4);
+            } else {
+                memcpy(dst, src, readback->size);
+            }
+            if (pixelArr != NULL) {
+                (*env)->ReleasePrimitiveArrayCritical(env, pixelArr, dst, 0);
+            }
+            result = JNI_TRUE;
+        }
+        ctxInfo->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    deletePendingReadback(ctxInfo, readback);
+    return result;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nFinishReadbackByte
+ * Signature: (JJILjava/nio/Buffer;[B)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nFinishReadbackByte
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong handle, jint length,
+        jobject buffer, jbyteArray pixelArr) {
+    return finishReadback(env, nativeCtxInfo, handle, length, buffer, pixelArr);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nFinishReadbackInt
+ * Signature: (JJILjava/nio/Buffer;[I)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nFinishReadbackInt
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong handle, jint length,
+        jobject buffer, jintArray pixelArr) {
+    return finishReadback(env, nativeCtxInfo, handle, length, buffer, pixelArr);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nDisposeReadback
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDisposeReadback
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong handle) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    PendingReadback *readback = (PendingReadback *) jlong_to_ptr(handle);
+    if ((ctxInfo == NULL) || (readback == NULL)) {
+        return;
+    }
+    deletePendingReadback(ctxInfo, readback);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nScissorTest
@@ -1097,7 +1708,16 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nScissorTest
             glEnable(GL_SCISSOR_TEST);
             ctxInfo->state.scissorEnabled = JNI_TRUE;
         }
+        if (countState(STATE_SCISSOR,
+                (ctxInfo->state.scissorBox[0] == x) && (ctxInfo->state.scissorBox[1] == y)
+                && (ctxInfo->state.scissorBox[2] == w) && (ctxInfo->state.scissorBox[3] == h))) {
+            return;
+        }
         glScissor(x, y, w, h);
+        ctxInfo->state.scissorBox[0] = x;
+        ctxInfo->state.scissorBox[1] = y;
+        ctxInfo->state.scissorBox[2] = w;
+        ctxInfo->state.scissorBox[3] = h;
     } else if (ctxInfo->state.scissorEnabled) {
         glDisable(GL_SCISSOR_TEST);
         ctxInfo->state.scissorEnabled = JNI_FALSE;
@@ -1112,6 +1732,8 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nScissorTest
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexParamsMinMax
 (JNIEnv *env, jclass class, jint min, jint max) {
     GLenum param = translatePrismToGL(max);
+    // the cached filter of the bound texture is not known here
+    memset(textureParams, 0, sizeof(textureParams));
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, param);
     param = translatePrismToGL(min);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, param);
@@ -1195,36 +1817,202 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nTexImage2D1
     return err == GL_NO_ERROR ? JNI_TRUE : JNI_FALSE;
 }
 
-/*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nTexSubImage2D0
- * Signature: (IIIIIIIILjava/lang/Object;I)V
- */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D0
-(JNIEnv *env, jclass class, jint target, jint level,
-        jint xoffset, jint yoffset, jint width, jint height, jint format,
-        jint type, jobject pixels, jint pixelsByteOffset) {
-    GLvoid *ptr = NULL;
-    if (pixels != NULL) {
-        ptr = (GLvoid *) (((char *) (*env)->GetDirectBufferAddress(env, pixels))
-                + pixelsByteOffset);
+static GLint bytesPerPixel(GLenum format, GLenum type) {
+    GLint components;
+    switch (format) {
+        case GL_ALPHA:
+        case GL_LUMINANCE:
+            components = 1;
+            break;
+        case GL_RGB:
+            components = 3;
+            break;
+        case GL_RGBA:
+        case GL_BGRA:
+            components = 4;
+            break;
+        case GL_YCBCR_422_APPLE:
+            return type == GL_UNSIGNED_SHORT_8_8_APPLE ? 2 : 0;
+        default:
+            return 0;
+    }
+    switch (type) {
+        case GL_UNSIGNED_BYTE:
+            return components;
+        case GL_FLOAT:
+            return components * sizeof(GLfloat);
+        case GL_UNSIGNED_INT_8_8_8_8:
+        case GL_UNSIGNED_INT_8_8_8_8_REV:
+            return components == 4 ? 4 : 0;
+        default:
+            return 0;
     }
-    glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
-            (GLint) xoffset, (GLint) yoffset,
-            (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
-            (GLenum) translatePrismToGL(type), (GLvoid *) ptr);
 }
 
 /*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nTexSubImage2D1
- * Signature: (IIIIIIIILjava/lang/Object;I)V
+ * Copies the pixels into the buffer currently bound to GL_PIXEL_UNPACK_BUFFER.
+ * The buffer is mapped without synchronization when the fence of its last
+ * transfer has signaled, and invalidated otherwise, so that the driver
+ * hands out new storage instead of waiting for the pending transfer.
  */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D1
-(JNIEnv *env, jclass class, jint target, jint level,
-        jint xoffset, jint yoffset, jint width, jint height, jint format,
-        jint type, jobject pixels, jint pixelsByteOffset) {
-    char *ptr = NULL;
+static jboolean fillUploadBuffer(ContextInfo *ctxInfo, int index,
+        GLsizeiptr size, const char *ptr) {
+    GLbitfield access = GL_MAP_WRITE_BIT;
+    GLsync fence = ctxInfo->uploadFences[index];
+    void *dst;
+
+    if (size > ctxInfo->uploadBufferSizes[index]) {
+        /* New storage, nothing reads it yet */
+        ctxInfo->glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+        ctxInfo->uploadBufferSizes[index] = size;
+        access |= GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    } else if (fence == NULL ||
+            ctxInfo->glClientWaitSync(fence, 0, 0) != GL_TIMEOUT_EXPIRED) {
+        access |= GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    } else {
+        access |= GL_MAP_INVALIDATE_BUFFER_BIT;
+    }
+    if (fence != NULL) {
+        ctxInfo->glDeleteSync(fence);
+        ctxInfo->uploadFences[index] = NULL;
+    }
+
+    dst = ctxInfo->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, access);
+    if (dst == NULL) {
+        return JNI_FALSE;
+    }
+    memcpy(dst, ptr, size);
+    /* The contents are undefined if the storage was lost while mapped */
+    return ctxInfo->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Uploads the pixels through the next pixel buffer object of the context.
+ * glTexSubImage2D has to finish reading client memory before it returns,
+ * which on most drivers means converting and copying the whole image on
+ * the calling thread. Copying into a buffer object first lets the driver
+ * schedule the texture transfer later. When buffers can be mapped, the
+ * pixels are copied into a mapping that does not wait for the GPU, see
+ * fillUploadBuffer, and a fence tracks the transfer. Otherwise each buffer
+ * is refilled with glBufferData, which orphans storage still read by a
+ * pending transfer.
+ * Returns JNI_FALSE, without uploading, when the pool is not usable.
+ */
+static jboolean texSubImage2DFromUploadBuffer(ContextInfo *ctxInfo,
+        GLenum target, GLint level, GLint xoffset, GLint yoffset,
+        GLsizei width, GLsizei height, GLenum format, GLenum type,
+        const char *ptr) {
+    if (ctxInfo == NULL || ctxInfo->uploadBuffers[0] == 0 || ptr == NULL ||
+            width <= 0 || height <= 0) {
+        return JNI_FALSE;
+    }
+    GLint bpp = bytesPerPixel(format, type);
+    if (bpp == 0) {
+        return JNI_FALSE;
+    }
+
+    GLint alignment = 4, rowLength = 0, skipPixels = 0, skipRows = 0;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+#ifndef IS_EGL
+    glGetIntegerv(GL_UNPACK_ROW_LENGTH, &rowLength);
+    glGetIntegerv(GL_UNPACK_SKIP_PIXELS, &skipPixels);
+    glGetIntegerv(GL_UNPACK_SKIP_ROWS, &skipRows);
+#endif
+    if (skipPixels != 0 || skipRows != 0 || alignment <= 0) {
+        return JNI_FALSE;
+    }
+    GLsizeiptr rowBytes = (GLsizeiptr) (rowLength > 0 ? rowLength : width) * bpp;
+    rowBytes = (rowBytes + alignment - 1) / alignment * alignment;
+    GLsizeiptr size = rowBytes * (height - 1) + (GLsizeiptr) width * bpp;
+
+    int index = ctxInfo->uploadBufferIndex;
+    ctxInfo->uploadBufferIndex = (index + 1) % NUM_UPLOAD_BUFFERS;
+    ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ctxInfo->uploadBuffers[index]);
+    if (!ctxInfo->mapUploadBuffers || !fillUploadBuffer(ctxInfo, index, size, ptr)) {
+        ctxInfo->glBufferData(GL_PIXEL_UNPACK_BUFFER, size, ptr, GL_STREAM_DRAW);
+        ctxInfo->uploadBufferSizes[index] = size;
+    }
+    glTexSubImage2D(target, level, xoffset, yoffset, width, height,
+            format, type, (GLvoid *) 0);
+    if (ctxInfo->mapUploadBuffers) {
+        ctxInfo->uploadFences[index] =
+                ctxInfo->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return JNI_TRUE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nInitUploadBuffers
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nInitUploadBuffers
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo)
+{
+    jboolean es;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferData == NULL) || (ctxInfo->glGenBuffers == NULL) ||
+            (ctxInfo->glExtensionStr == NULL)) {
+        return JNI_FALSE;
+    }
+    if (ctxInfo->uploadBuffers[0] != 0) {
+        return JNI_TRUE;
+    }
+    /* Core in OpenGL 2.1 and OpenGL ES 3.0 */
+    if (getGLVersion(ctxInfo, &es) < (es ? 30 : 21) &&
+            !isExtensionSupported(ctxInfo->glExtensionStr, "GL_ARB_pixel_buffer_object") &&
+            !isExtensionSupported(ctxInfo->glExtensionStr, "GL_EXT_pixel_buffer_object") &&
+            !isExtensionSupported(ctxInfo->glExtensionStr, "GL_NV_pixel_buffer_object")) {
+        return JNI_FALSE;
+    }
+    ctxInfo->glGenBuffers(NUM_UPLOAD_BUFFERS, ctxInfo->uploadBuffers);
+    ctxInfo->uploadBufferIndex = 0;
+    ctxInfo->mapUploadBuffers = isMapBufferRangeSupported(ctxInfo);
+    return ctxInfo->uploadBuffers[0] != 0 ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nTexSubImage2D0
+ * Signature: (JZIIIIIIIILjava/lang/Object;I)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D0
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jboolean useUploadBuffer,
+        jint target, jint level,
+        jint xoffset, jint yoffset, jint width, jint height, jint format,
+        jint type, jobject pixels, jint pixelsByteOffset) {
+    GLvoid *ptr = NULL;
+    if (pixels != NULL) {
+        ptr = (GLvoid *) (((char *) (*env)->GetDirectBufferAddress(env, pixels))
+                + pixelsByteOffset);
+    }
+    if (useUploadBuffer &&
+            texSubImage2DFromUploadBuffer((ContextInfo *) jlong_to_ptr(nativeCtxInfo),
+            (GLenum) translatePrismToGL(target), (GLint) level,
+            (GLint) xoffset, (GLint) yoffset,
+            (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
+            (GLenum) translatePrismToGL(type), (const char *) ptr)) {
+        return;
+    }
+    glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
+            (GLint) xoffset, (GLint) yoffset,
+            (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
+            (GLenum) translatePrismToGL(type), (GLvoid *) ptr);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nTexSubImage2D1
+ * Signature: (JZIIIIIIIILjava/lang/Object;I)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D1
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jboolean useUploadBuffer,
+        jint target, jint level,
+        jint xoffset, jint yoffset, jint width, jint height, jint format,
+        jint type, jobject pixels, jint pixelsByteOffset) {
+    char *ptr = NULL;
     char *ptrPlusOffset = NULL;
     if (pixels != NULL) {
         ptr = (char *) (*env)->GetPrimitiveArrayCritical(env, pixels, NULL);
@@ -1234,10 +2022,17 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D1
         }
         ptrPlusOffset = ptr + pixelsByteOffset;
     }
-    glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
+    if (!useUploadBuffer ||
+            !texSubImage2DFromUploadBuffer((ContextInfo *) jlong_to_ptr(nativeCtxInfo),
+            (GLenum) translatePrismToGL(target), (GLint) level,
             (GLint) xoffset, (GLint) yoffset,
             (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
-            (GLenum) translatePrismToGL(type), (GLvoid *) ptrPlusOffset);
+            (GLenum) translatePrismToGL(type), ptrPlusOffset)) {
+        glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
+                (GLint) xoffset, (GLint) yoffset,
+                (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
+                (GLenum) translatePrismToGL(type), (GLvoid *) ptrPlusOffset);
+    }
     if (pixels != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, pixels, ptr, 0);
     }
@@ -1315,6 +2110,9 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform1f
     if (ctxInfo == NULL) {
         return;
     }
+    if (isUniformfRedundant(ctxInfo, location, 1, &v0)) {
+        return;
+    }
     ctxInfo->glUniform1f(location, v0);
 }
 
@@ -1326,10 +2124,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform1f
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform2f
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
         jfloat v0, jfloat v1) {
+    GLfloat v[2] = { v0, v1 };
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     if (ctxInfo == NULL) {
         return;
     }
+    if (isUniformfRedundant(ctxInfo, location, 2, v)) {
+        return;
+    }
     ctxInfo->glUniform2f(location, v0, v1);
 }
 
@@ -1341,10 +2143,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform2f
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform3f
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
         jfloat v0, jfloat v1, jfloat v2) {
+    GLfloat v[3] = { v0, v1, v2 };
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     if (ctxInfo == NULL) {
         return;
     }
+    if (isUniformfRedundant(ctxInfo, location, 3, v)) {
+        return;
+    }
     ctxInfo->glUniform3f(location, v0, v1, v2);
 }
 
@@ -1356,10 +2162,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform3f
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform4f
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
         jfloat v0, jfloat v1, jfloat v2, jfloat v3) {
+    GLfloat v[4] = { v0, v1, v2, v3 };
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     if (ctxInfo == NULL) {
         return;
     }
+    if (isUniformfRedundant(ctxInfo, location, 4, v)) {
+        return;
+    }
     ctxInfo->glUniform4f(location, v0, v1, v2, v3);
 }
 
@@ -1380,6 +2190,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform4fv0
         _ptr2 = (GLfloat *) (((char *) (*env)->GetDirectBufferAddress(env, value))
                 + valueByteOffset);
     }
+    forgetUniforms(ctxInfo, location, count);
     ctxInfo->glUniform4fv((GLint) location, (GLsizei) count, (GLfloat *) _ptr2);
 }
 
@@ -1406,6 +2217,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform4fv1
         ptrPlusOffset = ptr + valueByteOffset;
 
     }
+    forgetUniforms(ctxInfo, location, count);
     ctxInfo->glUniform4fv((GLint) location, (GLsizei) count, (GLfloat *) ptrPlusOffset);
     if (value != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, value, ptr, 0);
@@ -1423,6 +2235,9 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform1i
     if ((ctxInfo == NULL) || (ctxInfo->glUniform1i == NULL)) {
         return;
     }
+    if (isUniformRedundant(ctxInfo, location, 1 | UNIFORM_INT, &v0)) {
+        return;
+    }
     ctxInfo->glUniform1i(location, v0);
 }
 
@@ -1433,10 +2248,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform1i
  */
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform2i
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location, jint v0, jint v1) {
+    GLint v[2] = { v0, v1 };
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     if ((ctxInfo == NULL) || (ctxInfo->glUniform2i == NULL)) {
         return;
     }
+    if (isUniformRedundant(ctxInfo, location, 2 | UNIFORM_INT, v)) {
+        return;
+    }
     ctxInfo->glUniform2i(location, v0, v1);
 }
 
@@ -1448,10 +2267,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform2i
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform3i
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
         jint v0, jint v1, jint v2) {
+    GLint v[3] = { v0, v1, v2 };
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     if ((ctxInfo == NULL) || (ctxInfo->glUniform3i == NULL)) {
         return;
     }
+    if (isUniformRedundant(ctxInfo, location, 3 | UNIFORM_INT, v)) {
+        return;
+    }
     ctxInfo->glUniform3i(location, v0, v1, v2);
 }
 
@@ -1463,10 +2286,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform3i
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform4i
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
         jint v0, jint v1, jint v2, jint v3) {
+    GLint v[4] = { v0, v1, v2, v3 };
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     if ((ctxInfo == NULL) || (ctxInfo->glUniform4i == NULL)) {
         return;
     }
+    if (isUniformRedundant(ctxInfo, location, 4 | UNIFORM_INT, v)) {
+        return;
+    }
     ctxInfo->glUniform4i(location, v0, v1, v2, v3);
 }
 
@@ -1488,6 +2315,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform4iv0
         _ptr2 = (GLint *) (((char *) (*env)->GetDirectBufferAddress(env, value))
                 + valueByteOffset);
     }
+    forgetUniforms(ctxInfo, location, count);
     ctxInfo->glUniform4iv((GLint) location, (GLsizei) count, (GLint *) _ptr2);
 }
 
@@ -1514,6 +2342,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform4iv1
         }
         ptrPlusOffset = ptr + valueByteOffset;
     }
+    forgetUniforms(ctxInfo, location, count);
     ctxInfo->glUniform4iv((GLint) location, (GLsizei) count, (GLint *) ptrPlusOffset);
     if (value != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, value, ptr, 0);
@@ -1541,6 +2370,10 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniformMatrix4fv
             return;
         }
     }
+    if (isUniformMatrixRedundant(ctxInfo, location, transpose, _ptr)) {
+        (*env)->ReleasePrimitiveArrayCritical(env, values, _ptr, JNI_ABORT);
+        return;
+    }
     ctxInfo->glUniformMatrix4fv((GLint) location, 1, (GLboolean) transpose, _ptr);
 
     if (_ptr) (*env)->ReleasePrimitiveArrayCritical(env, values, _ptr, JNI_ABORT);
@@ -1554,8 +2387,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniformMatrix4fv
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUpdateFilterState
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texID, jboolean linearFiler) {
     int glFilter;
+    TextureParams *params;
 
     glFilter = linearFiler ? GL_LINEAR : GL_NEAREST;
+    params = getTextureParams((GLuint) texID);
+    if (countState(STATE_TEX_PARAMETER, params->filter == glFilter)) {
+        return;
+    }
+    params->filter = glFilter;
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, glFilter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, glFilter);
 }
@@ -1567,10 +2406,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUpdateFilterState
  */
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUpdateWrapState
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texID, jint wrapMode) {
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,
-            (GLenum) translatePrismToGL(wrapMode));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
-            (GLenum) translatePrismToGL(wrapMode));
+    GLint glWrap = (GLint) translatePrismToGL(wrapMode);
+    TextureParams *params = getTextureParams((GLuint) texID);
+    if (countState(STATE_TEX_PARAMETER, params->wrap == glWrap)) {
+        return;
+    }
+    params->wrap = glWrap;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, glWrap);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, glWrap);
 }
 
 /*
@@ -1584,7 +2427,38 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUseProgram
     if ((ctxInfo == NULL) || (ctxInfo->glUseProgram == NULL)) {
         return;
     }
+    validateBindings(ctxInfo);
+    if (countState(STATE_USE_PROGRAM, ctxInfo->state.program == (GLuint) pID)) {
+        return;
+    }
     ctxInfo->glUseProgram(pID);
+    ctxInfo->state.program = (GLuint) pID;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetStateCounters
+ * Signature: ([J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nGetStateCounters
+(JNIEnv *env, jclass class, jlongArray counters) {
+    jlong values[2 * NUM_STATE_COUNTERS];
+    jsize length;
+    int i;
+    if (counters == NULL) {
+        return;
+    }
+    for (i = 0; i < NUM_STATE_COUNTERS; i++) {
+        values[2 * i] = stateIssued[i];
+        values[2 * i + 1] = stateSkipped[i];
+        stateIssued[i] = 0;
+        stateSkipped[i] = 0;
+    }
+    length = (*env)->GetArrayLength(env, counters);
+    if (length > 2 * NUM_STATE_COUNTERS) {
+        length = 2 * NUM_STATE_COUNTERS;
+    }
+    (*env)->SetLongArrayRegion(env, counters, 0, length, values);
 }
 
 /*
@@ -1650,6 +2524,218 @@ static void setVertexAttributePointers(ContextInfo *ctx, float *pFloat, char *pB
         ctx->vbByteData = pByte;
     }
 }
+/*
+ * Points the vertex attributes at a quad batch stored in the bound
+ * GL_ARRAY_BUFFER, with the coordinates at floatOffset and the colors at
+ * byteOffset.
+ */
+static void setVertexAttributeOffsets(ContextInfo *ctx, GLintptr floatOffset,
+        GLintptr byteOffset)
+{
+    ctx->glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, coordStride,
+        (const GLvoid *) floatOffset);
+    ctx->glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, coordStride,
+        (const GLvoid *) (floatOffset + sizeof(float) * FLOATS_PER_VC));
+    ctx->glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, coordStride,
+        (const GLvoid *) (floatOffset + sizeof(float) * (FLOATS_PER_VC + FLOATS_PER_TC)));
+    ctx->glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, colorStride,
+        (const GLvoid *) byteOffset);
+    /* The cached client array pointers no longer match the attributes */
+    ctx->vbFloatData = NULL;
+    ctx->vbByteData = NULL;
+}
+
+/*
+ * Copies the vertices of a quad batch into the streaming vertex buffer and
+ * points the vertex attributes at them. This is the path for contexts that
+ * cannot map buffers without synchronization, see nMapVertexRing. The
+ * buffer is filled front to back with glBufferSubData and its storage is
+ * orphaned when it wraps, so the driver can hand out new storage instead of
+ * waiting for the draws still reading the old one.
+ * Returns JNI_FALSE, with the buffer unbound, when the batch does not fit.
+ */
+static jboolean setVertexAttributesFromRing(JNIEnv *env, ContextInfo *ctx,
+        jint numVertices, jfloatArray dataf, jbyteArray datab)
+{
+    GLsizeiptr floatBytes = (GLsizeiptr) numVertices * coordStride;
+    GLsizeiptr byteBytes = (GLsizeiptr) numVertices * colorStride;
+    if (floatBytes + byteBytes > ctx->vbRingSize) {
+        return JNI_FALSE;
+    }
+
+    ctx->glBindBuffer(GL_ARRAY_BUFFER, ctx->vbRingBuffer);
+    if (ctx->vbRingOffset + floatBytes + byteBytes > ctx->vbRingSize) {
+        ctx->glBufferData(GL_ARRAY_BUFFER, ctx->vbRingSize, NULL, GL_STREAM_DRAW);
+        ctx->vbRingOffset = 0;
+    }
+    GLintptr floatOffset = ctx->vbRingOffset;
+    GLintptr byteOffset = floatOffset + floatBytes;
+
+    /* The arrays are only pinned while the driver copies them */
+    float *pFloat = (float *)(*env)->GetPrimitiveArrayCritical(env, dataf, NULL);
+    if (pFloat == NULL) {
+        ctx->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return JNI_FALSE;
+    }
+    ctx->glBufferSubData(GL_ARRAY_BUFFER, floatOffset, floatBytes, pFloat);
+    (*env)->ReleasePrimitiveArrayCritical(env, dataf, pFloat, JNI_ABORT);
+
+    char *pByte = (char *)(*env)->GetPrimitiveArrayCritical(env, datab, NULL);
+    if (pByte == NULL) {
+        ctx->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return JNI_FALSE;
+    }
+    ctx->glBufferSubData(GL_ARRAY_BUFFER, byteOffset, byteBytes, pByte);
+    (*env)->ReleasePrimitiveArrayCritical(env, datab, pByte, JNI_ABORT);
+
+    ctx->vbRingOffset = byteOffset + byteBytes;
+    setVertexAttributeOffsets(ctx, floatOffset, byteOffset);
+    return JNI_TRUE;
+}
+
+/* Returns the segment of the streaming vertex buffer holding the offset */
+static int vertexRingSegment(ContextInfo *ctx, GLintptr offset)
+{
+    int segment = (int) (offset / (ctx->vbRingSize / NUM_VB_RING_SEGMENTS));
+    return segment < NUM_VB_RING_SEGMENTS ? segment : NUM_VB_RING_SEGMENTS - 1;
+}
+
+static void deleteVertexRingFences(ContextInfo *ctx)
+{
+    for (int i = 0; i < NUM_VB_RING_SEGMENTS; i++) {
+        if (ctx->vbRingFences[i] != NULL) {
+            ctx->glDeleteSync(ctx->vbRingFences[i]);
+            ctx->vbRingFences[i] = NULL;
+        }
+    }
+}
+
+/*
+ * Fences the segments of the streaming vertex buffer that the batch drawn
+ * from start to end filled up. No later batch writes to them before the
+ * buffer wraps, so the fence follows the last draw reading each of them.
+ */
+static void fenceVertexRingSegments(ContextInfo *ctx, GLintptr start, GLintptr end)
+{
+    GLsizeiptr segmentSize = ctx->vbRingSize / NUM_VB_RING_SEGMENTS;
+    for (int i = vertexRingSegment(ctx, start);
+            i < NUM_VB_RING_SEGMENTS - 1 && (GLintptr) (i + 1) * segmentSize <= end;
+            i++) {
+        ctx->vbRingFences[i] = ctx->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+}
+
+/*
+ * Binds the streaming vertex buffer and maps size bytes of it for writing.
+ * The range is mapped without synchronization, which is safe once the
+ * fences of the segments it overlaps have signaled, that is once the draws
+ * of the previous pass over the buffer no longer read them. When a fence
+ * has not signaled yet the storage is orphaned instead of waiting for it.
+ */
+static void *mapVertexRing(ContextInfo *ctx, GLsizeiptr size)
+{
+    ctx->glBindBuffer(GL_ARRAY_BUFFER, ctx->vbRingBuffer);
+    if (ctx->vbRingOffset + size > ctx->vbRingSize) {
+        /* The segment the last batch ended in is complete as well */
+        if (ctx->vbRingOffset > 0) {
+            int last = vertexRingSegment(ctx, ctx->vbRingOffset - 1);
+            if (ctx->vbRingFences[last] == NULL) {
+                ctx->vbRingFences[last] =
+                        ctx->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            }
+        }
+        ctx->vbRingOffset = 0;
+    }
+
+    int first = vertexRingSegment(ctx, ctx->vbRingOffset);
+    int last = vertexRingSegment(ctx, ctx->vbRingOffset + size - 1);
+    jboolean busy = JNI_FALSE;
+    for (int i = first; i <= last; i++) {
+        GLsync fence = ctx->vbRingFences[i];
+        if (fence != NULL && ctx->glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+            busy = JNI_TRUE;
+            break;
+        }
+    }
+    if (busy) {
+        ctx->glBufferData(GL_ARRAY_BUFFER, ctx->vbRingSize, NULL, GL_STREAM_DRAW);
+        deleteVertexRingFences(ctx);
+        ctx->vbRingOffset = 0;
+    } else {
+        for (int i = first; i <= last; i++) {
+            if (ctx->vbRingFences[i] != NULL) {
+                ctx->glDeleteSync(ctx->vbRingFences[i]);
+                ctx->vbRingFences[i] = NULL;
+            }
+        }
+    }
+
+    return ctx->glMapBufferRange(GL_ARRAY_BUFFER, ctx->vbRingOffset, size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nMapVertexRing
+ * Signature: (JI)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_com_sun_prism_es2_GLContext_nMapVertexRing
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint numVertices)
+{
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->vbRingBuffer == 0) ||
+            !ctxInfo->mapVertexRing || (numVertices <= 0)) {
+        return NULL;
+    }
+    GLsizeiptr size = (GLsizeiptr) numVertices * (coordStride + colorStride);
+    if (size > ctxInfo->vbRingSize) {
+        return NULL;
+    }
+
+    void *ptr = mapVertexRing(ctxInfo, size);
+    if (ptr == NULL) {
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return NULL;
+    }
+    jobject buffer = (*env)->NewDirectByteBuffer(env, ptr, (jlong) size);
+    if (buffer == NULL) {
+        ctxInfo->glUnmapBuffer(GL_ARRAY_BUFFER);
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    return buffer;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nDrawMappedQuads
+ * Signature: (JI)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nDrawMappedQuads
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint numVertices)
+{
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if (ctxInfo == NULL) {
+        return JNI_FALSE;
+    }
+
+    GLintptr floatOffset = ctxInfo->vbRingOffset;
+    GLintptr byteOffset = floatOffset + (GLsizeiptr) numVertices * coordStride;
+    GLintptr end = byteOffset + (GLsizeiptr) numVertices * colorStride;
+    /* The contents are undefined if the storage was lost while mapped */
+    if (!ctxInfo->glUnmapBuffer(GL_ARRAY_BUFFER)) {
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return JNI_FALSE;
+    }
+
+    setVertexAttributeOffsets(ctxInfo, floatOffset, byteOffset);
+    glDrawElements(GL_TRIANGLES, numVertices / 4 * 2 * 3, GL_UNSIGNED_SHORT, 0);
+    ctxInfo->vbRingOffset = end;
+    fenceVertexRingSegments(ctxInfo, floatOffset, end);
+    /* Client array and 3D paths expect no array buffer to be bound */
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return JNI_TRUE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nDrawIndexedQuads
@@ -1668,6 +2754,15 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDrawIndexedQuads
         return;
     }
 
+    /* Writes through glBufferSubData would not be fenced, see mapVertexRing */
+    if (ctxInfo->vbRingBuffer != 0 && !ctxInfo->mapVertexRing &&
+            setVertexAttributesFromRing(env, ctxInfo, numVertices, dataf, datab)) {
+        glDrawElements(GL_TRIANGLES, numQuads * 2 * 3, GL_UNSIGNED_SHORT, 0);
+        /* Client array and 3D paths expect no array buffer to be bound */
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return;
+    }
+
     pFloat = (float *)(*env)->GetPrimitiveArrayCritical(env, dataf, NULL);
     pByte = (char *)(*env)->GetPrimitiveArrayCritical(env, datab, NULL);
 
@@ -1680,6 +2775,95 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDrawIndexedQuads
     if (pFloat) (*env)->ReleasePrimitiveArrayCritical(env, dataf, pFloat, JNI_ABORT);
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nSetVertexRingSize
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetVertexRingSize
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong size)
+{
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferData == NULL) || (ctxInfo->glBufferSubData == NULL) ||
+            (ctxInfo->glGenBuffers == NULL) || (ctxInfo->glDeleteBuffers == NULL)) {
+        return;
+    }
+
+    if (ctxInfo->vbRingBuffer != 0) {
+        if (ctxInfo->mapVertexRing) {
+            deleteVertexRingFences(ctxInfo);
+            ctxInfo->mapVertexRing = JNI_FALSE;
+        }
+        ctxInfo->glDeleteBuffers(1, &ctxInfo->vbRingBuffer);
+        ctxInfo->vbRingBuffer = 0;
+        ctxInfo->vbRingSize = 0;
+        ctxInfo->vbRingOffset = 0;
+    }
+    if (size <= 0) {
+        return;
+    }
+
+    ctxInfo->glGenBuffers(1, &ctxInfo->vbRingBuffer);
+    if (ctxInfo->vbRingBuffer == 0) {
+        return;
+    }
+    glGetError();
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, ctxInfo->vbRingBuffer);
+    ctxInfo->glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr) size, NULL, GL_STREAM_DRAW);
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+    if (glGetError() != GL_NO_ERROR) {
+        ctxInfo->glDeleteBuffers(1, &ctxInfo->vbRingBuffer);
+        ctxInfo->vbRingBuffer = 0;
+        return;
+    }
+    ctxInfo->vbRingSize = (GLsizeiptr) size;
+    ctxInfo->vbRingOffset = 0;
+    ctxInfo->mapVertexRing = size >= NUM_VB_RING_SEGMENTS &&
+            isMapBufferRangeSupported(ctxInfo);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nDisposeBuffers
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDisposeBuffers
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo)
+{
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glDeleteBuffers == NULL)) {
+        return;
+    }
+
+    if (ctxInfo->vbRingBuffer != 0) {
+        if (ctxInfo->mapVertexRing) {
+            deleteVertexRingFences(ctxInfo);
+            ctxInfo->mapVertexRing = JNI_FALSE;
+        }
+        ctxInfo->glDeleteBuffers(1, &ctxInfo->vbRingBuffer);
+        ctxInfo->vbRingBuffer = 0;
+        ctxInfo->vbRingSize = 0;
+        ctxInfo->vbRingOffset = 0;
+    }
+    if (ctxInfo->instanceBuffer != 0) {
+        ctxInfo->glDeleteBuffers(1, &ctxInfo->instanceBuffer);
+        ctxInfo->instanceBuffer = 0;
+        ctxInfo->instanceBufferSize = 0;
+    }
+    if (ctxInfo->uploadBuffers[0] != 0) {
+        for (int i = 0; i < NUM_UPLOAD_BUFFERS; i++) {
+            if (ctxInfo->uploadFences[i] != NULL) {
+                ctxInfo->glDeleteSync(ctxInfo->uploadFences[i]);
+                ctxInfo->uploadFences[i] = NULL;
+            }
+            ctxInfo->uploadBufferSizes[i] = 0;
+        }
+        ctxInfo->glDeleteBuffers(NUM_UPLOAD_BUFFERS, ctxInfo->uploadBuffers);
+        memset(ctxInfo->uploadBuffers, 0, sizeof(ctxInfo->uploadBuffers));
+    }
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCreateIndexBuffer16
@@ -1745,7 +2929,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetDeviceParametersFor2
     ctxInfo->vbByteData = NULL;
 
     glEnable(GL_BLEND);
-    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    blendFunc(ctxInfo, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 
     if (ctxInfo->state.scissorEnabled) {
         ctxInfo->state.scissorEnabled = JNI_FALSE;
@@ -1779,7 +2963,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetDeviceParametersFor3
     // This setting matches 2D ((1,1-alpha); premultiplied alpha case.
     // Will need to evaluate when support proper 3D blending (alpha,1-alpha).
     glEnable(GL_BLEND);
-    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    blendFunc(ctxInfo, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 
     if (ctxInfo->state.scissorEnabled) {
         ctxInfo->state.scissorEnabled = JNI_FALSE;
@@ -1824,6 +3008,10 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nCreateES2Mesh
     meshInfo->vboIDArray[MESH_INDEXBUFFER] = 0;
     meshInfo->indexBufferSize = 0;
     meshInfo->indexBufferType = 0;
+    meshInfo->spareVertexBuffer = 0;
+    meshInfo->vertexBufferSize = 0;
+    meshInfo->staleFrom = 0;
+    meshInfo->staleTo = 0;
 
     /* create vbo ids */
     ctxInfo->glGenBuffers(MESH_MAX_BUFFERS, (meshInfo->vboIDArray));
@@ -1849,17 +3037,45 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nReleaseES2Mesh
     // TODO: 3D - Native clean up. Need to determine do we have to free what
     //            is held by ES2MeshInfo.
     ctxInfo->glDeleteBuffers(MESH_MAX_BUFFERS, (GLuint *) (meshInfo->vboIDArray));
+    if (meshInfo->spareVertexBuffer != 0) {
+        ctxInfo->glDeleteBuffers(1, &meshInfo->spareVertexBuffer);
+    }
     free(meshInfo);
 }
 
+/*
+ * Fills the vertex buffer of the mesh, and its spare vertex buffer for
+ * meshes that are updated, with the given vertices.
+ */
+static void setVertexBufferData(ContextInfo *ctxInfo, MeshInfo *meshInfo,
+        GLfloat *vertexBuffer, GLuint size, jboolean dynamic)
+{
+    GLenum usage = dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
+    ctxInfo->glBufferData(GL_ARRAY_BUFFER, size * sizeof (GLfloat),
+            vertexBuffer, usage);
+    if (dynamic && (meshInfo->spareVertexBuffer == 0)) {
+        ctxInfo->glGenBuffers(1, &meshInfo->spareVertexBuffer);
+    }
+    if (meshInfo->spareVertexBuffer != 0) {
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->spareVertexBuffer);
+        ctxInfo->glBufferData(GL_ARRAY_BUFFER, size * sizeof (GLfloat),
+                vertexBuffer, usage);
+    }
+    meshInfo->vertexBufferSize = size;
+    meshInfo->staleFrom = 0;
+    meshInfo->staleTo = 0;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nBuildNativeGeometryShort
- * Signature: (JJ[FI[SI)Z
+ * Signature: (JJ[FI[SIZ)Z
  */
 JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometryShort
   (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshInfo,
-        jfloatArray vbArray, jint vbSize, jshortArray ibArray, jint ibSize)
+        jfloatArray vbArray, jint vbSize, jshortArray ibArray, jint ibSize,
+        jboolean dynamic)
 {
     GLuint vertexBufferSize;
     GLuint indexBufferSize;
@@ -1875,6 +3091,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
             (vbArray == NULL) || (ibArray == NULL) ||
             (ctxInfo->glBindBuffer == NULL) ||
             (ctxInfo->glBufferData == NULL) ||
+            (ctxInfo->glGenBuffers == NULL) ||
             (meshInfo->vboIDArray[MESH_VERTEXBUFFER] == 0)||
             (meshInfo->vboIDArray[MESH_INDEXBUFFER] == 0) ||
             vbSize < 0 || ibSize < 0) {
@@ -1895,14 +3112,12 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
 
     if (status) {
         // Initialize vertex buffer
-        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
-        ctxInfo->glBufferData(GL_ARRAY_BUFFER, uvbSize * sizeof (GLfloat),
-                vertexBuffer, GL_STATIC_DRAW);
+        setVertexBufferData(ctxInfo, meshInfo, vertexBuffer, uvbSize, dynamic);
 
         // Initialize index buffer
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
         ctxInfo->glBufferData(GL_ELEMENT_ARRAY_BUFFER, uibSize * sizeof (GLushort),
-                indexBuffer, GL_STATIC_DRAW);
+                indexBuffer, dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
         meshInfo->indexBufferSize = uibSize;
         meshInfo->indexBufferType = GL_UNSIGNED_SHORT;
 
@@ -1924,11 +3139,12 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nBuildNativeGeometryInt
- * Signature: (JJ[FI[II)Z
+ * Signature: (JJ[FI[IIZ)Z
  */
 JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometryInt
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshInfo,
-        jfloatArray vbArray, jint vbSize, jintArray ibArray, jint ibSize)
+        jfloatArray vbArray, jint vbSize, jintArray ibArray, jint ibSize,
+        jboolean dynamic)
 {
     GLuint vertexBufferSize;
     GLuint indexBufferSize;
@@ -1944,6 +3160,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
             (vbArray == NULL) || (ibArray == NULL) ||
             (ctxInfo->glBindBuffer == NULL) ||
             (ctxInfo->glBufferData == NULL) ||
+            (ctxInfo->glGenBuffers == NULL) ||
             (meshInfo->vboIDArray[MESH_VERTEXBUFFER] == 0)||
             (meshInfo->vboIDArray[MESH_INDEXBUFFER] == 0) ||
             vbSize < 0 || ibSize < 0) {
@@ -1964,14 +3181,12 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
 
     if (status) {
         // Initialize vertex buffer
-        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
-        ctxInfo->glBufferData(GL_ARRAY_BUFFER, uvbSize * sizeof (GLfloat),
-                vertexBuffer, GL_STATIC_DRAW);
+        setVertexBufferData(ctxInfo, meshInfo, vertexBuffer, uvbSize, dynamic);
 
         // Initialize index buffer
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
         ctxInfo->glBufferData(GL_ELEMENT_ARRAY_BUFFER, uibSize * sizeof (GLuint),
-                indexBuffer, GL_STATIC_DRAW);
+                indexBuffer, dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
         meshInfo->indexBufferSize = uibSize;
         meshInfo->indexBufferType = GL_UNSIGNED_INT;
 
@@ -1990,6 +3205,65 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
     return status;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nUpdateNativeGeometry
+ * Signature: (JJ[FII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nUpdateNativeGeometry
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshInfo,
+        jfloatArray vbArray, jint from, jint to)
+{
+    GLfloat *vertexBuffer;
+    GLuint spare;
+    GLuint ufrom = (GLuint) from;
+    GLuint uto = (GLuint) to;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshInfo *meshInfo = (MeshInfo *) jlong_to_ptr(nativeMeshInfo);
+    if ((ctxInfo == NULL) || (meshInfo == NULL) || (vbArray == NULL) ||
+            (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferSubData == NULL) ||
+            (meshInfo->spareVertexBuffer == 0) ||
+            from < 0 || from >= to || uto > meshInfo->vertexBufferSize ||
+            (GLuint) (*env)->GetArrayLength(env, vbArray) < meshInfo->vertexBufferSize) {
+        return JNI_FALSE;
+    }
+
+    vertexBuffer = (GLfloat *) ((*env)->GetPrimitiveArrayCritical(env, vbArray, NULL));
+    if (vertexBuffer == NULL) {
+        return JNI_FALSE;
+    }
+
+    // The spare buffer still lacks what the previous update wrote to the
+    // current one
+    spare = meshInfo->spareVertexBuffer;
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, spare);
+    if (meshInfo->staleFrom < meshInfo->staleTo) {
+        if ((meshInfo->staleTo < ufrom) || (uto < meshInfo->staleFrom)) {
+            ctxInfo->glBufferSubData(GL_ARRAY_BUFFER,
+                    meshInfo->staleFrom * sizeof (GLfloat),
+                    (meshInfo->staleTo - meshInfo->staleFrom) * sizeof (GLfloat),
+                    vertexBuffer + meshInfo->staleFrom);
+        } else {
+            ufrom = ufrom < meshInfo->staleFrom ? ufrom : meshInfo->staleFrom;
+            uto = uto > meshInfo->staleTo ? uto : meshInfo->staleTo;
+        }
+    }
+    ctxInfo->glBufferSubData(GL_ARRAY_BUFFER, ufrom * sizeof (GLfloat),
+            (uto - ufrom) * sizeof (GLfloat), vertexBuffer + ufrom);
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    (*env)->ReleasePrimitiveArrayCritical(env, vbArray, vertexBuffer, JNI_ABORT);
+
+    // Draw from the updated buffer from now on
+    meshInfo->spareVertexBuffer = meshInfo->vboIDArray[MESH_VERTEXBUFFER];
+    meshInfo->vboIDArray[MESH_VERTEXBUFFER] = spare;
+    meshInfo->staleFrom = (GLuint) from;
+    meshInfo->staleTo = (GLuint) to;
+    return JNI_TRUE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCreateES2PhongMaterial
@@ -2312,6 +3586,33 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetLight
     meshViewInfo->lightFalloff = falloff;
 }
 
+static void bindMeshAttributes(ContextInfo *ctxInfo, MeshInfo *mInfo) {
+    GLuint offset = 0;
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, mInfo->vboIDArray[MESH_VERTEXBUFFER]);
+    ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mInfo->vboIDArray[MESH_INDEXBUFFER]);
+
+    ctxInfo->glEnableVertexAttribArray(VC_3D_INDEX);
+    ctxInfo->glEnableVertexAttribArray(TC_3D_INDEX);
+    ctxInfo->glEnableVertexAttribArray(NC_3D_INDEX);
+
+    ctxInfo->glVertexAttribPointer(VC_3D_INDEX, VC_3D_SIZE, GL_FLOAT, GL_FALSE,
+            VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
+    offset += VC_3D_SIZE * sizeof(GLfloat);
+    ctxInfo->glVertexAttribPointer(TC_3D_INDEX, TC_3D_SIZE, GL_FLOAT, GL_FALSE,
+            VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
+    offset += TC_3D_SIZE * sizeof(GLfloat);
+    ctxInfo->glVertexAttribPointer(NC_3D_INDEX, NC_3D_SIZE, GL_FLOAT, GL_FALSE,
+            VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
+}
+
+static void unbindMeshAttributes(ContextInfo *ctxInfo) {
+    ctxInfo->glDisableVertexAttribArray(VC_3D_INDEX);
+    ctxInfo->glDisableVertexAttribArray(NC_3D_INDEX);
+    ctxInfo->glDisableVertexAttribArray(TC_3D_INDEX);
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+    ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nRenderMeshView
@@ -2320,7 +3621,6 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetLight
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
   (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshViewInfo)
 {
-    GLuint offset = 0;
     MeshInfo *mInfo;
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     MeshViewInfo *mvInfo = (MeshViewInfo *) jlong_to_ptr(nativeMeshViewInfo);
@@ -2342,30 +3642,147 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
 
     // Draw triangles ...
     mInfo = mvInfo->meshInfo;
-    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, mInfo->vboIDArray[MESH_VERTEXBUFFER]);
-    ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mInfo->vboIDArray[MESH_INDEXBUFFER]);
+    bindMeshAttributes(ctxInfo, mInfo);
 
-    ctxInfo->glEnableVertexAttribArray(VC_3D_INDEX);
-    ctxInfo->glEnableVertexAttribArray(TC_3D_INDEX);
-    ctxInfo->glEnableVertexAttribArray(NC_3D_INDEX);
+    glDrawElements(GL_TRIANGLES, mInfo->indexBufferSize,
+            mInfo->indexBufferType, 0);
 
-    ctxInfo->glVertexAttribPointer(VC_3D_INDEX, VC_3D_SIZE, GL_FLOAT, GL_FALSE,
-            VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
-    offset += VC_3D_SIZE * sizeof(GLfloat);
-    ctxInfo->glVertexAttribPointer(TC_3D_INDEX, TC_3D_SIZE, GL_FLOAT, GL_FALSE,
-            VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
-    offset += TC_3D_SIZE * sizeof(GLfloat);
-    ctxInfo->glVertexAttribPointer(NC_3D_INDEX, NC_3D_SIZE, GL_FLOAT, GL_FALSE,
-            VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
+    // Reset states
+    unbindMeshAttributes(ctxInfo);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetMeshInstancing
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nGetMeshInstancing
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo)
+{
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glVertexAttrib4fv == NULL)) {
+        return com_sun_prism_es2_GLContext_INSTANCING_NONE;
+    }
+    if ((ctxInfo->glGenBuffers == NULL) || (ctxInfo->glVertexAttribDivisor == NULL) ||
+            (ctxInfo->glDrawElementsInstanced == NULL) ||
+            (ctxInfo->versionStr == NULL) || (ctxInfo->glExtensionStr == NULL)) {
+        return com_sun_prism_es2_GLContext_INSTANCING_EMULATED;
+    }
+    /* Both are core in OpenGL ES 3.0 */
+    if (strncmp(ctxInfo->versionStr, "OpenGL ES ", 10) == 0) {
+        return atoi(ctxInfo->versionStr + 10) >= 3 ?
+                com_sun_prism_es2_GLContext_INSTANCING_HARDWARE :
+                com_sun_prism_es2_GLContext_INSTANCING_EMULATED;
+    }
+    return isExtensionSupported(ctxInfo->glExtensionStr, "GL_ARB_instanced_arrays") &&
+            isExtensionSupported(ctxInfo->glExtensionStr, "GL_ARB_draw_instanced") ?
+            com_sun_prism_es2_GLContext_INSTANCING_HARDWARE :
+            com_sun_prism_es2_GLContext_INSTANCING_EMULATED;
+}
+
+/*
+ * Uploads the per-instance attributes to the instance buffer, growing it
+ * when needed, and leaves it bound to GL_ARRAY_BUFFER.
+ */
+static jboolean uploadInstances(ContextInfo *ctxInfo, GLfloat *data, jint count) {
+    GLsizeiptr size = (GLsizeiptr) count * INSTANCE_3D_STRIDE;
+    if (ctxInfo->instanceBuffer == 0) {
+        ctxInfo->glGenBuffers(1, &ctxInfo->instanceBuffer);
+        if (ctxInfo->instanceBuffer == 0) {
+            return JNI_FALSE;
+        }
+    }
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, ctxInfo->instanceBuffer);
+    if (size > ctxInfo->instanceBufferSize) {
+        ctxInfo->glBufferData(GL_ARRAY_BUFFER, size, data, GL_STREAM_DRAW);
+        ctxInfo->instanceBufferSize = size;
+    } else {
+        // Orphan the previous contents so the driver does not have to wait
+        // for the draws still reading them
+        ctxInfo->glBufferData(GL_ARRAY_BUFFER, ctxInfo->instanceBufferSize, NULL, GL_STREAM_DRAW);
+        ctxInfo->glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+    }
+    return JNI_TRUE;
+}
 
-    glDrawElements(GL_TRIANGLES, mvInfo->meshInfo->indexBufferSize,
-            mvInfo->meshInfo->indexBufferType, 0);
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nRenderMeshViewInstances
+ * Signature: (JJ[FI)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshViewInstances
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshViewInfo,
+        jfloatArray instanceData, jint count)
+{
+    GLuint index;
+    MeshInfo *mInfo;
+    GLfloat *data;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshViewInfo *mvInfo = (MeshViewInfo *) jlong_to_ptr(nativeMeshViewInfo);
+    if ((ctxInfo == NULL) || (mvInfo == NULL) || (instanceData == NULL) ||
+            (count <= 0) ||
+            (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferData == NULL) ||
+            (ctxInfo->glBufferSubData == NULL) ||
+            (ctxInfo->glDisableVertexAttribArray == NULL) ||
+            (ctxInfo->glEnableVertexAttribArray == NULL) ||
+            (ctxInfo->glVertexAttribPointer == NULL) ||
+            (ctxInfo->glVertexAttrib4fv == NULL)) {
+        return;
+    }
+
+    if ((mvInfo->phongMaterialInfo == NULL) || (mvInfo->meshInfo == NULL) ||
+            ((*env)->GetArrayLength(env, instanceData) < count * INSTANCE_3D_SIZE)) {
+        return;
+    }
+
+    data = (GLfloat *) (*env)->GetPrimitiveArrayCritical(env, instanceData, NULL);
+    if (data == NULL) {
+        fprintf(stderr, "nRenderMeshViewInstances: GetPrimitiveArrayCritical returns NULL: out of memory\n");
+        return;
+    }
+
+    setCullMode(ctxInfo, mvInfo);
+    setPolyonMode(ctxInfo, mvInfo);
+
+    mInfo = mvInfo->meshInfo;
+    if ((ctxInfo->glGenBuffers != NULL) && (ctxInfo->glVertexAttribDivisor != NULL) &&
+            (ctxInfo->glDrawElementsInstanced != NULL) &&
+            uploadInstances(ctxInfo, data, count)) {
+        // The instance buffer is bound, point the per-instance attributes at it
+        for (index = WR0_3D_INDEX; index <= IC_3D_INDEX; index++) {
+            ctxInfo->glEnableVertexAttribArray(index);
+            ctxInfo->glVertexAttribPointer(index, 4, GL_FLOAT, GL_FALSE, INSTANCE_3D_STRIDE,
+                    (const GLvoid *) jlong_to_ptr((jlong) ((index - WR0_3D_INDEX) * 4 * sizeof(GLfloat))));
+            ctxInfo->glVertexAttribDivisor(index, 1);
+        }
+        bindMeshAttributes(ctxInfo, mInfo);
+
+        ctxInfo->glDrawElementsInstanced(GL_TRIANGLES, mInfo->indexBufferSize,
+                mInfo->indexBufferType, 0, count);
+
+        for (index = WR0_3D_INDEX; index <= IC_3D_INDEX; index++) {
+            ctxInfo->glVertexAttribDivisor(index, 0);
+            ctxInfo->glDisableVertexAttribArray(index);
+        }
+    } else {
+        // Without instanced arrays the instance attributes are constant
+        // vertex attributes, still saving the uniform updates of each draw
+        jint i;
+        bindMeshAttributes(ctxInfo, mInfo);
+        for (i = 0; i < count; i++) {
+            GLfloat *instance = data + i * INSTANCE_3D_SIZE;
+            for (index = WR0_3D_INDEX; index <= IC_3D_INDEX; index++) {
+                ctxInfo->glVertexAttrib4fv(index, instance + (index - WR0_3D_INDEX) * 4);
+            }
+            glDrawElements(GL_TRIANGLES, mInfo->indexBufferSize,
+                    mInfo->indexBufferType, 0);
+        }
+    }
+
+    (*env)->ReleasePrimitiveArrayCritical(env, instanceData, data, JNI_ABORT);
 
     // Reset states
-    ctxInfo->glDisableVertexAttribArray(VC_3D_INDEX);
-    ctxInfo->glDisableVertexAttribArray(NC_3D_INDEX);
-    ctxInfo->glDisableVertexAttribArray(TC_3D_INDEX);
-    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
-    ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    unbindMeshAttributes(ctxInfo);
 }
 
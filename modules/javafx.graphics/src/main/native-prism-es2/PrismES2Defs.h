@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -108,6 +108,12 @@ typedef int intptr_t;
 #define ptr_to_jlong(value) (jlong)((intptr_t)(value))
 #endif /* WIN32 */
 
+/* Number of pixel buffer objects texture uploads rotate through */
+#define NUM_UPLOAD_BUFFERS 3
+
+/* Number of fenced segments the streaming vertex buffer is split into */
+#define NUM_VB_RING_SEGMENTS 4
+
 /* platform independent .h files generated by javah */
 #include "com_sun_prism_es2_GLContext.h"
 #include "com_sun_prism_es2_GLFactory.h"
@@ -194,6 +200,12 @@ struct DrawableInfoRec {
 #endif /* __APPLE__ */
 };
 
+/* Number of texture units whose bindings are cached, matches GLContext.java */
+#define NUM_CACHED_TEXTURE_UNITS 4
+
+/* Value of a cached binding that is not known */
+#define UNKNOWN_BINDING 0xFFFFFFFF
+
 /* Typedef for state properties struct */
 typedef struct StateInfoRec StateInfo;
 
@@ -212,6 +224,19 @@ struct StateInfoRec {
 
     /* Currently bound fbo */
     GLuint fbo;
+
+    /*
+     * Shadow copies used to skip redundant state changes. The bindings are
+     * reset to UNKNOWN_BINDING whenever objectGeneration falls behind the
+     * shared counter, since object names may then have been reused.
+     */
+    GLuint objectGeneration;
+    GLuint activeTexture;
+    GLuint boundTextures[NUM_CACHED_TEXTURE_UNITS];
+    GLuint program;
+    GLenum blendSrc;
+    GLenum blendDst;
+    GLint scissorBox[4];
 };
 
 /* Typedef for context properties struct */
@@ -317,6 +342,21 @@ struct ContextInfoRec {
     PFNGLTEXIMAGE2DMULTISAMPLEPROC glTexImage2DMultisample;
     PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
     PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+    /* Optional, used for asynchronous readback when available */
+    PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+    PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+    PFNGLFENCESYNCPROC glFenceSync;
+    PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+    PFNGLDELETESYNCPROC glDeleteSync;
+    /* Optional, used for the program binary cache when available */
+    PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+    PFNGLPROGRAMBINARYPROC glProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
+    jboolean retrieveProgramBinary;
+    /* Optional, used for instanced mesh rendering when available */
+    PFNGLVERTEXATTRIB4FVPROC glVertexAttrib4fv;
+    PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+    PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
 
     /* For state caching */
     StateInfo state;
@@ -326,8 +366,26 @@ struct ContextInfoRec {
     /* see setVertexAttributePointers */
     float *vbFloatData;
     char  *vbByteData;
+
+    /* Streaming vertex buffer for the 2D quad batches, see nDrawIndexedQuads */
+    GLuint vbRingBuffer;
+    GLsizeiptr vbRingSize;
+    GLintptr vbRingOffset;
+    GLsync vbRingFences[NUM_VB_RING_SEGMENTS];
+    jboolean mapVertexRing;
+
+    /* Pixel buffer objects large texture uploads are staged through */
+    GLuint uploadBuffers[NUM_UPLOAD_BUFFERS];
+    GLsizeiptr uploadBufferSizes[NUM_UPLOAD_BUFFERS];
+    GLsync uploadFences[NUM_UPLOAD_BUFFERS];
+    int uploadBufferIndex;
+    jboolean mapUploadBuffers;
     jboolean gl2;
 
+    /* Per-instance attributes of the mesh views drawn as instances */
+    GLuint instanceBuffer;
+    GLsizeiptr instanceBufferSize;
+
     /* Caching properties passed down from Java */
     jboolean vSyncRequested;
 };
@@ -346,11 +404,18 @@ extern void deletePixelFormatInfo(PixelFormatInfo *pfInfo);
 #define VC_3D_INDEX 0
 #define TC_3D_INDEX 1
 #define NC_3D_INDEX 2
+/* The rows of the world matrix and the diffuse color of each instance */
+#define WR0_3D_INDEX 3
+#define WR1_3D_INDEX 4
+#define WR2_3D_INDEX 5
+#define IC_3D_INDEX 6
 #define VC_3D_SIZE 3  /* x, y, z */
 #define TC_3D_SIZE 2  /* tu, tv */
 #define NC_3D_SIZE 4  /* nx, ny, nz, nw */
 #define VERT_3D_SIZE (VC_3D_SIZE + TC_3D_SIZE + NC_3D_SIZE)
 #define VERT_3D_STRIDE (sizeof(GLfloat) * VERT_3D_SIZE)
+#define INSTANCE_3D_SIZE 16
+#define INSTANCE_3D_STRIDE (sizeof(GLfloat) * INSTANCE_3D_SIZE)
 
 #define MESH_VERTEXBUFFER 0
 #define MESH_INDEXBUFFER 1
@@ -363,6 +428,14 @@ struct MeshInfoRec {
     GLuint vboIDArray[MESH_MAX_BUFFERS];
     GLuint indexBufferSize;
     GLenum indexBufferType;
+    // Meshes that are updated get a second vertex buffer, which the next
+    // update is written to while draws may still read the current one
+    GLuint spareVertexBuffer;
+    GLuint vertexBufferSize;
+    // The range of floats the last update wrote to the current vertex
+    // buffer only
+    GLuint staleFrom;
+    GLuint staleTo;
 };
 
 typedef struct PhongMaterialInfoRec PhongMaterialInfo;
@@ -255,6 +255,28 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_IOSGLContext_nInitialize
             getProcAddress("glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             getProcAddress("glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            getProcAddress("glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            getProcAddress("glUnmapBuffer");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+            getProcAddress("glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            getProcAddress("glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+            getProcAddress("glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            getProcAddress("glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            getProcAddress("glProgramBinary");
+    ctxInfo->glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)
+            getProcAddress("glProgramParameteri");
+    ctxInfo->glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)
+            getProcAddress("glVertexAttrib4fv");
+    ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+            getProcAddress("glVertexAttribDivisor");
+    ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+            getProcAddress("glDrawElementsInstanced");
 
     // initialize platform states and properties to match
     // cached states and properties
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -255,6 +255,28 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_MacGLContext_nInitialize
             dlsym(RTLD_DEFAULT, "glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             dlsym(RTLD_DEFAULT, "glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            dlsym(RTLD_DEFAULT, "glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            dlsym(RTLD_DEFAULT, "glUnmapBuffer");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+            dlsym(RTLD_DEFAULT, "glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            dlsym(RTLD_DEFAULT, "glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+            dlsym(RTLD_DEFAULT, "glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT, "glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT, "glProgramBinary");
+    ctxInfo->glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)
+            dlsym(RTLD_DEFAULT, "glProgramParameteri");
+    ctxInfo->glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)
+            dlsym(RTLD_DEFAULT, "glVertexAttrib4fv");
+    ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+            dlsym(RTLD_DEFAULT, "glVertexAttribDivisor");
+    ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+            dlsym(RTLD_DEFAULT, "glDrawElementsInstanced");
 
     // initialize platform states and properties to match
     // cached states and properties
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,7 +36,9 @@
 
 #include "com_sun_prism_es2_MonocleGLContext.h"
 #ifndef ANDROID
+#ifndef __USE_GNU
 #define __USE_GNU
+#endif
 #include <dlfcn.h>
 #endif
 
@@ -217,9 +219,31 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_MonocleGLFactory_nPopulateNativeC
                             GET_DLSYM(handle, "glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
                             GET_DLSYM(handle, "glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+                            GET_DLSYM(handle, "glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+                            GET_DLSYM(handle, "glUnmapBuffer");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+                            GET_DLSYM(handle, "glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+                            GET_DLSYM(handle, "glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+                            GET_DLSYM(handle, "glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                            GET_DLSYM(handle, "glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                            GET_DLSYM(handle, "glProgramBinary");
+    ctxInfo->glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)
+                            GET_DLSYM(handle, "glProgramParameteri");
+    ctxInfo->glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)
+                            GET_DLSYM(handle, "glVertexAttrib4fv");
+    ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+                            GET_DLSYM(handle, "glVertexAttribDivisor");
+    ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+                            GET_DLSYM(handle, "glDrawElementsInstanced");
 
     initState(ctxInfo);
-    return ctxInfo;
+    return asJLong(ctxInfo);
 }
 
 /*
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -280,6 +280,28 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_WinGLContext_nInitialize
             wglGetProcAddress("glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             wglGetProcAddress("glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            wglGetProcAddress("glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            wglGetProcAddress("glUnmapBuffer");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+            wglGetProcAddress("glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            wglGetProcAddress("glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+            wglGetProcAddress("glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            wglGetProcAddress("glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            wglGetProcAddress("glProgramBinary");
+    ctxInfo->glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)
+            wglGetProcAddress("glProgramParameteri");
+    ctxInfo->glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)
+            wglGetProcAddress("glVertexAttrib4fv");
+    ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+            wglGetProcAddress("glVertexAttribDivisor");
+    ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+            wglGetProcAddress("glDrawElementsInstanced");
 
     if (isExtensionSupported(ctxInfo->wglExtensionStr,
             "WGL_EXT_swap_control")) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -111,20 +111,11 @@ Java_com_sun_pisces_AbstractSurface_getRGBImpl(JNIEnv* env, jobject objectHandle
         if (dstData != NULL) {
             jint* src;
             jint* dst;
-            jint srcScanRest = surface->width - width;
-            jint dstScanRest = scanLength - width;
 
             ACQUIRE_SURFACE(surface, env, objectHandle);
-            src = (jint*)surface->data + y * surface->width + x;
+            src = (jint*)surface->data + y * surface->scanlineStride + x;
             dst = dstData + dstStart;
-            for (; height > 0; --height) {
-                jint w2 = width;
-                for (; w2 > 0; --w2) {
-                    *dst++ = *src++;
-                }
-                src += srcScanRest;
-                dst += dstScanRest;
-            }
+            copyRows(dst, scanLength, src, surface->scanlineStride, width, height);
             RELEASE_SURFACE(surface, env, objectHandle);
 
             if (JNI_TRUE == readAndClearMemErrorFlag()) {
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <JAbstractSurface.h>
+
+#include <PiscesUtil.h>
+#include <PiscesSysutils.h>
+#include <JNIUtil.h>
+#include <com_sun_pisces_NativeSurface.h>
+
+#define SURFACE_NATIVE_PTR 0
+#define SURFACE_LAST SURFACE_NATIVE_PTR
+
+/* Alignment of surface memory allocated here, in bytes */
+#define SURFACE_ALIGNMENT 64
+
+static jfieldID fieldIds[SURFACE_LAST + 1];
+static jboolean fieldIdsInitialized = JNI_FALSE;
+
+static jboolean initializeSurfaceFieldIds(JNIEnv *env, jobject objectHandle);
+
+static void surface_acquire(AbstractSurface* surface, JNIEnv* env, jobject surfaceHandle);
+static void surface_release(AbstractSurface* surface, JNIEnv* env,  jobject surfaceHandle);
+static void surface_cleanup(AbstractSurface* surface);
+
+/*
+ * The pixels of a NativeSurface never move, so acquiring and releasing it
+ * is free. Memory provided by Java is kept alive by the Java object.
+ */
+typedef struct _NativeSurface {
+    AbstractSurface super;
+    jboolean ownsData;
+} NativeSurface;
+
+static NativeSurface*
+createSurface(JNIEnv *env, jobject objectHandle, void* data, jboolean ownsData,
+              jint dataType, jint width, jint height, jint scanlineStride)
+{
+    NativeSurface* nSurface;
+    AbstractSurface* surface;
+
+    if (!surface_initialize(env, objectHandle)
+            || !initializeSurfaceFieldIds(env, objectHandle))
+    {
+        JNI_ThrowNew(env, "java/lang/IllegalStateException", "");
+        return NULL;
+    }
+    if (dataType != TYPE_INT_ARGB_PRE) {
+        JNI_ThrowNew(env, "java/lang/IllegalArgumentException", "Unsupported surface type");
+        return NULL;
+    }
+
+    nSurface = my_malloc(NativeSurface, 1);
+    if (nSurface == NULL) {
+        JNI_ThrowNew(env, "java/lang/OutOfMemoryError",
+                     "Allocation of internal renderer buffer failed.");
+        return NULL;
+    }
+    surface = &nSurface->super;
+    surface->super.width = width;
+    surface->super.height = height;
+    surface->super.offset = 0;
+    surface->super.scanlineStride = scanlineStride;
+    surface->super.pixelStride = 1;
+    surface->super.imageType = dataType;
+    surface->super.data = data;
+
+    surface->acquire = surface_acquire;
+    surface->release = surface_release;
+    surface->cleanup = surface_cleanup;
+    nSurface->ownsData = ownsData;
+
+    (*env)->SetLongField(env, objectHandle, fieldIds[SURFACE_NATIVE_PTR],
+                         PointerToJLong(nSurface));
+    return nSurface;
+}
+
+/*
+ * Class:     com_sun_pisces_NativeSurface
+ * Method:    initialize
+ * Signature: (IIII)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL
+Java_com_sun_pisces_NativeSurface_initialize
+  (JNIEnv *env, jobject objectHandle, jint dataType, jint width, jint height,
+   jint scanlineStride)
+{
+    NativeSurface* nSurface;
+    jobject buffer;
+    // allocate at least one pixel so that empty surfaces get a valid buffer
+    size_t size = (size_t)MAX(scanlineStride * height, 1) * sizeof(jint);
+    void* data = PISCESaligned_malloc(size, SURFACE_ALIGNMENT);
+
+    if (data == NULL) {
+        JNI_ThrowNew(env, "java/lang/OutOfMemoryError",
+                     "Allocation of surface memory failed.");
+        return NULL;
+    }
+    PISCESclear_mem(data, size);
+
+    nSurface = createSurface(env, objectHandle, data, JNI_TRUE,
+                             dataType, width, height, scanlineStride);
+    if (nSurface == NULL) {
+        PISCESaligned_free(data);
+        return NULL;
+    }
+
+    buffer = (*env)->NewDirectByteBuffer(env, data, (jlong)size);
+    if (buffer == NULL) {
+        // the Java object never registers a disposer in this case
+        (*env)->SetLongField(env, objectHandle, fieldIds[SURFACE_NATIVE_PTR],
+                             PointerToJLong(NULL));
+        surface_cleanup(&nSurface->super);
+        my_free(nSurface);
+        if (!(*env)->ExceptionCheck(env)) {
+            JNI_ThrowNew(env, "java/lang/UnsupportedOperationException",
+                         "Direct buffers are not supported.");
+        }
+    }
+    return buffer;
+}
+
+/*
+ * Class:     com_sun_pisces_NativeSurface
+ * Method:    initializeShared
+ * Signature: (Ljava/nio/ByteBuffer;IIII)V
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_pisces_NativeSurface_initializeShared
+  (JNIEnv *env, jobject objectHandle, jobject buffer, jint dataType,
+   jint width, jint height, jint scanlineStride)
+{
+    void* data = (*env)->GetDirectBufferAddress(env, buffer);
+
+    if (data == NULL) {
+        JNI_ThrowNew(env, "java/lang/IllegalArgumentException",
+                     "Buffer is not a direct buffer");
+        return;
+    }
+    if (((size_t)data & (sizeof(jint) - 1)) != 0) {
+        JNI_ThrowNew(env, "java/lang/IllegalArgumentException",
+                     "Buffer is not aligned to pixels");
+        return;
+    }
+    createSurface(env, objectHandle, data, JNI_FALSE,
+                  dataType, width, height, scanlineStride);
+}
+
+static jboolean
+initializeSurfaceFieldIds(JNIEnv* env, jobject objectHandle) {
+    static const FieldDesc surfaceFieldDesc[] = {
+                { "nativePtr", "J" },
+                { NULL, NULL }
+            };
+
+    jboolean retVal;
+    jclass classHandle;
+
+    if (fieldIdsInitialized) {
+        return JNI_TRUE;
+    }
+
+    retVal = JNI_FALSE;
+
+    classHandle = (*env)->GetObjectClass(env, objectHandle);
+
+    if (initializeFieldIds(fieldIds, env, classHandle, surfaceFieldDesc)) {
+        retVal = JNI_TRUE;
+        fieldIdsInitialized = JNI_TRUE;
+    }
+
+    return retVal;
+}
+
+static void
+surface_acquire(AbstractSurface* surface, JNIEnv* env, jobject surfaceHandle) {
+    // the pixels are always accessible
+}
+
+static void
+surface_release(AbstractSurface* surface, JNIEnv* env, jobject surfaceHandle) {
+    // nothing to unpin
+}
+
+static void
+surface_cleanup(AbstractSurface* surface) {
+    if (((NativeSurface *) surface)->ownsData) {
+        PISCESaligned_free(surface->super.data);
+    }
+    surface->super.data = NULL;
+}
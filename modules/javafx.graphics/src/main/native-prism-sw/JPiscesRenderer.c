@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,7 +29,9 @@
 #include <JPiscesRenderer.h>
 #include <JTransform.h>
 
+#include <PiscesBands.h>
 #include <PiscesBlit.h>
+#include <PiscesBlitSIMD.h>
 #include <PiscesSysutils.h>
 
 #include <PiscesRenderer.inl>
@@ -68,6 +70,7 @@ Java_com_sun_pisces_PiscesRenderer_initialize(JNIEnv* env, jobject objectHandle)
                                 fieldIds[RENDERER_SURFACE]);
         surface = &surface_get(env, surfaceHandle)->super;
 
+        initBlitKernels();
         rdr = renderer_create(surface);
 
         (*env)->SetLongField(env, objectHandle, fieldIds[RENDERER_NATIVE_PTR],
@@ -91,6 +94,18 @@ Java_com_sun_pisces_PiscesRenderer_disposeNative(JNIEnv *env, jclass cls, jlong
     }
 }
 
+JNIEXPORT jboolean JNICALL
+Java_com_sun_pisces_PiscesRenderer_setSIMDEnabledImpl(JNIEnv *env, jclass cls, jboolean enabled)
+{
+    return selectBlitKernels(enabled);
+}
+
+JNIEXPORT jint JNICALL
+Java_com_sun_pisces_PiscesRenderer_setBandThreadsImpl(JNIEnv *env, jclass cls, jint threads)
+{
+    return bands_setThreads(threads);
+}
+
 JNIEXPORT void JNICALL
 Java_com_sun_pisces_PiscesRenderer_setClipImpl(JNIEnv* env, jobject objectHandle,
         jint minX, jint minY, jint width, jint height) {
@@ -156,7 +171,7 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_clearRectImpl(JNIEnv*
     INVALIDATE_RENDERER_SURFACE(rdr);
 
     rdr->_imagePixelStride = 1;
-    rdr->_imageScanlineStride = surface->width;
+    rdr->_imageScanlineStride = surface->scanlineStride;
     renderer_clearRect(rdr, x, y, w, h);
 
     RELEASE_SURFACE(surface, env, surfaceHandle);
@@ -368,13 +383,34 @@ toPiscesCoords(unsigned int ff) {
     return (int)gg;
 }
 
+/*
+ * Prepares a copy of rdr that renders the rows minY to maxY with its own
+ * paint buffer and shares everything else with rdr. It must be released
+ * with endBand.
+ */
 static void
-fillRect(JNIEnv *env, jobject this, Renderer* rdr,
+beginBand(Renderer* band, Renderer* rdr, jint minY, jint maxY)
+{
+    *band = *rdr;
+    band->_clip_bbMinY = MAX(rdr->_clip_bbMinY, minY);
+    band->_clip_bbMaxY = MIN(rdr->_clip_bbMaxY, maxY);
+    band->_paint = NULL;
+    band->_paint_length = 0;
+    band->_mask_free = JNI_FALSE;
+    band->_texture_free = JNI_FALSE;
+}
+
+static void
+endBand(Renderer* band)
+{
+    my_free(band->_paint);
+}
+
+static void
+fillRectRows(Renderer* rdr, Surface* surface,
     jint x, jint y, jint w, jint h,
     jint lEdge, jint rEdge, jint tEdge, jint bEdge)
 {
-    Surface* surface;
-    jobject surfaceHandle;
     jint x_from, x_to, y_from, y_to;
     jint lfrac, rfrac, tfrac, bfrac;
     jint rows_to_render_by_loop, rows_being_rendered;
@@ -455,11 +491,6 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
     if ((x_from <= x_to) && (y_from <= y_to)) {
         rows_to_render_by_loop = y_to - y_from + 1;
 
-        SURFACE_FROM_RENDERER(surface, env, surfaceHandle, this);
-        ACQUIRE_SURFACE(surface, env, surfaceHandle);
-        INVALIDATE_RENDERER_SURFACE(rdr);
-        VALIDATE_BLITTING(rdr);
-
         rdr->_minTouched = x_from;
         rdr->_maxTouched = x_to;
         rdr->_currX = x_from;
@@ -467,8 +498,8 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
 
         rdr->_alphaWidth = x_to - x_from + 1;
 
-        rdr->_currImageOffset = y_from * surface->width;
-        rdr->_imageScanlineStride = surface->width;
+        rdr->_currImageOffset = y_from * surface->scanlineStride;
+        rdr->_imageScanlineStride = surface->scanlineStride;
         rdr->_imagePixelStride = 1;
         rdr->_rowNum = 0;
 
@@ -502,7 +533,7 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
             rows_to_render_by_loop--;
             rdr->_currX = x_from;
             rdr->_currY++;
-            rdr->_currImageOffset = rdr->_currY * surface->width;
+            rdr->_currImageOffset = rdr->_currY * surface->scanlineStride;
             rdr->_rowNum++;
         }
 
@@ -520,7 +551,7 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
             rows_to_render_by_loop -= rows_being_rendered;
             rdr->_currX = x_from;
             rdr->_currY += rows_being_rendered;
-            rdr->_currImageOffset = rdr->_currY * surface->width;
+            rdr->_currImageOffset = rdr->_currY * surface->scanlineStride;
             rdr->_rowNum += rows_being_rendered;
         }
 
@@ -533,12 +564,75 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
             }
             rdr->_emitLine(rdr, 1, bfrac);
         }
-        RELEASE_SURFACE(surface, env, surfaceHandle);
+    }
+}
 
-        if (JNI_TRUE == readAndClearMemErrorFlag()) {
-            JNI_ThrowNew(env, "java/lang/OutOfMemoryError",
-                "Allocation of internal renderer buffer failed.");
-        }
+typedef struct _FillRectArgs {
+    Renderer* rdr;
+    Surface* surface;
+    jint x, y, w, h;
+    jint lEdge, rEdge, tEdge, bEdge;
+    jint minY, maxY;
+} FillRectArgs;
+
+static void
+fillRectBand(void *arg, jint minY, jint maxY)
+{
+    FillRectArgs* a = (FillRectArgs*)arg;
+
+    if (minY == a->minY && maxY == a->maxY) {
+        fillRectRows(a->rdr, a->surface, a->x, a->y, a->w, a->h,
+            a->lEdge, a->rEdge, a->tEdge, a->bEdge);
+    } else {
+        Renderer band;
+        beginBand(&band, a->rdr, minY, maxY);
+        fillRectRows(&band, a->surface, a->x, a->y, a->w, a->h,
+            a->lEdge, a->rEdge, a->tEdge, a->bEdge);
+        endBand(&band);
+    }
+}
+
+static void
+fillRect(JNIEnv *env, jobject this, Renderer* rdr,
+    jint x, jint y, jint w, jint h,
+    jint lEdge, jint rEdge, jint tEdge, jint bEdge)
+{
+    Surface* surface;
+    jobject surfaceHandle;
+    FillRectArgs args;
+    jint minX, maxX;
+
+    // the rows and columns the rectangle may touch, refined by fillRectRows
+    minX = MAX(x >> 16, rdr->_clip_bbMinX);
+    maxX = MIN((x + w) >> 16, rdr->_clip_bbMaxX);
+    args.minY = MAX(y >> 16, rdr->_clip_bbMinY);
+    args.maxY = MIN((y + h) >> 16, rdr->_clip_bbMaxY);
+    if (minX > maxX || args.minY > args.maxY) {
+        return;
+    }
+
+    SURFACE_FROM_RENDERER(surface, env, surfaceHandle, this);
+    ACQUIRE_SURFACE(surface, env, surfaceHandle);
+    INVALIDATE_RENDERER_SURFACE(rdr);
+    VALIDATE_BLITTING(rdr);
+
+    args.rdr = rdr;
+    args.surface = surface;
+    args.x = x;
+    args.y = y;
+    args.w = w;
+    args.h = h;
+    args.lEdge = lEdge;
+    args.rEdge = rEdge;
+    args.tEdge = tEdge;
+    args.bEdge = bEdge;
+    bands_render(fillRectBand, &args, args.minY, args.maxY, maxX - minX + 1);
+
+    RELEASE_SURFACE(surface, env, surfaceHandle);
+
+    if (JNI_TRUE == readAndClearMemErrorFlag()) {
+        JNI_ThrowNew(env, "java/lang/OutOfMemoryError",
+            "Allocation of internal renderer buffer failed.");
     }
 }
 
@@ -604,8 +698,8 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_emitAndClearAlphaRowIm
                 rdr->_rowAAInt = alphaRow + x_off; /* add offset in alpha buffer */
                 rdr->_alphaWidth = x_to - x_from + 1;
 
-                rdr->_currImageOffset = y * surface->width;
-                rdr->_imageScanlineStride = surface->width;
+                rdr->_currImageOffset = y * surface->scanlineStride;
+                rdr->_imageScanlineStride = surface->scanlineStride;
                 rdr->_imagePixelStride = 1;
 
                 if (rdr->_genPaint) {
@@ -785,12 +879,77 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_fillLCDAlphaMaskImpl
         x, y, maskWidth, maskHeight, maskOffset, stride);
 }
 
+typedef struct _FillAlphaMaskArgs {
+    Renderer* rdr;
+    Surface* surface;
+    jint minX, minY, maxX, maxY;
+    jint x, maskWidth, offset;
+} FillAlphaMaskArgs;
+
+static void
+fillAlphaMaskRows(Renderer* rdr, Surface* surface, jint minX, jint minY, jint maxX, jint maxY,
+    jint x, jint maskWidth, jint offset)
+{
+    jint rowsToBeRendered, rowsBeingRendered;
+    jint width = maxX - minX + 1;
+    jint height = maxY - minY + 1;
+
+    rdr->_minTouched = minX;
+    rdr->_maxTouched = maxX;
+    rdr->_currX = minX;
+    rdr->_currY = minY;
+
+    rdr->_alphaWidth = width;
+
+    rdr->_imageScanlineStride = surface->scanlineStride;
+    rdr->_imagePixelStride = 1;
+    rdr->_rowNum = 0;
+    rdr->_maskOffset = offset;
+
+    rowsToBeRendered = height;
+
+    while (rowsToBeRendered > 0) {
+        rowsBeingRendered = 1; //MIN(rowsToBeRendered, NUM_ALPHA_ROWS);
+
+        rdr->_currImageOffset = rdr->_currY * surface->scanlineStride;
+        if (rdr->_genPaint) {
+            size_t l = (width * rowsBeingRendered);
+            ALLOC3(rdr->_paint, jint, l);
+            rdr->_genPaint(rdr, rowsBeingRendered);
+        }
+        rdr->_emitRows(rdr, rowsBeingRendered);
+
+        rdr->_maskOffset += maskWidth;
+        rdr->_rowNum += rowsBeingRendered;
+        rowsToBeRendered -= rowsBeingRendered;
+        rdr->_currX = x;
+        rdr->_currY += rowsBeingRendered;
+    }
+}
+
+static void
+fillAlphaMaskBand(void *arg, jint minY, jint maxY)
+{
+    FillAlphaMaskArgs* a = (FillAlphaMaskArgs*)arg;
+    // the mask offset advances by the mask width, not its stride, per row
+    jint offset = a->offset + (minY - a->minY) * a->maskWidth;
+
+    if (minY == a->minY && maxY == a->maxY) {
+        fillAlphaMaskRows(a->rdr, a->surface, a->minX, minY, a->maxX, maxY,
+            a->x, a->maskWidth, offset);
+    } else {
+        Renderer band;
+        beginBand(&band, a->rdr, minY, maxY);
+        fillAlphaMaskRows(&band, a->surface, a->minX, minY, a->maxX, maxY,
+            a->x, a->maskWidth, offset);
+        endBand(&band);
+    }
+}
+
 static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint maxY,
     JNIEnv *env, jobject this, jint maskType, jbyteArray jmask,
     jint x, jint y, jint maskWidth, jint maskHeight, jint offset, jint stride)
 {
-    jint rowsToBeRendered, rowsBeingRendered;
-
     Surface* surface;
     jobject surfaceHandle;
 
@@ -803,45 +962,23 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
 
         mask = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, jmask, NULL);
         if (mask != NULL) {
-            jint width = maxX - minX + 1;
-            jint height = maxY - minY + 1;
+            FillAlphaMaskArgs args;
 
             renderer_setMask(rdr, maskType, mask, maskWidth, maskHeight, JNI_FALSE);
 
             INVALIDATE_RENDERER_SURFACE(rdr);
             VALIDATE_BLITTING(rdr);
 
-            rdr->_minTouched = minX;
-            rdr->_maxTouched = maxX;
-            rdr->_currX = minX;
-            rdr->_currY = minY;
-
-            rdr->_alphaWidth = width;
-
-            rdr->_imageScanlineStride = surface->width;
-            rdr->_imagePixelStride = 1;
-            rdr->_rowNum = 0;
-            rdr->_maskOffset = offset;
-
-            rowsToBeRendered = height;
-
-            while (rowsToBeRendered > 0) {
-                rowsBeingRendered = 1; //MIN(rowsToBeRendered, NUM_ALPHA_ROWS);
-
-                rdr->_currImageOffset = rdr->_currY * surface->width;
-                if (rdr->_genPaint) {
-                    size_t l = (width * rowsBeingRendered);
-                    ALLOC3(rdr->_paint, jint, l);
-                    rdr->_genPaint(rdr, rowsBeingRendered);
-                }
-                rdr->_emitRows(rdr, rowsBeingRendered);
-
-                rdr->_maskOffset += maskWidth;
-                rdr->_rowNum += rowsBeingRendered;
-                rowsToBeRendered -= rowsBeingRendered;
-                rdr->_currX = x;
-                rdr->_currY += rowsBeingRendered;
-            }
+            args.rdr = rdr;
+            args.surface = surface;
+            args.minX = minX;
+            args.minY = minY;
+            args.maxX = maxX;
+            args.maxY = maxY;
+            args.x = x;
+            args.maskWidth = maskWidth;
+            args.offset = offset;
+            bands_render(fillAlphaMaskBand, &args, minY, maxY, maxX - minX + 1);
 
             renderer_removeMask(rdr);
             (*env)->ReleasePrimitiveArrayCritical(env, jmask, mask, 0);
@@ -857,4 +994,3 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
         }
     }
 }
-
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <PiscesBands.h>
+#include <PiscesUtil.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+// Bands smaller than this are not worth handing to another thread
+#define MIN_BAND_PIXELS (64 * 1024)
+#define MIN_BAND_ROWS 8
+#define MAX_BAND_THREADS 64
+
+static jint bandThreads = 1;
+
+#ifndef _WIN32
+
+static pthread_mutex_t bandLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t bandWork = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t bandDone = PTHREAD_COND_INITIALIZER;
+// serializes bands_render callers
+static pthread_mutex_t jobLock = PTHREAD_MUTEX_INITIALIZER;
+
+static jint workerCount = 0;
+
+// The current job, guarded by bandLock
+static BandRenderer jobRender;
+static void *jobArg;
+static jint jobMinY, jobMaxY, jobBandHeight, jobBands;
+static jint jobNext, jobPending;
+static jint jobGeneration = 0;
+
+/* Renders bands of the current job until none are left. Called with bandLock held. */
+static void
+renderBands() {
+    while (jobNext < jobBands) {
+        jint band = jobNext++;
+        jint minY = jobMinY + band * jobBandHeight;
+        jint maxY = MIN(minY + jobBandHeight - 1, jobMaxY);
+        BandRenderer render = jobRender;
+        void *arg = jobArg;
+
+        pthread_mutex_unlock(&bandLock);
+        render(arg, minY, maxY);
+        pthread_mutex_lock(&bandLock);
+
+        if (--jobPending == 0) {
+            pthread_cond_signal(&bandDone);
+        }
+    }
+}
+
+static void *
+bandWorker(void *UNUSED(arg)) {
+    jint seen;
+
+    pthread_mutex_lock(&bandLock);
+    seen = jobGeneration;
+    for (;;) {
+        while (jobGeneration == seen) {
+            pthread_cond_wait(&bandWork, &bandLock);
+        }
+        seen = jobGeneration;
+        renderBands();
+    }
+    return NULL;
+}
+
+void
+bands_render(BandRenderer render, void *arg, jint minY, jint maxY, jint width) {
+    jint rows = maxY - minY + 1;
+    jint bands = bandThreads;
+
+    if (bands > 1 && width > 0) {
+        bands = MIN(bands, rows / MIN_BAND_ROWS);
+        bands = MIN(bands, (jint)(((jlong)rows * width) / MIN_BAND_PIXELS));
+    }
+    if (bands <= 1) {
+        render(arg, minY, maxY);
+        return;
+    }
+
+    pthread_mutex_lock(&jobLock);
+    pthread_mutex_lock(&bandLock);
+    jobRender = render;
+    jobArg = arg;
+    jobMinY = minY;
+    jobMaxY = maxY;
+    jobBandHeight = (rows + bands - 1) / bands;
+    jobBands = (rows + jobBandHeight - 1) / jobBandHeight;
+    jobNext = 0;
+    jobPending = jobBands;
+    jobGeneration++;
+    pthread_cond_broadcast(&bandWork);
+
+    renderBands();
+    while (jobPending > 0) {
+        pthread_cond_wait(&bandDone, &bandLock);
+    }
+    pthread_mutex_unlock(&bandLock);
+    pthread_mutex_unlock(&jobLock);
+}
+
+jint
+bands_setThreads(jint threads) {
+    threads = MAX(1, MIN(threads, MAX_BAND_THREADS));
+
+    pthread_mutex_lock(&jobLock);
+    // Workers are never stopped; surplus ones just find no bands left
+    while (workerCount < threads - 1) {
+        pthread_t thread;
+        pthread_attr_t attr;
+        jint rc;
+
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        rc = pthread_create(&thread, &attr, bandWorker, NULL);
+        pthread_attr_destroy(&attr);
+        if (rc != 0) {
+            break;
+        }
+        workerCount++;
+    }
+    bandThreads = workerCount + 1 < threads ? workerCount + 1 : threads;
+    pthread_mutex_unlock(&jobLock);
+
+    return bandThreads;
+}
+
+#else
+
+void
+bands_render(BandRenderer render, void *arg, jint minY, jint maxY, jint UNUSED(width)) {
+    render(arg, minY, maxY);
+}
+
+jint
+bands_setThreads(jint UNUSED(threads)) {
+    return bandThreads;
+}
+
+#endif
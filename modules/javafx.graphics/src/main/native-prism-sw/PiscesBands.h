@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef PISCES_BANDS_H
+#define PISCES_BANDS_H
+
+#include <PiscesDefs.h>
+
+/**
+ * Renders the rows minY to maxY (inclusive) of one horizontal band.
+ */
+typedef void (*BandRenderer)(void *arg, jint minY, jint maxY);
+
+/**
+ * Splits the rows minY to maxY of an area width pixels wide into horizontal
+ * bands, renders them in parallel on the band worker pool and returns once
+ * all of them are done. Small areas, and all areas while the pool has a
+ * single thread, are rendered as one band on the calling thread.
+ */
+void bands_render(BandRenderer render, void *arg, jint minY, jint maxY, jint width);
+
+/**
+ * Sets the number of threads, including the calling one, that render the
+ * bands and returns the number in use, which is 1 where threads are not
+ * supported.
+ */
+jint bands_setThreads(jint threads);
+
+#endif
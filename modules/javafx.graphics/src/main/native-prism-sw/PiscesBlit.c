@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,6 +24,7 @@
  */
 
 #include <PiscesBlit.h>
+#include <PiscesBlitSIMD.h>
 
 #include <PiscesUtil.h>
 #include <PiscesRenderer.h>
@@ -36,6 +37,8 @@
 #define HALF_ALPHA (MAX_ALPHA >> 1)
 #define ALPHA_SHIFT 8
 #define HALF_1_SHIFT_23 (jint)(1L << 23)
+// pixels handed to the vectorized loops at a time
+#define BLIT_CHUNK 256
 
 static jfloat currentGamma = -1;
 static jint gammaArray[256];
@@ -245,6 +248,10 @@ emitLineSourceOver8888_pre(Renderer *rdr, jint height, jint frac) {
                 a += imagePixelStride;
             }
             am = a + w;
+            if (blitKernels != NULL && imagePixelStride == 1 && w > 0) {
+                blitKernels->fill(a, w, solid_pixel);
+                a = am;
+            }
             while (a < am) {
                 *a = solid_pixel;
                 a += imagePixelStride;
@@ -257,6 +264,12 @@ emitLineSourceOver8888_pre(Renderer *rdr, jint height, jint frac) {
     } else {
         jint lalpha = (lfrac * alpha) >> 16;
         jint ralpha = (rfrac * alpha) >> 16;
+        jint avals[BLIT_CHUNK];
+        jint pixel = 0xFF000000 | (cred << 16) | (cgreen << 8) | cblue;
+        jint x, n;
+        if (blitKernels != NULL && imagePixelStride == 1) {
+            blitKernels->fill(avals, MIN(w, BLIT_CHUNK), alpha);
+        }
         for (j = 0; j < height; j++) {
             iidx = imageOffset + minX * imagePixelStride;
             a = intData + iidx;
@@ -265,6 +278,13 @@ emitLineSourceOver8888_pre(Renderer *rdr, jint height, jint frac) {
                 a += imagePixelStride;
             }
             am = a + w;
+            if (blitKernels != NULL && imagePixelStride == 1 && w > 0) {
+                for (x = 0; x < w; x += n) {
+                    n = MIN(w - x, BLIT_CHUNK);
+                    blitKernels->srcOverColor(a + x, avals, n, pixel);
+                }
+                a = am;
+            }
             while (a < am) {
                 blendSrcOver8888_pre(a, alpha, cred, cgreen, cblue);
                 a += imagePixelStride;
@@ -579,6 +599,30 @@ blitSrcOver8888_pre(Renderer *rdr, jint height) {
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
 
+    if (blitKernels != NULL && imagePixelStride == 1) {
+        jint sums[BLIT_CHUNK];
+        jint avals[BLIT_CHUNK];
+        jint pixel = 0xff000000 | (cred << 16) | (cgreen << 8) | cblue;
+        jint x, n, i;
+        for (j = 0; j < height; j++) {
+            aval_relative = 0;
+            for (x = 0; x < w; x += n) {
+                n = MIN(w - x, BLIT_CHUNK);
+                aval_relative = blitKernels->accumulate(alpha + x, sums, n,
+                                                        aval_relative);
+                for (i = 0; i < n; i++) {
+                    avals[i] = sums[i]
+                        ? (((alphaMap[sums[i]] & 0xff) + 1) * calpha) >> 8
+                        : 0;
+                }
+                blitKernels->srcOverColor(intData + imageOffset + minX + x,
+                                          avals, n, pixel);
+            }
+            imageOffset += imageScanlineStride;
+        }
+        return;
+    }
+
     for (j = 0; j < height; j++) {
         iidx = imageOffset + minX * imagePixelStride;
 
@@ -630,6 +674,28 @@ blitSrcOverMask8888_pre(Renderer *rdr, jint height) {
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
 
+    if (blitKernels != NULL && imagePixelStride == 1) {
+        jint avals[BLIT_CHUNK];
+        jint pixel = 0xff000000 | (cred << 16) | (cgreen << 8) | cblue;
+        jint x, n, i;
+        for (j = 0; j < height; j++) {
+            a = alpha + alphaOffset;
+            for (x = 0; x < w; x += n) {
+                n = MIN(w - x, BLIT_CHUNK);
+                for (i = 0; i < n; i++) {
+                    avals[i] = a[x + i]
+                        ? (((a[x + i] & 0xff) + 1) * calpha) >> 8
+                        : 0;
+                }
+                blitKernels->srcOverColor(intData + imageOffset + minX + x,
+                                          avals, n, pixel);
+            }
+            imageOffset += imageScanlineStride;
+            alphaOffset += alphaStride;
+        }
+        return;
+    }
+
     for (j = 0; j < height; j++) {
         iidx = imageOffset + minX * imagePixelStride;
 
@@ -733,6 +799,27 @@ blitPTSrcOver8888_pre(Renderer *rdr, jint height) {
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
 
+    if (blitKernels != NULL && imagePixelStride == 1) {
+        jint sums[BLIT_CHUNK];
+        jint fracs[BLIT_CHUNK];
+        jint x, n, i;
+        for (j = 0; j < height; j++) {
+            aval_relative = 0;
+            for (x = 0; x < w; x += n) {
+                n = MIN(w - x, BLIT_CHUNK);
+                aval_relative = blitKernels->accumulate(alpha + x, sums, n,
+                                                        aval_relative);
+                for (i = 0; i < n; i++) {
+                    fracs[i] = sums[i] ? (alphaMap[sums[i]] & 0xff) + 1 : 0;
+                }
+                blitKernels->srcOverPaint(intData + imageOffset + minX + x,
+                                          paint + x, fracs, n);
+            }
+            imageOffset += imageScanlineStride;
+        }
+        return;
+    }
+
     for (j = 0; j < height; j++) {
         aidx = 0;
         iidx = imageOffset + minX * imagePixelStride;
@@ -831,7 +918,7 @@ clearRect8888_any(Renderer *rdr, jint x, jint y, jint w, jint h) {
 
     if (cval == 0) {
         int size = sizeof(jint) * w;
-        if (x == 0 && w == rdr->_width) {
+        if (x == 0 && w == rdr->_imageScanlineStride) {
             //printf("full clear 8888 ZERO, x: %d, y: %d, w: %d, h: %d\n", x, y, w, h);
             memset(intData, 0, size * h);
         } else {
@@ -845,8 +932,12 @@ clearRect8888_any(Renderer *rdr, jint x, jint y, jint w, jint h) {
         //printf("clear 8888, x: %d, y: %d, w: %d, h: %d\n", x, y, w, h);
         int size = sizeof(jint) * w;
         //set first scanline to cval
-        while(intData2 < intData2End) {
-            *intData2++ = cval;
+        if (blitKernels != NULL) {
+            blitKernels->fill(intData2, w, cval);
+        } else {
+            while(intData2 < intData2End) {
+                *intData2++ = cval;
+            }
         }
         //set to starting pixel again
         intData2 = intData;
@@ -0,0 +1,937 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <PiscesBlitSIMD.h>
+#include <PiscesRenderer.h>
+#include <PiscesSysutils.h>
+
+#include <float.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PISCES_SIMD_X86
+#include <immintrin.h>
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(__aarch64__)
+#define PISCES_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/*
+ * The gradient kernels advance the positions in single precision, one pixel
+ * after the other as the scalar loops do, and only vectorize the conversion,
+ * the square root and the color lookup. With x87 arithmetic the scalar loops
+ * keep the positions in extended precision, so the kernels are left out.
+ */
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#define PISCES_SIMD_GRADIENTS
+#define GRADIENT_KERNEL(kernel) kernel
+#else
+#define GRADIENT_KERNEL(kernel) NULL
+#endif
+
+/*
+ * The blends work on 16 bit lanes. Every product and sum in the scalar code
+ * stays below 65536 and div255(x) = (x * 257 + 257) >> 16 equals
+ * (y + (y >> 8)) >> 8 with y = x + 1, so the results are bit-exact.
+ */
+
+const BlitKernels *blitKernels = NULL;
+static jboolean blitKernelsSelected = JNI_FALSE;
+
+/*
+ * Scalar versions of the paint generator steps, used for the pixels left
+ * over after the last full vector. They must match PiscesPaint.c.
+ */
+
+#ifdef PISCES_SIMD_GRADIENTS
+static INLINE jint
+gradientPixel(jint ifrac, jint cycleMethod, const jint *colors) {
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        if (ifrac < 0) {
+            ifrac = 0;
+        } else if (ifrac > 0xffff) {
+            ifrac = 0xffff;
+        }
+        break;
+    case CYCLE_REPEAT:
+        ifrac &= 0xffff;
+        break;
+    case CYCLE_REFLECT:
+        if (ifrac < 0) {
+            ifrac = -ifrac;
+        }
+        ifrac &= 0x1ffff;
+        if (ifrac > 0xffff) {
+            ifrac = 0x1ffff - ifrac;
+        }
+        break;
+    }
+    return colors[ifrac >> (16 - LG_GRADIENT_MAP_SIZE)];
+}
+#endif
+
+static INLINE jint
+lerp(jint x0, jint x1, jint frac) {
+    return ((x0 << 16) + (x1 - x0) * frac + 0x8000) >> 16;
+}
+
+static INLINE jint
+bilinearPixel(const jint *row0, const jint *row1, jint hfrac, jint vfrac) {
+    jint r = 0;
+    jint shift;
+    for (shift = 0; shift < 32; shift += 8) {
+        jint c0 = lerp((row0[0] >> shift) & 0xff, (row0[1] >> shift) & 0xff, hfrac);
+        jint c1 = lerp((row1[0] >> shift) & 0xff, (row1[1] >> shift) & 0xff, hfrac);
+        r |= lerp(c0, c1, vfrac) << shift;
+    }
+    return r;
+}
+
+#ifdef PISCES_SIMD_X86
+
+static TARGET_SSE41 jint
+accumulate_sse41(jint *alpha, jint *sums, jint n, jint sum) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i carry = _mm_set1_epi32(sum);
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((__m128i *) (alpha + i));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        _mm_storeu_si128((__m128i *) (sums + i), x);
+        _mm_storeu_si128((__m128i *) (alpha + i), zero);
+        carry = _mm_shuffle_epi32(x, 0xFF);
+    }
+    sum = _mm_cvtsi128_si32(carry);
+    for (; i < n; i++) {
+        sum += alpha[i];
+        alpha[i] = 0;
+        sums[i] = sum;
+    }
+    return sum;
+}
+
+static TARGET_SSE41 __m128i
+div255_sse41(__m128i x) {
+    __m128i y = _mm_add_epi16(x, _mm_set1_epi16(1));
+    return _mm_srli_epi16(_mm_add_epi16(y, _mm_srli_epi16(y, 8)), 8);
+}
+
+static TARGET_SSE41 void
+srcOverColor_sse41(jint *dst, const jint *aval, jint n, jint pixel) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i c255 = _mm_set1_epi16(255);
+    __m128i s = _mm_unpacklo_epi8(_mm_set1_epi32(pixel), zero);
+    __m128i spread = _mm_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4,
+                                   8, 8, 8, 8, 12, 12, 12, 12);
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128((__m128i *) (dst + i));
+        __m128i a = _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i *) (aval + i)), spread);
+        __m128i alo = _mm_unpacklo_epi8(a, zero);
+        __m128i ahi = _mm_unpackhi_epi8(a, zero);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(s, alo),
+                _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero),
+                                _mm_sub_epi16(c255, alo)));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(s, ahi),
+                _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero),
+                                _mm_sub_epi16(c255, ahi)));
+        _mm_storeu_si128((__m128i *) (dst + i),
+                _mm_packus_epi16(div255_sse41(lo), div255_sse41(hi)));
+    }
+    if (i < n) {
+        jint rest[4] = {0, 0, 0, 0};
+        jint restAval[4] = {0, 0, 0, 0};
+        jint k;
+        for (k = 0; i + k < n; k++) {
+            rest[k] = dst[i + k];
+            restAval[k] = aval[i + k];
+        }
+        srcOverColor_sse41(rest, restAval, 4, pixel);
+        for (k = 0; i + k < n; k++) {
+            dst[i + k] = rest[k];
+        }
+    }
+}
+
+static TARGET_SSE41 void
+srcOverPaint_sse41(jint *dst, const jint *paint, const jint *frac, jint n) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i c255 = _mm_set1_epi32(255);
+    __m128i spreadLo = _mm_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1,
+                                     4, 5, 4, 5, 4, 5, 4, 5);
+    __m128i spreadHi = _mm_setr_epi8(8, 9, 8, 9, 8, 9, 8, 9,
+                                     12, 13, 12, 13, 12, 13, 12, 13);
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128((__m128i *) (dst + i));
+        __m128i p = _mm_loadu_si128((const __m128i *) (paint + i));
+        __m128i f = _mm_loadu_si128((const __m128i *) (frac + i));
+        // 255 - ((palpha * frac) >> 8), the share of the destination
+        __m128i inv = _mm_sub_epi32(c255, _mm_srli_epi32(
+                _mm_mullo_epi32(_mm_srli_epi32(p, 24), f), 8));
+        __m128i lo = _mm_add_epi16(
+                _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(p, zero),
+                                               _mm_shuffle_epi8(f, spreadLo)), 8),
+                div255_sse41(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero),
+                                             _mm_shuffle_epi8(inv, spreadLo))));
+        __m128i hi = _mm_add_epi16(
+                _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(p, zero),
+                                               _mm_shuffle_epi8(f, spreadHi)), 8),
+                div255_sse41(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero),
+                                             _mm_shuffle_epi8(inv, spreadHi))));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_packus_epi16(lo, hi));
+    }
+    if (i < n) {
+        jint rest[4] = {0, 0, 0, 0};
+        jint restPaint[4] = {0, 0, 0, 0};
+        jint restFrac[4] = {0, 0, 0, 0};
+        jint k;
+        for (k = 0; i + k < n; k++) {
+            rest[k] = dst[i + k];
+            restPaint[k] = paint[i + k];
+            restFrac[k] = frac[i + k];
+        }
+        srcOverPaint_sse41(rest, restPaint, restFrac, 4);
+        for (k = 0; i + k < n; k++) {
+            dst[i + k] = rest[k];
+        }
+    }
+}
+
+static TARGET_SSE41 void
+fill_sse41(jint *dst, jint n, jint pixel) {
+    __m128i p = _mm_set1_epi32(pixel);
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_si128((__m128i *) (dst + i), p);
+    }
+    for (; i < n; i++) {
+        dst[i] = pixel;
+    }
+}
+
+#ifdef PISCES_SIMD_GRADIENTS
+static TARGET_SSE41 __m128i
+padGradient_sse41(__m128i ifrac, jint cycleMethod) {
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        return _mm_min_epi32(_mm_max_epi32(ifrac, _mm_setzero_si128()),
+                             _mm_set1_epi32(0xffff));
+    case CYCLE_REPEAT:
+        return _mm_and_si128(ifrac, _mm_set1_epi32(0xffff));
+    case CYCLE_REFLECT:
+        // min(f, 0x1ffff - f) folds the second half of the period back
+        ifrac = _mm_and_si128(_mm_abs_epi32(ifrac), _mm_set1_epi32(0x1ffff));
+        return _mm_min_epi32(ifrac, _mm_sub_epi32(_mm_set1_epi32(0x1ffff), ifrac));
+    }
+    return ifrac;
+}
+
+static TARGET_SSE41 void
+lookupGradient_sse41(jint *paint, __m128i ifrac, jint cycleMethod, const jint *colors) {
+    __m128i idx = _mm_srli_epi32(padGradient_sse41(ifrac, cycleMethod),
+                                 16 - LG_GRADIENT_MAP_SIZE);
+    paint[0] = colors[_mm_cvtsi128_si32(idx)];
+    paint[1] = colors[_mm_extract_epi32(idx, 1)];
+    paint[2] = colors[_mm_extract_epi32(idx, 2)];
+    paint[3] = colors[_mm_extract_epi32(idx, 3)];
+}
+
+static TARGET_SSE41 __m128i
+radialPosition_sse41(__m128 u, __m128 v) {
+    // u + sqrt(v) in double precision, like u + PISCESsqrt(v)
+    __m128d lo = _mm_add_pd(_mm_cvtps_pd(u), _mm_sqrt_pd(_mm_cvtps_pd(v)));
+    __m128d hi = _mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(u, u)),
+                            _mm_sqrt_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v))));
+    return _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+}
+
+static TARGET_SSE41 void
+linearGradient_sse41(jint *paint, jint n, jfloat frac, jfloat dfrac,
+                     jint cycleMethod, const jint *colors)
+{
+    jfloat f[4];
+    jint i = 0;
+    jint k;
+
+    for (; i + 4 <= n; i += 4) {
+        for (k = 0; k < 4; k++) {
+            f[k] = frac;
+            frac += dfrac;
+        }
+        lookupGradient_sse41(paint + i, _mm_cvttps_epi32(_mm_loadu_ps(f)),
+                             cycleMethod, colors);
+    }
+    for (; i < n; i++) {
+        paint[i] = gradientPixel((jint)frac, cycleMethod, colors);
+        frac += dfrac;
+    }
+}
+
+static TARGET_SSE41 void
+radialGradient_sse41(jint *paint, jint n, jfloat u, jfloat du, jfloat v,
+                     jfloat dv, jfloat ddv, jint cycleMethod, const jint *colors)
+{
+    jfloat fu[4], fv[4];
+    jint i = 0;
+    jint k;
+
+    for (; i + 4 <= n; i += 4) {
+        for (k = 0; k < 4; k++) {
+            if (v < 0) {
+                v = 0;
+            }
+            fu[k] = u;
+            fv[k] = v;
+            u += du;
+            v += dv;
+            dv += ddv;
+        }
+        lookupGradient_sse41(paint + i,
+                radialPosition_sse41(_mm_loadu_ps(fu), _mm_loadu_ps(fv)),
+                cycleMethod, colors);
+    }
+    for (; i < n; i++) {
+        if (v < 0) {
+            v = 0;
+        }
+        paint[i] = gradientPixel((jint)(u + PISCESsqrt(v)), cycleMethod, colors);
+        u += du;
+        v += dv;
+        dv += ddv;
+    }
+}
+#endif
+
+static TARGET_SSE41 __m128i
+lerp_sse41(__m128i x0, __m128i x1, __m128i frac) {
+    return _mm_srai_epi32(_mm_add_epi32(
+            _mm_add_epi32(_mm_slli_epi32(x0, 16),
+                          _mm_mullo_epi32(_mm_sub_epi32(x1, x0), frac)),
+            _mm_set1_epi32(0x8000)), 16);
+}
+
+static TARGET_SSE41 __m128i
+bilinearChannel_sse41(__m128i p00, __m128i p01, __m128i p10, __m128i p11,
+                      __m128i hfrac, __m128i vfrac, __m128i shift)
+{
+    __m128i mask = _mm_set1_epi32(0xff);
+    __m128i c0 = lerp_sse41(_mm_and_si128(_mm_srl_epi32(p00, shift), mask),
+                            _mm_and_si128(_mm_srl_epi32(p01, shift), mask), hfrac);
+    __m128i c1 = lerp_sse41(_mm_and_si128(_mm_srl_epi32(p10, shift), mask),
+                            _mm_and_si128(_mm_srl_epi32(p11, shift), mask), hfrac);
+    return _mm_sll_epi32(lerp_sse41(c0, c1, vfrac), shift);
+}
+
+static TARGET_SSE41 void
+bilinear_sse41(jint *dst, const jint *row0, const jint *row1, jint n,
+               jint hfrac, jint vfrac, jint alphaMask)
+{
+    __m128i h = _mm_set1_epi32(hfrac);
+    __m128i v = _mm_set1_epi32(vfrac);
+    __m128i am = _mm_set1_epi32(alphaMask);
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i p00 = _mm_loadu_si128((const __m128i *) (row0 + i));
+        __m128i p01 = _mm_loadu_si128((const __m128i *) (row0 + i + 1));
+        __m128i p10 = _mm_loadu_si128((const __m128i *) (row1 + i));
+        __m128i p11 = _mm_loadu_si128((const __m128i *) (row1 + i + 1));
+        __m128i r = am;
+        jint shift;
+        for (shift = 0; shift < 32; shift += 8) {
+            r = _mm_or_si128(r, bilinearChannel_sse41(p00, p01, p10, p11, h, v,
+                                                      _mm_cvtsi32_si128(shift)));
+        }
+        _mm_storeu_si128((__m128i *) (dst + i), r);
+    }
+    for (; i < n; i++) {
+        dst[i] = bilinearPixel(row0 + i, row1 + i, hfrac, vfrac) | alphaMask;
+    }
+}
+
+static const BlitKernels sse41Kernels = {
+    accumulate_sse41,
+    srcOverColor_sse41,
+    srcOverPaint_sse41,
+    fill_sse41,
+    GRADIENT_KERNEL(linearGradient_sse41),
+    GRADIENT_KERNEL(radialGradient_sse41),
+    bilinear_sse41
+};
+
+static TARGET_AVX2 jint
+accumulate_avx2(jint *alpha, jint *sums, jint n, jint sum) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i carry = _mm256_set1_epi32(sum);
+    __m256i last = _mm256_set1_epi32(7);
+    jint i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((__m256i *) (alpha + i));
+        // prefix sums within each 128 bit lane, then carry the low lane
+        // total into the high lane
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        x = _mm256_add_epi32(x, _mm256_shuffle_epi32(
+                _mm256_permute2x128_si256(x, x, 0x08), 0xFF));
+        x = _mm256_add_epi32(x, carry);
+        _mm256_storeu_si256((__m256i *) (sums + i), x);
+        _mm256_storeu_si256((__m256i *) (alpha + i), zero);
+        carry = _mm256_permutevar8x32_epi32(x, last);
+    }
+    sum = _mm_cvtsi128_si32(_mm256_castsi256_si128(carry));
+    return accumulate_sse41(alpha + i, sums + i, n - i, sum);
+}
+
+static TARGET_AVX2 __m256i
+div255_avx2(__m256i x) {
+    __m256i y = _mm256_add_epi16(x, _mm256_set1_epi16(1));
+    return _mm256_srli_epi16(_mm256_add_epi16(y, _mm256_srli_epi16(y, 8)), 8);
+}
+
+/*
+ * The 256 bit unpack and pack instructions work on each 128 bit lane
+ * separately, which keeps the pixels in order.
+ */
+static TARGET_AVX2 void
+srcOverColor_avx2(jint *dst, const jint *aval, jint n, jint pixel) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i c255 = _mm256_set1_epi16(255);
+    __m256i s = _mm256_unpacklo_epi8(_mm256_set1_epi32(pixel), zero);
+    __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4,
+                                      8, 8, 8, 8, 12, 12, 12, 12,
+                                      0, 0, 0, 0, 4, 4, 4, 4,
+                                      8, 8, 8, 8, 12, 12, 12, 12);
+    jint i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256((__m256i *) (dst + i));
+        __m256i a = _mm256_shuffle_epi8(
+                _mm256_loadu_si256((const __m256i *) (aval + i)), spread);
+        __m256i alo = _mm256_unpacklo_epi8(a, zero);
+        __m256i ahi = _mm256_unpackhi_epi8(a, zero);
+        __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(s, alo),
+                _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero),
+                                   _mm256_sub_epi16(c255, alo)));
+        __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(s, ahi),
+                _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero),
+                                   _mm256_sub_epi16(c255, ahi)));
+        _mm256_storeu_si256((__m256i *) (dst + i),
+                _mm256_packus_epi16(div255_avx2(lo), div255_avx2(hi)));
+    }
+    srcOverColor_sse41(dst + i, aval + i, n - i, pixel);
+}
+
+static TARGET_AVX2 void
+srcOverPaint_avx2(jint *dst, const jint *paint, const jint *frac, jint n) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i c255 = _mm256_set1_epi32(255);
+    __m256i spreadLo = _mm256_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1,
+                                        4, 5, 4, 5, 4, 5, 4, 5,
+                                        0, 1, 0, 1, 0, 1, 0, 1,
+                                        4, 5, 4, 5, 4, 5, 4, 5);
+    __m256i spreadHi = _mm256_setr_epi8(8, 9, 8, 9, 8, 9, 8, 9,
+                                        12, 13, 12, 13, 12, 13, 12, 13,
+                                        8, 9, 8, 9, 8, 9, 8, 9,
+                                        12, 13, 12, 13, 12, 13, 12, 13);
+    jint i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256((__m256i *) (dst + i));
+        __m256i p = _mm256_loadu_si256((const __m256i *) (paint + i));
+        __m256i f = _mm256_loadu_si256((const __m256i *) (frac + i));
+        __m256i inv = _mm256_sub_epi32(c255, _mm256_srli_epi32(
+                _mm256_mullo_epi32(_mm256_srli_epi32(p, 24), f), 8));
+        __m256i lo = _mm256_add_epi16(
+                _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(p, zero),
+                                                     _mm256_shuffle_epi8(f, spreadLo)), 8),
+                div255_avx2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero),
+                                               _mm256_shuffle_epi8(inv, spreadLo))));
+        __m256i hi = _mm256_add_epi16(
+                _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(p, zero),
+                                                     _mm256_shuffle_epi8(f, spreadHi)), 8),
+                div255_avx2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero),
+                                               _mm256_shuffle_epi8(inv, spreadHi))));
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_packus_epi16(lo, hi));
+    }
+    srcOverPaint_sse41(dst + i, paint + i, frac + i, n - i);
+}
+
+static TARGET_AVX2 void
+fill_avx2(jint *dst, jint n, jint pixel) {
+    __m256i p = _mm256_set1_epi32(pixel);
+    jint i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_si256((__m256i *) (dst + i), p);
+    }
+    fill_sse41(dst + i, n - i, pixel);
+}
+
+#ifdef PISCES_SIMD_GRADIENTS
+static TARGET_AVX2 void
+lookupGradient_avx2(jint *paint, __m256i ifrac, jint cycleMethod, const jint *colors) {
+    __m256i idx;
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        ifrac = _mm256_min_epi32(_mm256_max_epi32(ifrac, _mm256_setzero_si256()),
+                                 _mm256_set1_epi32(0xffff));
+        break;
+    case CYCLE_REPEAT:
+        ifrac = _mm256_and_si256(ifrac, _mm256_set1_epi32(0xffff));
+        break;
+    case CYCLE_REFLECT:
+        ifrac = _mm256_and_si256(_mm256_abs_epi32(ifrac), _mm256_set1_epi32(0x1ffff));
+        ifrac = _mm256_min_epi32(ifrac,
+                _mm256_sub_epi32(_mm256_set1_epi32(0x1ffff), ifrac));
+        break;
+    }
+    idx = _mm256_srli_epi32(ifrac, 16 - LG_GRADIENT_MAP_SIZE);
+    _mm256_storeu_si256((__m256i *) paint,
+            _mm256_i32gather_epi32((const int *) colors, idx, 4));
+}
+
+static TARGET_AVX2 __m256i
+radialPosition_avx2(__m256 u, __m256 v) {
+    __m256d lo = _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(u)),
+            _mm256_sqrt_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v))));
+    __m256d hi = _mm256_add_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(u, 1)),
+            _mm256_sqrt_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(v, 1))));
+    return _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm256_cvttpd_epi32(lo)),
+            _mm256_cvttpd_epi32(hi), 1);
+}
+
+static TARGET_AVX2 void
+linearGradient_avx2(jint *paint, jint n, jfloat frac, jfloat dfrac,
+                    jint cycleMethod, const jint *colors)
+{
+    jfloat f[8];
+    jint i = 0;
+    jint k;
+
+    for (; i + 8 <= n; i += 8) {
+        for (k = 0; k < 8; k++) {
+            f[k] = frac;
+            frac += dfrac;
+        }
+        lookupGradient_avx2(paint + i, _mm256_cvttps_epi32(_mm256_loadu_ps(f)),
+                            cycleMethod, colors);
+    }
+    linearGradient_sse41(paint + i, n - i, frac, dfrac, cycleMethod, colors);
+}
+
+static TARGET_AVX2 void
+radialGradient_avx2(jint *paint, jint n, jfloat u, jfloat du, jfloat v,
+                    jfloat dv, jfloat ddv, jint cycleMethod, const jint *colors)
+{
+    jfloat fu[8], fv[8];
+    jint i = 0;
+    jint k;
+
+    for (; i + 8 <= n; i += 8) {
+        for (k = 0; k < 8; k++) {
+            if (v < 0) {
+                v = 0;
+            }
+            fu[k] = u;
+            fv[k] = v;
+            u += du;
+            v += dv;
+            dv += ddv;
+        }
+        lookupGradient_avx2(paint + i,
+                radialPosition_avx2(_mm256_loadu_ps(fu), _mm256_loadu_ps(fv)),
+                cycleMethod, colors);
+    }
+    radialGradient_sse41(paint + i, n - i, u, du, v, dv, ddv, cycleMethod, colors);
+}
+#endif
+
+static TARGET_AVX2 __m256i
+lerp_avx2(__m256i x0, __m256i x1, __m256i frac) {
+    return _mm256_srai_epi32(_mm256_add_epi32(
+            _mm256_add_epi32(_mm256_slli_epi32(x0, 16),
+                             _mm256_mullo_epi32(_mm256_sub_epi32(x1, x0), frac)),
+            _mm256_set1_epi32(0x8000)), 16);
+}
+
+static TARGET_AVX2 __m256i
+bilinearChannel_avx2(__m256i p00, __m256i p01, __m256i p10, __m256i p11,
+                     __m256i hfrac, __m256i vfrac, __m128i shift)
+{
+    __m256i mask = _mm256_set1_epi32(0xff);
+    __m256i c0 = lerp_avx2(_mm256_and_si256(_mm256_srl_epi32(p00, shift), mask),
+                           _mm256_and_si256(_mm256_srl_epi32(p01, shift), mask), hfrac);
+    __m256i c1 = lerp_avx2(_mm256_and_si256(_mm256_srl_epi32(p10, shift), mask),
+                           _mm256_and_si256(_mm256_srl_epi32(p11, shift), mask), hfrac);
+    return _mm256_sll_epi32(lerp_avx2(c0, c1, vfrac), shift);
+}
+
+static TARGET_AVX2 void
+bilinear_avx2(jint *dst, const jint *row0, const jint *row1, jint n,
+              jint hfrac, jint vfrac, jint alphaMask)
+{
+    __m256i h = _mm256_set1_epi32(hfrac);
+    __m256i v = _mm256_set1_epi32(vfrac);
+    __m256i am = _mm256_set1_epi32(alphaMask);
+    jint i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i p00 = _mm256_loadu_si256((const __m256i *) (row0 + i));
+        __m256i p01 = _mm256_loadu_si256((const __m256i *) (row0 + i + 1));
+        __m256i p10 = _mm256_loadu_si256((const __m256i *) (row1 + i));
+        __m256i p11 = _mm256_loadu_si256((const __m256i *) (row1 + i + 1));
+        __m256i r = am;
+        jint shift;
+        for (shift = 0; shift < 32; shift += 8) {
+            r = _mm256_or_si256(r, bilinearChannel_avx2(p00, p01, p10, p11, h, v,
+                                                        _mm_cvtsi32_si128(shift)));
+        }
+        _mm256_storeu_si256((__m256i *) (dst + i), r);
+    }
+    bilinear_sse41(dst + i, row0 + i, row1 + i, n - i, hfrac, vfrac, alphaMask);
+}
+
+static const BlitKernels avx2Kernels = {
+    accumulate_avx2,
+    srcOverColor_avx2,
+    srcOverPaint_avx2,
+    fill_avx2,
+    GRADIENT_KERNEL(linearGradient_avx2),
+    GRADIENT_KERNEL(radialGradient_avx2),
+    bilinear_avx2
+};
+
+static const BlitKernels *
+detectBlitKernels() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return &avx2Kernels;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return &sse41Kernels;
+    }
+    return NULL;
+}
+
+#elif defined(PISCES_SIMD_NEON)
+
+static jint
+accumulate_neon(jint *alpha, jint *sums, jint n, jint sum) {
+    int32x4_t zero = vdupq_n_s32(0);
+    int32x4_t carry = vdupq_n_s32(sum);
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t x = vld1q_s32(alpha + i);
+        x = vaddq_s32(x, vextq_s32(zero, x, 3));
+        x = vaddq_s32(x, vextq_s32(zero, x, 2));
+        x = vaddq_s32(x, carry);
+        vst1q_s32(sums + i, x);
+        vst1q_s32(alpha + i, zero);
+        carry = vdupq_laneq_s32(x, 3);
+    }
+    sum = vgetq_lane_s32(carry, 0);
+    for (; i < n; i++) {
+        sum += alpha[i];
+        alpha[i] = 0;
+        sums[i] = sum;
+    }
+    return sum;
+}
+
+static INLINE uint16x8_t
+div255_neon(uint16x8_t x) {
+    uint16x8_t y = vaddq_u16(x, vdupq_n_u16(1));
+    return vshrq_n_u16(vsraq_n_u16(y, y, 8), 8);
+}
+
+static void
+srcOverColor_neon(jint *dst, const jint *aval, jint n, jint pixel) {
+    uint8x16_t s = vreinterpretq_u8_u32(vdupq_n_u32((uint32_t) pixel));
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        uint8x16_t d = vreinterpretq_u8_s32(vld1q_s32(dst + i));
+        uint8x16_t a = vreinterpretq_u8_u32(vmulq_n_u32(
+                vreinterpretq_u32_s32(vld1q_s32(aval + i)), 0x01010101));
+        uint8x16_t inv = vsubq_u8(vdupq_n_u8(255), a);
+        uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(s), vget_low_u8(a)),
+                                 vget_low_u8(d), vget_low_u8(inv));
+        uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(s), vget_high_u8(a)),
+                                 vget_high_u8(d), vget_high_u8(inv));
+        vst1q_s32(dst + i, vreinterpretq_s32_u8(
+                vcombine_u8(vmovn_u16(div255_neon(lo)),
+                            vmovn_u16(div255_neon(hi)))));
+    }
+    for (; i < n; i++) {
+        jint a = aval[i];
+        jint d = dst[i];
+        jint r = 0;
+        jint shift;
+        for (shift = 0; shift < 32; shift += 8) {
+            jint x = ((pixel >> shift) & 0xff) * a
+                   + ((d >> shift) & 0xff) * (255 - a) + 1;
+            r |= ((x + (x >> 8)) >> 8) << shift;
+        }
+        dst[i] = r;
+    }
+}
+
+static void
+srcOverPaint_neon(jint *dst, const jint *paint, const jint *frac, jint n) {
+    uint32x4_t c255 = vdupq_n_u32(255);
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        uint8x16_t d = vreinterpretq_u8_s32(vld1q_s32(dst + i));
+        uint32x4_t p = vreinterpretq_u32_s32(vld1q_s32(paint + i));
+        uint32x4_t f = vreinterpretq_u32_s32(vld1q_s32(frac + i));
+        uint32x4_t inv = vsubq_u32(c255,
+                vshrq_n_u32(vmulq_u32(vshrq_n_u32(p, 24), f), 8));
+        // each 32 bit lane holds the value twice as 16 bit lanes
+        uint32x4_t f2 = vmulq_n_u32(f, 0x00010001);
+        uint32x4_t inv2 = vmulq_n_u32(inv, 0x00010001);
+        uint8x16_t p8 = vreinterpretq_u8_u32(p);
+        uint16x8_t lo = vaddq_u16(
+                vshrq_n_u16(vmulq_u16(vmovl_u8(vget_low_u8(p8)),
+                        vreinterpretq_u16_u32(vzip1q_u32(f2, f2))), 8),
+                div255_neon(vmulq_u16(vmovl_u8(vget_low_u8(d)),
+                        vreinterpretq_u16_u32(vzip1q_u32(inv2, inv2)))));
+        uint16x8_t hi = vaddq_u16(
+                vshrq_n_u16(vmulq_u16(vmovl_u8(vget_high_u8(p8)),
+                        vreinterpretq_u16_u32(vzip2q_u32(f2, f2))), 8),
+                div255_neon(vmulq_u16(vmovl_u8(vget_high_u8(d)),
+                        vreinterpretq_u16_u32(vzip2q_u32(inv2, inv2)))));
+        vst1q_s32(dst + i, vreinterpretq_s32_u8(
+                vcombine_u8(vmovn_u16(lo), vmovn_u16(hi))));
+    }
+    for (; i < n; i++) {
+        jint p = paint[i];
+        jint f = frac[i];
+        jint d = dst[i];
+        jint inv = 255 - ((((p >> 24) & 0xff) * f) >> 8);
+        jint r = 0;
+        jint shift;
+        for (shift = 0; shift < 32; shift += 8) {
+            jint x = ((d >> shift) & 0xff) * inv + 1;
+            r |= ((((p >> shift) & 0xff) * f >> 8) + ((x + (x >> 8)) >> 8)) << shift;
+        }
+        dst[i] = r;
+    }
+}
+
+static void
+fill_neon(jint *dst, jint n, jint pixel) {
+    int32x4_t p = vdupq_n_s32(pixel);
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_s32(dst + i, p);
+    }
+    for (; i < n; i++) {
+        dst[i] = pixel;
+    }
+}
+
+#ifdef PISCES_SIMD_GRADIENTS
+static void
+lookupGradient_neon(jint *paint, int32x4_t ifrac, jint cycleMethod, const jint *colors) {
+    jint idx[4];
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        ifrac = vminq_s32(vmaxq_s32(ifrac, vdupq_n_s32(0)), vdupq_n_s32(0xffff));
+        break;
+    case CYCLE_REPEAT:
+        ifrac = vandq_s32(ifrac, vdupq_n_s32(0xffff));
+        break;
+    case CYCLE_REFLECT:
+        ifrac = vandq_s32(vabsq_s32(ifrac), vdupq_n_s32(0x1ffff));
+        ifrac = vminq_s32(ifrac, vsubq_s32(vdupq_n_s32(0x1ffff), ifrac));
+        break;
+    }
+    vst1q_s32(idx, vshrq_n_s32(ifrac, 16 - LG_GRADIENT_MAP_SIZE));
+    paint[0] = colors[idx[0]];
+    paint[1] = colors[idx[1]];
+    paint[2] = colors[idx[2]];
+    paint[3] = colors[idx[3]];
+}
+
+static INLINE int32x4_t
+radialPosition_neon(float32x4_t u, float32x4_t v) {
+    // the conversions saturate like the scalar ones, which makes the
+    // narrowing of the 64 bit results exact as well
+    float64x2_t lo = vaddq_f64(vcvt_f64_f32(vget_low_f32(u)),
+                               vsqrtq_f64(vcvt_f64_f32(vget_low_f32(v))));
+    float64x2_t hi = vaddq_f64(vcvt_high_f64_f32(u),
+                               vsqrtq_f64(vcvt_high_f64_f32(v)));
+    return vcombine_s32(vqmovn_s64(vcvtq_s64_f64(lo)),
+                        vqmovn_s64(vcvtq_s64_f64(hi)));
+}
+
+static void
+linearGradient_neon(jint *paint, jint n, jfloat frac, jfloat dfrac,
+                    jint cycleMethod, const jint *colors)
+{
+    jfloat f[4];
+    jint i = 0;
+    jint k;
+
+    for (; i + 4 <= n; i += 4) {
+        for (k = 0; k < 4; k++) {
+            f[k] = frac;
+            frac += dfrac;
+        }
+        lookupGradient_neon(paint + i, vcvtq_s32_f32(vld1q_f32(f)),
+                            cycleMethod, colors);
+    }
+    for (; i < n; i++) {
+        paint[i] = gradientPixel((jint)frac, cycleMethod, colors);
+        frac += dfrac;
+    }
+}
+
+static void
+radialGradient_neon(jint *paint, jint n, jfloat u, jfloat du, jfloat v,
+                    jfloat dv, jfloat ddv, jint cycleMethod, const jint *colors)
+{
+    jfloat fu[4], fv[4];
+    jint i = 0;
+    jint k;
+
+    for (; i + 4 <= n; i += 4) {
+        for (k = 0; k < 4; k++) {
+            if (v < 0) {
+                v = 0;
+            }
+            fu[k] = u;
+            fv[k] = v;
+            u += du;
+            v += dv;
+            dv += ddv;
+        }
+        lookupGradient_neon(paint + i,
+                radialPosition_neon(vld1q_f32(fu), vld1q_f32(fv)),
+                cycleMethod, colors);
+    }
+    for (; i < n; i++) {
+        if (v < 0) {
+            v = 0;
+        }
+        paint[i] = gradientPixel((jint)(u + PISCESsqrt(v)), cycleMethod, colors);
+        u += du;
+        v += dv;
+        dv += ddv;
+    }
+}
+#endif
+
+static INLINE int32x4_t
+lerp_neon(int32x4_t x0, int32x4_t x1, int32x4_t frac) {
+    return vshrq_n_s32(vaddq_s32(
+            vaddq_s32(vshlq_n_s32(x0, 16), vmulq_s32(vsubq_s32(x1, x0), frac)),
+            vdupq_n_s32(0x8000)), 16);
+}
+
+static void
+bilinear_neon(jint *dst, const jint *row0, const jint *row1, jint n,
+              jint hfrac, jint vfrac, jint alphaMask)
+{
+    int32x4_t h = vdupq_n_s32(hfrac);
+    int32x4_t v = vdupq_n_s32(vfrac);
+    int32x4_t mask = vdupq_n_s32(0xff);
+    jint i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t p00 = vld1q_s32(row0 + i);
+        int32x4_t p01 = vld1q_s32(row0 + i + 1);
+        int32x4_t p10 = vld1q_s32(row1 + i);
+        int32x4_t p11 = vld1q_s32(row1 + i + 1);
+        int32x4_t r = vdupq_n_s32(alphaMask);
+        jint shift;
+        for (shift = 0; shift < 32; shift += 8) {
+            int32x4_t right = vdupq_n_s32(-shift);
+            int32x4_t c0 = lerp_neon(vandq_s32(vshlq_s32(p00, right), mask),
+                                     vandq_s32(vshlq_s32(p01, right), mask), h);
+            int32x4_t c1 = lerp_neon(vandq_s32(vshlq_s32(p10, right), mask),
+                                     vandq_s32(vshlq_s32(p11, right), mask), h);
+            r = vorrq_s32(r, vshlq_s32(lerp_neon(c0, c1, v), vdupq_n_s32(shift)));
+        }
+        vst1q_s32(dst + i, r);
+    }
+    for (; i < n; i++) {
+        dst[i] = bilinearPixel(row0 + i, row1 + i, hfrac, vfrac) | alphaMask;
+    }
+}
+
+static const BlitKernels neonKernels = {
+    accumulate_neon,
+    srcOverColor_neon,
+    srcOverPaint_neon,
+    fill_neon,
+    GRADIENT_KERNEL(linearGradient_neon),
+    GRADIENT_KERNEL(radialGradient_neon),
+    bilinear_neon
+};
+
+static const BlitKernels *
+detectBlitKernels() {
+    // Advanced SIMD is part of every AArch64 implementation
+    return &neonKernels;
+}
+
+#else
+
+static const BlitKernels *
+detectBlitKernels() {
+    return NULL;
+}
+
+#endif
+
+void
+initBlitKernels() {
+    if (!blitKernelsSelected) {
+        selectBlitKernels(JNI_TRUE);
+    }
+}
+
+jboolean
+selectBlitKernels(jboolean enable) {
+    blitKernels = enable ? detectBlitKernels() : NULL;
+    blitKernelsSelected = JNI_TRUE;
+    return blitKernels != NULL;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef PISCES_BLIT_SIMD_H
+#define PISCES_BLIT_SIMD_H
+
+#include <PiscesDefs.h>
+
+/**
+ * Vectorized inner loops used by the blitters when the destination pixels
+ * of a row are contiguous, and by the paint generators. All of them produce
+ * exactly the same pixels as the scalar loops in PiscesBlit.c and
+ * PiscesPaint.c.
+ */
+typedef struct _BlitKernels {
+    /**
+     * Stores the running sum of the alpha deltas, starting from sum, into
+     * sums, clears the deltas and returns the final sum.
+     */
+    jint (*accumulate)(jint *alpha, jint *sums, jint n, jint sum);
+
+    /**
+     * Composites the opaque color pixel over dst with the coverage
+     * aval[i] (0-255) of each pixel.
+     */
+    void (*srcOverColor)(jint *dst, const jint *aval, jint n, jint pixel);
+
+    /**
+     * Composites the premultiplied paint, scaled by frac[i] / 256
+     * (0-256), over dst.
+     */
+    void (*srcOverPaint)(jint *dst, const jint *paint, const jint *frac, jint n);
+
+    void (*fill)(jint *dst, jint n, jint pixel);
+
+    /**
+     * Generates n pixels of a linear gradient whose 16.16 position starts
+     * at frac and advances by dfrac per pixel. May be NULL.
+     */
+    void (*linearGradient)(jint *paint, jint n, jfloat frac, jfloat dfrac,
+                           jint cycleMethod, const jint *colors);
+
+    /**
+     * Generates n pixels of a radial gradient whose position is
+     * u + sqrt(v), where a negative v is set to 0 first. After each pixel
+     * u advances by du, v by dv and dv by ddv. May be NULL.
+     */
+    void (*radialGradient)(jint *paint, jint n, jfloat u, jfloat du,
+                           jfloat v, jfloat dv, jfloat ddv,
+                           jint cycleMethod, const jint *colors);
+
+    /**
+     * Bilinearly filters n pixels between the texels row0[i], row0[i + 1],
+     * row1[i] and row1[i + 1] with the fractions hfrac and vfrac (0-0xffff)
+     * and ORs alphaMask into the results.
+     */
+    void (*bilinear)(jint *dst, const jint *row0, const jint *row1, jint n,
+                     jint hfrac, jint vfrac, jint alphaMask);
+} BlitKernels;
+
+/** The kernels for the current CPU, or NULL to use the scalar loops */
+extern const BlitKernels *blitKernels;
+
+/** Selects the kernels once, unless selectBlitKernels was called before */
+void initBlitKernels();
+
+/**
+ * Enables or disables the vectorized loops and returns whether they are
+ * in use, which is never the case on CPUs without a supported instruction
+ * set.
+ */
+jboolean selectBlitKernels(jboolean enable);
+
+#endif
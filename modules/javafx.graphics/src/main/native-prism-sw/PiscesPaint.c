@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 #include <PiscesUtil.h>
 #include <PiscesRenderer.h>
+#include <PiscesBlitSIMD.h>
 
 #include <PiscesSysutils.h>
 #include <PiscesMath.h>
@@ -120,12 +121,17 @@ genLinearGradientPaint(Renderer *rdr, jint height) {
         pidx = paintOffset;
 
         frac = x * mx + y * my + b;
-        for (i = 0; i < width; i++, pidx++) {
-            jint ifrac = pad((jint)frac, cycleMethod);
-            ifrac >>= 16 - LG_GRADIENT_MAP_SIZE;
-            paint[pidx] = colors[ifrac];
+        if (blitKernels != NULL && blitKernels->linearGradient != NULL) {
+            blitKernels->linearGradient(paint + pidx, width, frac, mx,
+                                        cycleMethod, colors);
+        } else {
+            for (i = 0; i < width; i++, pidx++) {
+                jint ifrac = pad((jint)frac, cycleMethod);
+                ifrac >>= 16 - LG_GRADIENT_MAP_SIZE;
+                paint[pidx] = colors[ifrac];
 
-            frac += mx;
+                frac += mx;
+            }
         }
 
         paintOffset += width;
@@ -213,20 +219,25 @@ genRadialGradientPaint(Renderer *rdr, jint height) {
         dU  = (65536.0f * dU);
         dV  = (65536.0f * 65536.0f * dV);
         ddV = (65536.0f * 65536.0f * ddV);
-        for (i = 0; i < width; i++, pidx++) {
-            if (V < 0) {
-                V = 0;
-            }
+        if (blitKernels != NULL && blitKernels->radialGradient != NULL) {
+            blitKernels->radialGradient(paint + pidx, width, U, dU, V, dV, ddV,
+                                        cycleMethod, colors);
+        } else {
+            for (i = 0; i < width; i++, pidx++) {
+                if (V < 0) {
+                    V = 0;
+                }
 
-            ifrac = (jint)(U + PISCESsqrt(V));
+                ifrac = (jint)(U + PISCESsqrt(V));
 
-            U += dU;
-            V += dV ;
-            dV += ddV;
+                U += dU;
+                V += dV ;
+                dV += ddV;
 
-            ifrac = pad(ifrac, cycleMethod);
-            ifrac >>= (16 - LG_GRADIENT_MAP_SIZE);
-            paint[pidx] = colors[ifrac];
+                ifrac = pad(ifrac, cycleMethod);
+                ifrac >>= (16 - LG_GRADIENT_MAP_SIZE);
+                paint[pidx] = colors[ifrac];
+            }
         }
 
         paintOffset += width;
@@ -405,6 +416,26 @@ static INLINE void getPointsToInterpolateRepeat(jint *pts, jint *data, jint sidx
     pts[2] = (isXin) ? data[sidx2 + 1] : data[sidx2 - MAX(tx,0)];
 }
 
+/**
+ * Filters the run of pixels of a translated texture row, starting at ltx,
+ * whose neighbours all lie inside the texture with the vectorized loop and
+ * returns its length, or 0 when the pixel needs the bounds handling of the
+ * scalar loop.
+ */
+static INLINE jint
+bilinearRun(jint *a, jint *am, jlong ltx, jint txLo, jint txHi,
+    jint *row0, jint *row1, jint hfrac, jint vfrac, jint alphaMask)
+{
+    jint tx = (jint)(ltx >> 16);
+    jint n;
+    if (blitKernels == NULL || tx < txLo || tx > txHi) {
+        return 0;
+    }
+    n = MIN((jint)(am - a), txHi - tx + 1);
+    blitKernels->bilinear(a, row0 + tx, row1 + tx, n, hfrac, vfrac, alphaMask);
+    return n;
+}
+
 void
 genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
     jint j;
@@ -457,6 +488,11 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
         jint paintOffset = 0;
         jint pts[3];
         jint sidx, p00;
+        jint *row0, *row1;
+        // columns whose right neighbour is inside the texture and that need
+        // no bounds handling
+        jint txLo = MAX(0, txMin-1);
+        jint txHi = MIN(txMax, txtWidth-2);
 
         y = rdr->_currY;
 
@@ -480,6 +516,14 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
                 checkBoundsNoRepeat(&ty, &lty, tyMin-1, tyMax);
             }
 
+            // the rows getPointsToInterpolate and getPointsToInterpolateRepeat read
+            row0 = txtData + MAX(0, ty) * txtStride;
+            if (ty < txtHeight-1) {
+                row1 = row0 + txtStride;
+            } else {
+                row1 = (rdr->_texture_repeat) ? txtData : row0;
+            }
+
             a = paint + pidx;
             am = a + paintStride;
 
@@ -521,6 +565,14 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
                 break;
             case NO_REPEAT_INTERPOLATE_ALPHA:
                 while (a < am) {
+                    jint run = bilinearRun(a, am, ltx, txLo, txHi, row0, row1,
+                                           hfrac, vfrac, 0);
+                    if (run > 0) {
+                        a += run;
+                        pidx += run;
+                        ltx += (jlong)run << 16;
+                        continue;
+                    }
                     tx = (jint)(ltx >> 16);
                     checkBoundsNoRepeat(&tx, &ltx, txMin-1, txMax);
                     PISCES_DEBUG("[%d, %d, h:%d, v:%d] ", tx, ty, hfrac, vfrac);
@@ -548,6 +600,14 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
                 break;
             case REPEAT_INTERPOLATE_ALPHA:
                 while (a < am) {
+                    jint run = bilinearRun(a, am, ltx, txLo, txHi, row0, row1,
+                                           hfrac, vfrac, 0);
+                    if (run > 0) {
+                        a += run;
+                        pidx += run;
+                        ltx += (jlong)run << 16;
+                        continue;
+                    }
                     tx = (jint)(ltx >> 16);
                     checkBoundsRepeat(&tx, &ltx, txMin-1, txMax);
                     PISCES_DEBUG("[%d, %d, h:%d, v:%d] ", tx, ty, hfrac, vfrac);
@@ -575,6 +635,14 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
                 break;
             case NO_REPEAT_INTERPOLATE_NO_ALPHA:
                 while (a < am) {
+                    jint run = bilinearRun(a, am, ltx, txLo, txHi, row0, row1,
+                                           hfrac, vfrac, 0xff000000);
+                    if (run > 0) {
+                        a += run;
+                        pidx += run;
+                        ltx += (jlong)run << 16;
+                        continue;
+                    }
                     tx = (jint)(ltx >> 16);
                     checkBoundsNoRepeat(&tx, &ltx, txMin-1, txMax);
                     PISCES_DEBUG("[%d, %d, h:%d, v:%d] ", tx, ty, hfrac, vfrac);
@@ -602,6 +670,14 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
                 break;
             case REPEAT_INTERPOLATE_NO_ALPHA:
                 while (a < am) {
+                    jint run = bilinearRun(a, am, ltx, txLo, txHi, row0, row1,
+                                           hfrac, vfrac, 0xff000000);
+                    if (run > 0) {
+                        a += run;
+                        pidx += run;
+                        ltx += (jlong)run << 16;
+                        continue;
+                    }
                     tx = (jint)(ltx >> 16);
                     checkBoundsRepeat(&tx, &ltx, txMin-1, txMax);
                     PISCES_DEBUG("[%d, %d, h:%d, v:%d] ", tx, ty, hfrac, vfrac);
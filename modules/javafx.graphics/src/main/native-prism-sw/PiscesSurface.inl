@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,8 +37,8 @@ static INLINE void surface_setRGB(Surface* dstSurface, jint x, jint y,
                                   jint scanLength);
 
 
-static void setRGB(jint* src, jint srcScanLength, jint* dst, jint dstScanLength,
-                   jint width, jint height);
+static INLINE void copyRows(jint* dst, jint dstScanLength, jint* src,
+                            jint srcScanLength, jint width, jint height);
 
 
 static INLINE void
@@ -50,24 +50,23 @@ static INLINE void
 surface_setRGB(Surface* dstSurface, jint x, jint y,
                jint width, jint height, jint* data, jint scanLength) {
     if (dstSurface->data == NULL) return;
-    setRGB((jint*)dstSurface->data + y * dstSurface->width + x, 
-           dstSurface->width, data, scanLength, width, height);
+    copyRows((jint*)dstSurface->data + y * dstSurface->scanlineStride + x,
+             dstSurface->scanlineStride, data, scanLength, width, height);
 }
 
 
-static void
-setRGB(jint* dst, jint dstScanLength, jint* src, jint srcScanLength,
-       jint width, jint height) {
-    jint srcScanRest = srcScanLength - width;
-    jint dstScanRest = dstScanLength - width;
+static INLINE void
+copyRows(jint* dst, jint dstScanLength, jint* src, jint srcScanLength,
+         jint width, jint height) {
+    size_t size = sizeof(jint) * width;
 
+    if (dstScanLength == width && srcScanLength == width) {
+        memcpy(dst, src, size * height);
+        return;
+    }
     for (; height > 0; --height) {
-        jint w2 = width;
-        for (; w2 > 0; --w2) {
-            *dst++ = *src++;
-        }
-        src += srcScanRest;
-        dst += dstScanRest;
+        memcpy(dst, src, size);
+        src += srcScanLength;
+        dst += dstScanLength;
     }
 }
-
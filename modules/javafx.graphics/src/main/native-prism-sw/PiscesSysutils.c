@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,3 +43,16 @@ jboolean readAndClearMemErrorFlag() {
 jboolean readMemErrorFlag() {
     return mem_Error_Flag;
 }
+
+#ifndef _WIN32
+void* PISCESaligned_malloc(size_t size, size_t alignment) {
+    void* memory;
+    if (alignment < sizeof(void*)) {
+        alignment = sizeof(void*);
+    }
+    if (posix_memalign(&memory, alignment, size) != 0) {
+        return NULL;
+    }
+    return memory;
+}
+#endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,16 @@
 #define PISCEScalloc(x, y) calloc((x), (y))
 #define PISCESrealloc(x,y) realloc((x), (y))
 
+// for memory with a given alignment, which must be a power of two
+#ifdef _WIN32
+#include <malloc.h>
+#define PISCESaligned_malloc(x, a) _aligned_malloc((x), (a))
+#define PISCESaligned_free(x) _aligned_free(x)
+#else
+void* PISCESaligned_malloc(size_t size, size_t alignment);
+#define PISCESaligned_free(x) free(x)
+#endif
+
 // for memcpy
 #include <string.h>
 
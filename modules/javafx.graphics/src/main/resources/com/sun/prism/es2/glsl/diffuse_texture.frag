@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -50,7 +50,12 @@ precision mediump int;
 
 #endif
 
+#ifdef INSTANCED
+varying vec4 oDiffuseColor;
+#define diffuseColor oDiffuseColor
+#else
 uniform vec4 diffuseColor;
+#endif
 uniform sampler2D diffuseTexture;
 
 varying vec2 oTexCoords;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,7 +24,17 @@
  */
 
 uniform mat4 viewProjectionMatrix;
+#ifdef INSTANCED
+// The rows of the world matrix and the diffuse color of each instance
+attribute vec4 worldRow0;
+attribute vec4 worldRow1;
+attribute vec4 worldRow2;
+attribute vec4 instanceColor;
+
+varying vec4 oDiffuseColor;
+#else
 uniform mat4 worldMatrix;
+#endif
 uniform vec3 camPos;
 uniform vec3 ambientColor;
 
@@ -59,6 +69,14 @@ void main()
 {
     vec3 tangentFrame[3];
 
+#ifdef INSTANCED
+    mat4 worldMatrix = mat4(worldRow0.x, worldRow1.x, worldRow2.x, 0.0,
+                            worldRow0.y, worldRow1.y, worldRow2.y, 0.0,
+                            worldRow0.z, worldRow1.z, worldRow2.z, 0.0,
+                            worldRow0.w, worldRow1.w, worldRow2.w, 1.0);
+    oDiffuseColor = instanceColor;
+#endif
+
     vec4 worldPos = worldMatrix * vec4(pos, 1.0);
 
     // Note: The breaking of a vector and scale computation statement into
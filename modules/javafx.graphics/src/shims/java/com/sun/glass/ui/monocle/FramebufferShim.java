@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,8 +25,10 @@
 
 package com.sun.glass.ui.monocle;
 
+import java.io.IOException;
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
+import java.nio.channels.WritableByteChannel;
 
 public class FramebufferShim extends Framebuffer {
 
@@ -48,4 +50,19 @@ public class FramebufferShim extends Framebuffer {
         super.reset();
     }
 
+    @Override
+    public void clearDamage(int[] starts, int[] ends) {
+        super.clearDamage(starts, ends);
+    }
+
+    @Override
+    public void addDamageTo(int[] starts, int[] ends) {
+        super.addDamageTo(starts, ends);
+    }
+
+    @Override
+    public void write(WritableByteChannel out) throws IOException {
+        super.write(out);
+    }
+
 }
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import java.io.File;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+
+public class LinuxInputMultiplexerShim {
+
+    public static class DeviceShim {
+
+        final LinuxInputDevice device;
+
+        private DeviceShim(LinuxInputDevice d) {
+            device = d;
+        }
+
+        public boolean hasData() {
+            return device.getBuffer().hasData();
+        }
+
+        /**
+         * Removes the complete events waiting on the device and returns the
+         * type, code and value of each of their lines. Stands in for the input
+         * processor, which needs a running application.
+         */
+        public List<int[]> takeEvents() {
+            LinuxEventBuffer buffer = device.getBuffer();
+            List<int[]> lines = new ArrayList<>();
+            buffer.startIteration();
+            while (buffer.hasNextEvent()) {
+                lines.add(new int[] {
+                    buffer.getEventType(), buffer.getEventCode(), buffer.getEventValue()
+                });
+                buffer.nextEvent();
+            }
+            buffer.compact();
+            return lines;
+        }
+    }
+
+    public static int getEventSize() {
+        return new LinuxEventBuffer(LinuxArch.getBits()).getEventSize();
+    }
+
+    public static DeviceShim addDevice(File devNode, File sysPath) throws IOException {
+        LinuxInputDevice device = new LinuxInputDevice(devNode, sysPath, new HashMap<>());
+        device.setInputProcessor(d -> { });
+        LinuxInputMultiplexer multiplexer = LinuxInputMultiplexer.getInstance();
+        if (multiplexer == null) {
+            throw new IOException("epoll is not available");
+        }
+        multiplexer.addDevice(device);
+        return new DeviceShim(device);
+    }
+
+    public static void removeDevice(DeviceShim device) {
+        LinuxInputMultiplexer.getInstance().removeDevice(device.device);
+        LinuxSystem.getLinuxSystem().close(device.device.getFileDescriptor());
+    }
+
+}
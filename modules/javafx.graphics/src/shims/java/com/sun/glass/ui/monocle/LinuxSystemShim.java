@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -73,7 +73,7 @@ public class LinuxSystemShim {
     }
 
     public static long write(long fd, ByteBuffer buf, int position, int limit) {
-        return LinuxSystem.getLinuxSystem().write(fd, buf, limit, limit);
+        return LinuxSystem.getLinuxSystem().write(fd, buf, position, limit);
     }
 
     public static int close(long fd) {
@@ -89,7 +89,11 @@ public class LinuxSystemShim {
     }
 
     public static int ioctl(long fd, int request, long data) {
-        return LinuxSystem.getLinuxSystem().ioctl(fd, request, fd);
+        return LinuxSystem.getLinuxSystem().ioctl(fd, request, data);
+    }
+
+    public static int IOW(int type, int number, int size) {
+        return LinuxSystem.getLinuxSystem().IOW(type, number, size);
     }
 
 }
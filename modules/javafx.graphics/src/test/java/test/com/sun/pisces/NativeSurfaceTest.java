@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.pisces;
+
+import com.sun.glass.utils.NativeLibLoader;
+import com.sun.pisces.AbstractSurface;
+import com.sun.pisces.JavaSurface;
+import com.sun.pisces.NativeSurface;
+import com.sun.pisces.PiscesRenderer;
+import com.sun.pisces.RendererBase;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.IntBuffer;
+import java.util.Random;
+
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Verifies that rendering into native surfaces, with padded rows or into
+ * shared memory, gives the same pixels as rendering into a Java array.
+ */
+public class NativeSurfaceTest {
+
+    private static final int WIDTH = 203;
+    private static final int HEIGHT = 97;
+
+    private static boolean loaded;
+
+    @BeforeAll
+    public static void loadLibrary() {
+        try {
+            NativeLibLoader.loadLibrary("prism_sw");
+            loaded = true;
+        } catch (UnsatisfiedLinkError e) {
+            loaded = false;
+        }
+    }
+
+    private static int[] render(AbstractSurface surface) {
+        Random random = new Random(7);
+        int[] background = new int[WIDTH * HEIGHT];
+        for (int i = 0; i < background.length; i++) {
+            background[i] = 0xff000000 | random.nextInt();
+        }
+        surface.setRGB(background, 0, WIDTH, 0, 0, WIDTH, HEIGHT);
+
+        PiscesRenderer pr = new PiscesRenderer(surface);
+        pr.setCompositeRule(RendererBase.COMPOSITE_SRC_OVER);
+        for (int i = 0; i < 20; i++) {
+            pr.setColor(random.nextInt(256), random.nextInt(256), random.nextInt(256),
+                        random.nextInt(256));
+            pr.fillRect(random.nextInt(WIDTH << 16), random.nextInt(HEIGHT << 16),
+                        random.nextInt(WIDTH << 15), random.nextInt(HEIGHT << 15));
+        }
+        pr.setLinearGradient(0, 0, 0xff00ff00, WIDTH << 16, 0, 0x400000ff,
+                             random.nextInt(3));
+        pr.fillRect(WIDTH << 14, HEIGHT << 14, WIDTH << 15, HEIGHT << 15);
+        byte[] mask = new byte[WIDTH * HEIGHT / 4];
+        random.nextBytes(mask);
+        pr.fillAlphaMask(mask, WIDTH / 3, HEIGHT / 3, WIDTH / 2, HEIGHT / 2, 0, WIDTH / 2);
+        // full width clears take a separate path
+        pr.setColor(0, 0, 0, 0);
+        pr.clearRect(0, HEIGHT - 10, WIDTH, 5);
+
+        int[] result = new int[WIDTH * HEIGHT];
+        surface.getRGB(result, 0, WIDTH, 0, 0, WIDTH, HEIGHT);
+        return result;
+    }
+
+    private static int[] renderJava() {
+        return render(new JavaSurface(new int[WIDTH * HEIGHT], RendererBase.TYPE_INT_ARGB_PRE,
+                                      WIDTH, HEIGHT));
+    }
+
+    @Test
+    public void testAlignedSurface() {
+        assumeTrue(loaded, "prism_sw library is not available");
+        NativeSurface surface = new NativeSurface(RendererBase.TYPE_INT_ARGB_PRE, WIDTH, HEIGHT, true);
+        assertEquals(0, surface.getScanlineStride() % 16);
+        assertArrayEquals(renderJava(), render(surface));
+    }
+
+    @Test
+    public void testPackedSurface() {
+        assumeTrue(loaded, "prism_sw library is not available");
+        NativeSurface surface = new NativeSurface(RendererBase.TYPE_INT_ARGB_PRE, WIDTH, HEIGHT, false);
+        assertEquals(WIDTH, surface.getScanlineStride());
+        int[] expected = renderJava();
+        assertArrayEquals(expected, render(surface));
+
+        int[] pixels = new int[WIDTH * HEIGHT];
+        surface.getDataIntBuffer().get(0, pixels);
+        assertArrayEquals(expected, pixels);
+    }
+
+    @Test
+    public void testSharedSurface() {
+        assumeTrue(loaded, "prism_sw library is not available");
+        int stride = WIDTH + 5;
+        ByteBuffer memory = ByteBuffer.allocateDirect(stride * HEIGHT * 4)
+                                      .order(ByteOrder.nativeOrder());
+        NativeSurface surface = new NativeSurface(memory, RendererBase.TYPE_INT_ARGB_PRE,
+                                                  WIDTH, HEIGHT, stride);
+        int[] expected = renderJava();
+        assertArrayEquals(expected, render(surface));
+
+        // the padding at the end of each row is left alone
+        IntBuffer pixels = memory.asIntBuffer();
+        for (int y = 0; y < HEIGHT; y++) {
+            for (int x = 0; x < WIDTH; x++) {
+                assertEquals(expected[y * WIDTH + x], pixels.get(y * stride + x));
+            }
+            for (int x = WIDTH; x < stride; x++) {
+                assertEquals(0, pixels.get(y * stride + x));
+            }
+        }
+    }
+
+    @Test
+    public void testDispose() {
+        assumeTrue(loaded, "prism_sw library is not available");
+        NativeSurface surface = new NativeSurface(RendererBase.TYPE_INT_ARGB_PRE, WIDTH, HEIGHT, false);
+        surface.dispose();
+        // a second dispose, or the one of the disposer, is harmless
+        surface.dispose();
+        assertThrows(IllegalArgumentException.class,
+                     () -> surface.getRGB(new int[WIDTH * HEIGHT], 0, WIDTH, 0, 0, WIDTH, HEIGHT));
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.pisces;
+
+import com.sun.javafx.geom.Ellipse2D;
+import com.sun.javafx.geom.Path2D;
+import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.geom.transform.BaseTransform;
+import com.sun.pisces.PiscesRenderer;
+import com.sun.pisces.RendererBase;
+import com.sun.pisces.Transform6;
+import com.sun.prism.sw.SWContextShim;
+import java.util.Random;
+
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Renders the same random fills on one thread and in parallel horizontal
+ * bands and verifies that the pixels are identical.
+ */
+public class PiscesBandsTest extends PiscesTestBase {
+
+    // large enough to be split into several bands
+    private static final int WIDTH = 601;
+    private static final int HEIGHT = 419;
+    private static final int THREADS = 4;
+    private static final int ROUNDS = 10;
+
+    @AfterAll
+    public static void restore() {
+        if (loaded) {
+            PiscesRenderer.setBandThreads(1);
+        }
+    }
+
+    private static void assertBandsMatch(Operation op) {
+        assumeTrue(loaded, "prism_sw library is not available");
+        assumeTrue(PiscesRenderer.setBandThreads(THREADS) > 1, "band rendering is not supported");
+        assertSamePixels(WIDTH, HEIGHT, ROUNDS,
+                         () -> PiscesRenderer.setBandThreads(1),
+                         () -> PiscesRenderer.setBandThreads(THREADS),
+                         (pr, random) -> {
+                             if (random.nextBoolean()) {
+                                 pr.setClip(random.nextInt(WIDTH / 4), random.nextInt(HEIGHT / 4),
+                                            WIDTH / 2 + random.nextInt(WIDTH / 2),
+                                            HEIGHT / 2 + random.nextInt(HEIGHT / 2));
+                             }
+                             op.render(pr, random);
+                         });
+    }
+
+    private static void fillRandomRect(PiscesRenderer pr, Random random) {
+        pr.fillRect(random.nextInt(WIDTH << 15), random.nextInt(HEIGHT << 15),
+                    (WIDTH << 15) + random.nextInt(WIDTH << 15),
+                    (HEIGHT << 15) + random.nextInt(HEIGHT << 15));
+    }
+
+    @Test
+    public void testFractionalFillRect() {
+        assertBandsMatch((pr, random) -> {
+            setRandomColor(pr, random);
+            fillRandomRect(pr, random);
+        });
+    }
+
+    @Test
+    public void testGradientFillRect() {
+        assertBandsMatch((pr, random) -> {
+            pr.setLinearGradient(0, 0, 0xff0000ff, WIDTH << 16, HEIGHT << 16, 0x80ff0000,
+                                 random.nextInt(3));
+            fillRandomRect(pr, random);
+        });
+    }
+
+    @Test
+    public void testDrawImage() {
+        assertBandsMatch((pr, random) -> {
+            int w = 1 + random.nextInt(WIDTH);
+            int h = 1 + random.nextInt(HEIGHT);
+            int[] image = new int[w * h];
+            for (int i = 0; i < image.length; i++) {
+                image[i] = 0xff000000 | random.nextInt();
+            }
+            // scaled to cover the surface, with bilinear filtering
+            Transform6 transform = new Transform6((WIDTH << 16) / w, 0, 0, (HEIGHT << 16) / h,
+                                                  random.nextInt(1 << 16), random.nextInt(1 << 16));
+            pr.drawImage(RendererBase.TYPE_INT_ARGB_PRE, RendererBase.IMAGE_MODE_NORMAL,
+                         image, w, h, 0, w, transform, false, true,
+                         0, 0, WIDTH << 16, HEIGHT << 16,
+                         RendererBase.IMAGE_FRAC_EDGE_KEEP, RendererBase.IMAGE_FRAC_EDGE_KEEP,
+                         RendererBase.IMAGE_FRAC_EDGE_KEEP, RendererBase.IMAGE_FRAC_EDGE_KEEP,
+                         0, 0, w - 1, h - 1, false);
+        });
+    }
+
+    @Test
+    public void testAlphaMask() {
+        assertBandsMatch((pr, random) -> {
+            pr.setColor(random.nextInt(256), random.nextInt(256), random.nextInt(256), 255);
+            int w = WIDTH / 2 + random.nextInt(WIDTH / 2);
+            int h = HEIGHT / 2 + random.nextInt(HEIGHT / 2);
+            byte[] mask = new byte[w * h];
+            random.nextBytes(mask);
+            pr.fillAlphaMask(mask, random.nextInt(WIDTH - w + 1) - 10,
+                             random.nextInt(HEIGHT - h + 1) - 10, w, h, 0, w);
+        });
+    }
+
+    @Test
+    public void testShapeFill() {
+        assertBandsMatch((pr, random) -> {
+            if (random.nextBoolean()) {
+                setRandomColor(pr, random);
+            } else {
+                pr.setLinearGradient(0, 0, randomPremultiplied(random),
+                                     WIDTH << 16, HEIGHT << 16, randomPremultiplied(random),
+                                     random.nextInt(3));
+            }
+            // an ellipse around most of the surface with a random polygon
+            // cut out of it, so that the coverage is fractional in places
+            Path2D path = new Path2D(Path2D.WIND_EVEN_ODD);
+            path.append(new Ellipse2D(-random.nextInt(WIDTH / 4), -random.nextInt(HEIGHT / 4),
+                                      WIDTH * 1.2f, HEIGHT * 1.2f), false);
+            path.moveTo(random.nextFloat() * WIDTH, random.nextFloat() * HEIGHT);
+            for (int i = 0; i < 8; i++) {
+                path.lineTo(random.nextFloat() * WIDTH, random.nextFloat() * HEIGHT);
+            }
+            path.closePath();
+            // the rasterizer is clipped like the renderer, as in SWGraphics
+            Rectangle clip = new Rectangle(random.nextInt(WIDTH / 8), random.nextInt(HEIGHT / 8),
+                                           WIDTH * 3 / 4 + random.nextInt(WIDTH / 8),
+                                           HEIGHT * 3 / 4 + random.nextInt(HEIGHT / 8));
+            pr.setClip(clip.x, clip.y, clip.width, clip.height);
+            SWContextShim.fillShape(pr, path, BaseTransform.IDENTITY_TRANSFORM, clip);
+        });
+    }
+}
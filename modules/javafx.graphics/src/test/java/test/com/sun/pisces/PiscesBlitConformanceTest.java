@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.pisces;
+
+import com.sun.pisces.PiscesRenderer;
+import com.sun.pisces.RendererBase;
+import com.sun.pisces.Transform6;
+import java.util.Random;
+
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Renders the same random operations with the vectorized and the scalar
+ * Pisces compositing loops and paint generators and verifies that the
+ * pixels are identical.
+ */
+public class PiscesBlitConformanceTest extends PiscesTestBase {
+
+    // odd sizes leave a remainder after every vector width
+    private static final int WIDTH = 203;
+    private static final int HEIGHT = 37;
+    private static final int ROUNDS = 20;
+
+    @AfterAll
+    public static void restore() {
+        if (loaded) {
+            PiscesRenderer.setSIMDEnabled(true);
+        }
+    }
+
+    private static void assertConforms(Operation op) {
+        assertSamePixels(WIDTH, HEIGHT, ROUNDS,
+                         () -> PiscesRenderer.setSIMDEnabled(false),
+                         () -> PiscesRenderer.setSIMDEnabled(true), op);
+    }
+
+    private static void emitRows(PiscesRenderer pr, Random random) {
+        byte[] alphaMap = new byte[256];
+        for (int i = 0; i < alphaMap.length; i++) {
+            alphaMap[i] = (byte) i;
+        }
+        int[] deltas = new int[WIDTH + 1];
+        for (int y = 0; y < HEIGHT; y++) {
+            int from = random.nextInt(WIDTH / 4);
+            int to = from + random.nextInt(WIDTH - from);
+            // coverage deltas whose running sum stays within the alpha map
+            int sum = 0;
+            for (int x = 0; x <= to - from; x++) {
+                int next = random.nextInt(4) == 0 ? random.nextInt(256) : sum;
+                deltas[x] = next - sum;
+                sum = next;
+            }
+            pr.emitAndClearAlphaRow(alphaMap, deltas, y, from, to, y);
+        }
+    }
+
+    @Test
+    public void testAlphaRowsWithColor() {
+        assertConforms((pr, random) -> {
+            setRandomColor(pr, random);
+            emitRows(pr, random);
+        });
+    }
+
+    @Test
+    public void testAlphaRowsWithGradient() {
+        assertConforms((pr, random) -> {
+            pr.setLinearGradient(0, 0, randomPremultiplied(random),
+                                 WIDTH << 16, HEIGHT << 16, randomPremultiplied(random),
+                                 random.nextInt(3));
+            emitRows(pr, random);
+        });
+    }
+
+    @Test
+    public void testAlphaMask() {
+        assertConforms((pr, random) -> {
+            setRandomColor(pr, random);
+            int w = 1 + random.nextInt(WIDTH - 1);
+            int h = 1 + random.nextInt(HEIGHT - 1);
+            byte[] mask = new byte[w * h];
+            for (int i = 0; i < mask.length; i++) {
+                int kind = random.nextInt(4);
+                mask[i] = (byte) (kind == 0 ? 0 : kind == 1 ? 255 : random.nextInt(256));
+            }
+            pr.fillAlphaMask(mask, random.nextInt(WIDTH - w + 1),
+                             random.nextInt(HEIGHT - h + 1), w, h, 0, w);
+        });
+    }
+
+    @Test
+    public void testFractionalFillRect() {
+        assertConforms((pr, random) -> {
+            for (int i = 0; i < 10; i++) {
+                setRandomColor(pr, random);
+                pr.fillRect(random.nextInt(WIDTH << 16), random.nextInt(HEIGHT << 16),
+                            random.nextInt(WIDTH << 16), random.nextInt(HEIGHT << 16));
+            }
+        });
+    }
+
+    @Test
+    public void testClearRect() {
+        assertConforms((pr, random) -> {
+            setRandomColor(pr, random);
+            pr.clearRect(random.nextInt(WIDTH), random.nextInt(HEIGHT),
+                         random.nextInt(WIDTH), random.nextInt(HEIGHT));
+        });
+    }
+
+    @Test
+    public void testRadialGradient() {
+        assertConforms((pr, random) -> {
+            int[] fractions = {0, random.nextInt(0x10000), 0x10000};
+            int[] rgba = {randomPremultiplied(random), randomPremultiplied(random),
+                          randomPremultiplied(random)};
+            int cx = random.nextInt(WIDTH << 16);
+            int cy = random.nextInt(HEIGHT << 16);
+            int radius = (1 + random.nextInt(WIDTH)) << 16;
+            pr.setRadialGradient(cx, cy, cx + random.nextInt(radius) - radius / 2,
+                                 cy + random.nextInt(radius) - radius / 2, radius,
+                                 fractions, rgba, random.nextInt(3), null);
+            pr.fillRect(0, 0, WIDTH << 16, HEIGHT << 16);
+        });
+    }
+
+    @Test
+    public void testTranslatedTexture() {
+        assertConforms((pr, random) -> {
+            int w = 1 + random.nextInt(WIDTH);
+            int h = 1 + random.nextInt(HEIGHT);
+            int[] texture = new int[w * h];
+            for (int i = 0; i < texture.length; i++) {
+                texture[i] = randomPremultiplied(random);
+            }
+            Transform6 transform = new Transform6(1 << 16, 0, 0, 1 << 16,
+                    random.nextInt(WIDTH << 16), random.nextInt(HEIGHT << 16));
+            pr.setTexture(RendererBase.TYPE_INT_ARGB_PRE, texture, w, h, w, transform,
+                          random.nextBoolean(), true, random.nextBoolean());
+            pr.fillRect(0, 0, WIDTH << 16, HEIGHT << 16);
+        });
+    }
+}
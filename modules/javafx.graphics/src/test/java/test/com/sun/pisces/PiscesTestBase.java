@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.pisces;
+
+import com.sun.glass.utils.NativeLibLoader;
+import com.sun.pisces.JavaSurface;
+import com.sun.pisces.PiscesRenderer;
+import com.sun.pisces.RendererBase;
+import java.util.Random;
+
+import org.junit.jupiter.api.BeforeAll;
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Base class of the tests that render the same random operations with two
+ * renderer configurations and compare the pixels.
+ */
+public abstract class PiscesTestBase {
+
+    protected static boolean loaded;
+
+    protected interface Operation {
+        void render(PiscesRenderer pr, Random random);
+    }
+
+    @BeforeAll
+    public static void loadLibrary() {
+        try {
+            NativeLibLoader.loadLibrary("prism_sw");
+            loaded = true;
+        } catch (UnsatisfiedLinkError e) {
+            loaded = false;
+        }
+    }
+
+    protected static int randomPremultiplied(Random random) {
+        int a = random.nextInt(3) == 0 ? 255 : random.nextInt(256);
+        int r = random.nextInt(a + 1);
+        int g = random.nextInt(a + 1);
+        int b = random.nextInt(a + 1);
+        return (a << 24) | (r << 16) | (g << 8) | b;
+    }
+
+    protected static void setRandomColor(PiscesRenderer pr, Random random) {
+        pr.setColor(random.nextInt(256), random.nextInt(256), random.nextInt(256),
+                    random.nextBoolean() ? 255 : random.nextInt(256));
+    }
+
+    /**
+     * Renders op with SRC_OVER into a width x height surface of random
+     * premultiplied pixels, using the same random numbers for the same seed.
+     */
+    protected static int[] render(int width, int height, long seed, Operation op) {
+        Random random = new Random(seed);
+        int[] data = new int[width * height];
+        for (int i = 0; i < data.length; i++) {
+            data[i] = randomPremultiplied(random);
+        }
+        JavaSurface surface = new JavaSurface(data, RendererBase.TYPE_INT_ARGB_PRE, width, height);
+        PiscesRenderer pr = new PiscesRenderer(surface);
+        pr.setCompositeRule(RendererBase.COMPOSITE_SRC_OVER);
+        op.render(pr, random);
+        return data;
+    }
+
+    /**
+     * Renders rounds random variations of op after running expectedSetup
+     * and again after running actualSetup, and verifies that the pixels are
+     * identical.
+     */
+    protected static void assertSamePixels(int width, int height, int rounds,
+                                           Runnable expectedSetup, Runnable actualSetup,
+                                           Operation op)
+    {
+        assumeTrue(loaded, "prism_sw library is not available");
+        for (int round = 0; round < rounds; round++) {
+            expectedSetup.run();
+            int[] expected = render(width, height, round, op);
+            actualSetup.run();
+            int[] actual = render(width, height, round, op);
+            assertArrayEquals(expected, actual, "round " + round);
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -144,13 +144,24 @@ public final class WebPage {
         final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
                 "com.sun.webkit.useDFGJIT", "false"));
 
+        // WebAssembly is only compiled in on 64-bit Linux; elsewhere these
+        // properties have no effect.
+        final boolean useWebAssembly = Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.useWebAssembly", "true"));
+        // Fast memory reserves a large virtual region per wasm memory and
+        // bounds checks through a SIGSEGV handler chained in front of the
+        // JVM's own handler. Disable it to fall back to explicit checks.
+        final boolean useWasmFastMemory = Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.useWasmFastMemory", "true"));
+
         // TODO: Enable CSS3D by default once it is stabilized.
         boolean useCSS3D = Boolean.valueOf(System.getProperty(
                 "com.sun.webkit.useCSS3D", "false"));
         useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
 
         // Initialize WTF, WebCore and JavaScriptCore.
-        twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+        twkInitWebCore(useJIT, useDFGJIT, useCSS3D,
+                       useWebAssembly, useWasmFastMemory);
 
         // Inform the native webkit code when either the JVM or the
         // JavaFX runtime is being shutdown
@@ -238,6 +249,9 @@ public final class WebPage {
 
     private WCPageBackBuffer backbuffer;
     private List<WCRectangle> dirtyRects = new LinkedList<>();
+    // Set when composited layers need to be synced or animated even though
+    // no part of the page has been invalidated.
+    private boolean compositingUpdatePending;
 
     private void addDirtyRect(WCRectangle toPaint) {
         if (toPaint.getWidth() <= 0 || toPaint.getHeight() <= 0) {
@@ -271,7 +285,7 @@ public final class WebPage {
     public boolean isDirty() {
         lockPage();
         try {
-            return !dirtyRects.isEmpty();
+            return !dirtyRects.isEmpty() || compositingUpdatePending;
         } finally {
             unlockPage();
         }
@@ -283,6 +297,7 @@ public final class WebPage {
                     new Object[] {dirtyRects, currentFrame});
         }
 
+        compositingUpdatePending = false;
         if (isDisposed || width <= 0 || height <= 0) {
             // If there're any dirty rects left, they are invalid.
             // Clear the list so that the platform doesn't consider
@@ -311,10 +326,16 @@ public final class WebPage {
         {
             WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
                     .createRenderQueue(clip, false);
+            // Composited layers are only re-rendered where they changed, on
+            // top of what the back buffer already holds. A transparent page
+            // has its whole clip cleared before this queue is decoded.
             twkPostPaint(getPage(), rq,
                          clip.getIntX(), clip.getIntY(),
-                         clip.getIntWidth(), clip.getIntHeight());
-            currentFrame.addRenderQueue(rq);
+                         clip.getIntWidth(), clip.getIntHeight(),
+                         backbuffer != null && !isBackgroundColorTransparent());
+            if (!rq.isEmpty()) {
+                currentFrame.addRenderQueue(rq);
+            }
         }
 
         if (paintLog.isLoggable(Level.FINEST)) {
@@ -759,6 +780,7 @@ public final class WebPage {
                 gc.restoreState();
             }
         }
+        PaintCommandProfiler.frameDone();
         paintLog.finest("Exiting");
     }
 
@@ -2150,6 +2172,15 @@ public final class WebPage {
         }
     }
 
+    private void fwkRequestCompositingUpdate() {
+        lockPage();
+        try {
+            compositingUpdatePending = true;
+        } finally {
+            unlockPage();
+        }
+    }
+
     private void fwkScroll(int x, int y, int w, int h, int deltaX, int deltaY) {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Scroll: " + x + " " + y + " " + w + " " + h + "  " + deltaX + " " + deltaY);
@@ -2594,7 +2625,8 @@ public final class WebPage {
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D,
+                                              boolean useWebAssembly, boolean useWasmFastMemory);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2656,7 +2688,8 @@ public final class WebPage {
     private native void twkUpdateContent(long pPage, WCRenderQueue rq, int x, int y, int w, int h);
     private native void twkUpdateRendering(long pPage);
     private native void twkPostPaint(long pPage, WCRenderQueue rq,
-                                     int x, int y, int w, int h);
+                                     int x, int y, int w, int h,
+                                     boolean incremental);
 
     private native String twkGetEncoding(long pPage);
     private native void twkSetEncoding(long pPage, String encoding);
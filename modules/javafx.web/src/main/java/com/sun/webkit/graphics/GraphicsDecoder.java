@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,6 +86,8 @@ public final class GraphicsDecoder  {
     @Native public final static int SET_MITER_LIMIT        = 54;
     @Native public final static int SET_TEXT_MODE          = 55;
     @Native public final static int SET_PERSPECTIVE_TRANSFORM = 56;
+    // color, count, then count x (x, y, w, h)
+    @Native public final static int FILLRECTS_FFFFI        = 57;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(GraphicsDecoder.class.getName());
@@ -100,7 +102,9 @@ public final class GraphicsDecoder  {
 
         ByteBuffer buf = bdata.getBuffer();
         buf.order(ByteOrder.nativeOrder());
+        final boolean profile = PaintCommandProfiler.isEnabled();
         while (buf.remaining() > 0) {
+            final int start = buf.position();
             int op = buf.getInt();
             switch(op) {
                 case FILLRECT_FFFF:
@@ -119,6 +123,18 @@ public final class GraphicsDecoder  {
                         buf.getFloat(),
                         getColor(buf));
                     break;
+                case FILLRECTS_FFFFI: {
+                    Color color = getColor(buf);
+                    for (int n = buf.getInt(); n > 0; n--) {
+                        gc.fillRect(
+                            buf.getFloat(),
+                            buf.getFloat(),
+                            buf.getFloat(),
+                            buf.getFloat(),
+                            color);
+                    }
+                    break;
+                }
                 case FILL_ROUNDED_RECT:
                     gc.fillRoundedRect(
                         // base rectangle
@@ -392,6 +408,9 @@ public final class GraphicsDecoder  {
                     log.fine("ERROR. Unknown primitive found");
                     break;
             }
+            if (profile) {
+                PaintCommandProfiler.record(op, buf.position() - start);
+            }
         }
     }
 
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.graphics;
+
+import com.sun.javafx.logging.PlatformLogger;
+
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Debug aid that collects per-frame histograms of the paint commands
+ * decoded by {@link GraphicsDecoder}: how many of each opcode were executed
+ * and how many bytes of the render queue they occupied.
+ *
+ * Enabled with {@code -Dcom.sun.webkit.graphics.profile=true}; each frame
+ * is reported through the {@code com.sun.webkit.graphics.PaintCommandProfiler}
+ * logger at INFO level.
+ */
+public final class PaintCommandProfiler {
+    private final static PlatformLogger log =
+            PlatformLogger.getLogger(PaintCommandProfiler.class.getName());
+
+    private static volatile boolean enabled = Boolean.valueOf(System.getProperty(
+            "com.sun.webkit.graphics.profile", "false"));
+
+    private static final int MAX_OPCODE = 64;
+    private static final String[] OPCODE_NAMES = opcodeNames();
+
+    private static final int[] counts = new int[MAX_OPCODE + 1];
+    private static final long[] bytes = new long[MAX_OPCODE + 1];
+    private static long frame;
+
+    private PaintCommandProfiler() {
+    }
+
+    public static boolean isEnabled() {
+        return enabled;
+    }
+
+    static void setEnabled(boolean value) {
+        enabled = value;
+    }
+
+    static synchronized void record(int op, int size) {
+        int slot = (op >= 0 && op < MAX_OPCODE) ? op : MAX_OPCODE;
+        counts[slot]++;
+        bytes[slot] += size;
+    }
+
+    /**
+     * Reports the histogram collected since the previous call and resets it.
+     * Called by the page once all render queues of a frame are decoded.
+     */
+    public static void frameDone() {
+        if (!enabled) {
+            return;
+        }
+        String report = report();
+        if (report != null) {
+            log.info(report);
+        }
+    }
+
+    /**
+     * Returns how many commands with the given opcode were decoded since the
+     * last report.
+     */
+    static synchronized int getCount(int op) {
+        return counts[(op >= 0 && op < MAX_OPCODE) ? op : MAX_OPCODE];
+    }
+
+    /**
+     * Returns the current histogram, most expensive opcodes first, and resets
+     * the counters, or {@code null} if nothing was decoded.
+     */
+    static synchronized String report() {
+        List<Integer> ops = new ArrayList<>();
+        long totalCount = 0;
+        long totalBytes = 0;
+        for (int i = 0; i <= MAX_OPCODE; i++) {
+            if (counts[i] > 0) {
+                ops.add(i);
+                totalCount += counts[i];
+                totalBytes += bytes[i];
+            }
+        }
+        frame++;
+        if (ops.isEmpty()) {
+            return null;
+        }
+        ops.sort((a, b) -> Long.compare(bytes[b], bytes[a]));
+
+        StringBuilder sb = new StringBuilder();
+        sb.append(String.format("frame %d: %d commands, %d bytes%n", frame, totalCount, totalBytes));
+        for (int op : ops) {
+            sb.append(String.format("  %-26s %8d %10d%n", OPCODE_NAMES[op], counts[op], bytes[op]));
+        }
+        Arrays.fill(counts, 0);
+        Arrays.fill(bytes, 0);
+        return sb.toString();
+    }
+
+    private static String[] opcodeNames() {
+        String[] names = new String[MAX_OPCODE + 1];
+        for (int i = 0; i < MAX_OPCODE; i++) {
+            names[i] = "#" + i;
+        }
+        names[MAX_OPCODE] = "<unknown>";
+        for (Field f : GraphicsDecoder.class.getFields()) {
+            int m = f.getModifiers();
+            if (Modifier.isStatic(m) && f.getType() == int.class) {
+                try {
+                    int op = f.getInt(null);
+                    if (op >= 0 && op < MAX_OPCODE) {
+                        names[op] = f.getName();
+                    }
+                } catch (IllegalAccessException e) {
+                    // keep the numeric name
+                }
+            }
+        }
+        return names;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -64,6 +64,23 @@
 
 namespace WebCore {
 
+// Records a paint state value about to be written to the rendering queue.
+// Returns false if the Java side already has it, so the command can be dropped.
+template<typename T>
+static bool updatePaintState(std::optional<T>& current, const T& value)
+{
+    if (current && *current == value)
+        return false;
+    current = value;
+    return true;
+}
+
+static std::array<float, 4> colorComponents(const Color& color)
+{
+    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    return { r, g, b, a };
+}
+
 static void setGradient(Gradient &gradient,
     const AffineTransform& gradientSpaceTransformation, PlatformGraphicsContext* context, jint id)
 {
@@ -93,6 +110,12 @@ static void setGradient(Gradient &gradient,
     p0 = gradientSpaceTransformation.mapPoint(p0);
     p1 = gradientSpaceTransformation.mapPoint(p1);
 
+    // The gradient replaces the solid paint on the Java side.
+    if (id == com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT)
+        context->paintState().fillColor = std::nullopt;
+    else
+        context->paintState().strokeColor = std::nullopt;
+
     context->rq().freeSpace(4 * 11 + 20 * nStops)
     << id
     << (jfloat)p0.x()
@@ -163,6 +186,7 @@ void GraphicsContextJava::savePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+    platformContext()->pushPaintState();
 }
 
 void GraphicsContextJava::restore(GraphicsContextState::Purpose) {
@@ -177,6 +201,7 @@ void GraphicsContextJava::restorePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+    platformContext()->popPaintState();
 }
 
 // Draws a filled rectangle with a stroked border.
@@ -230,12 +255,46 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, const Color& color)
     if (paintingDisabled())
         return;
 
-    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(36)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI
+    auto rgba = colorComponents(color);
+    RenderingQueue& rq = platformContext()->rq();
+    FillRectRun& run = platformContext()->fillRectRun();
+    ByteBuffer* buffer = rq.currentBuffer();
+
+    // Merge consecutive rects of the same color (table cells, borders,
+    // backgrounds) into a single FILLRECTS_FFFFI command.
+    if (buffer && run.bufferGeneration == rq.bufferGeneration()
+        && run.end == buffer->position() && run.color == rgba) {
+        bool isBatch = run.count > 1;
+        if (!isBatch && buffer->hasFreeSpace(20 + 16)) {
+            // Rewrite the previous FILLRECT_FFFFI as a run of one:
+            // op, x, y, w, h, r, g, b, a -> op, r, g, b, a, n, x, y, w, h
+            jfloat x = buffer->floatAt(run.start + 4);
+            jfloat y = buffer->floatAt(run.start + 8);
+            jfloat w = buffer->floatAt(run.start + 12);
+            jfloat h = buffer->floatAt(run.start + 16);
+            buffer->rewind(run.start);
+            rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECTS_FFFFI
+            << rgba[0] << rgba[1] << rgba[2] << rgba[3]
+            << (jint)1
+            << x << y << w << h;
+            isBatch = true;
+        }
+        if (isBatch && buffer->hasFreeSpace(16)) {
+            rq << rect.x() << rect.y() << rect.width() << rect.height();
+            buffer->putIntAt(run.start + 20, ++run.count);
+            run.end = buffer->position();
+            return;
+        }
+    }
+
+    rq.freeSpace(36);
+    buffer = rq.currentBuffer();
+    int start = buffer->position();
+    rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI
     << rect.x() << rect.y()
     << rect.width() << rect.height()
-    << r << g << b << a;
+    << rgba[0] << rgba[1] << rgba[2] << rgba[3];
+    run = { rq.bufferGeneration(), start, buffer->position(), 1, rgba };
 }
 
 void GraphicsContextJava::fillRect(const FloatRect& rect, RequiresClipToRect requiresClip)
@@ -495,6 +554,10 @@ void GraphicsContextJava::translate(float x, float y)
         return;
 
     m_state.transform.translate(x, y);
+    if (!x && !y)
+        return;
+
+    platformContext()->paintState().transform = std::nullopt;
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_TRANSLATE
     << x << y;
@@ -505,10 +568,13 @@ void GraphicsContextJava::setPlatformFillColor(const Color& color)
     if (paintingDisabled())
         return;
 
-    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    auto rgba = colorComponents(color);
+    if (!updatePaintState(platformContext()->paintState().fillColor, rgba))
+        return;
+
     platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
-    << r << g << b << a;
+    << rgba[0] << rgba[1] << rgba[2] << rgba[3];
 }
 
 void GraphicsContextJava::setPlatformTextDrawingMode(TextDrawingModeFlags mode)
@@ -530,6 +596,9 @@ void GraphicsContextJava::setPlatformStrokeStyle(StrokeStyle style)
     if (paintingDisabled())
         return;
 
+    if (!updatePaintState(platformContext()->paintState().strokeStyle, static_cast<int>(style)))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
     << (jint)style;
@@ -540,10 +609,13 @@ void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
     if (paintingDisabled())
         return;
 
-    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    auto rgba = colorComponents(color);
+    if (!updatePaintState(platformContext()->paintState().strokeColor, rgba))
+        return;
+
     platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
-    << r << g << b << a;
+    << rgba[0] << rgba[1] << rgba[2] << rgba[3];
 }
 
 void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
@@ -551,6 +623,9 @@ void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
     if (paintingDisabled())
         return;
 
+    if (!updatePaintState(platformContext()->paintState().strokeThickness, strokeThickness))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
     << strokeThickness;
@@ -577,6 +652,10 @@ void GraphicsContextJava::concatCTM(const AffineTransform& at)
         return;
 
     m_state.transform.multiply(at);
+    if (at.isIdentity())
+        return;
+
+    platformContext()->paintState().transform = std::nullopt;
     platformContext()->rq().freeSpace(28)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_CONCATTRANSFORM_FFFFFF
     << (float)at.a() << (float)at.b() << (float)at.c() << (float)at.d() << (float)at.e() << (float)at.f();
@@ -626,6 +705,11 @@ void GraphicsContextJava::beginTransparencyLayer(float opacity)
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_BEGINTRANSPARENCYLAYER
     << opacity;
+    platformContext()->pushPaintState();
+    // TransparencyLayer.init() resets the composite of the layer state, and
+    // the layer translates the transform like a clip layer does
+    platformContext()->paintState().compositeOperator = static_cast<int>(CompositeOperator::SourceOver);
+    platformContext()->paintState().transform = std::nullopt;
 }
 
 void GraphicsContextJava::endTransparencyLayer()
@@ -635,6 +719,7 @@ void GraphicsContextJava::endTransparencyLayer()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER;
+    platformContext()->popPaintState();
 
     GraphicsContext::endTransparencyLayer();
 }
@@ -727,6 +812,12 @@ void GraphicsContextJava::setMiterLimit(float limit)
 
 void GraphicsContextJava::setPlatformAlpha(float alpha)
 {
+    if (paintingDisabled())
+        return;
+
+    if (!updatePaintState(platformContext()->paintState().alpha, alpha))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETALPHA
     << alpha;
@@ -737,6 +828,9 @@ void GraphicsContextJava::setPlatformCompositeOperation(CompositeOperator op, Bl
     if (paintingDisabled())
         return;
 
+    if (!updatePaintState(platformContext()->paintState().compositeOperator, static_cast<int>(op)))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETCOMPOSITE
     << (jint)op;
@@ -773,6 +867,9 @@ static void setClipPath(
         return;
 
     state.clipBounds.intersect(state.transform.mapRect(path.fastBoundingRect()));
+    // The clip layer translates the Java side transform, and SET_TRANSFORM
+    // no longer adds the base transform inside a layer.
+    gc.platformContext()->paintState().transform = std::nullopt;
     gc.platformContext()->rq().freeSpace(16)
     << jint(com_sun_webkit_graphics_GraphicsDecoder_CLIP_PATH)
     << copyPath(path.platformPath())
@@ -912,6 +1009,10 @@ void GraphicsContextJava::rotate(float radians)
         return;
 
     m_state.transform.rotate(radians);
+    if (!radians)
+        return;
+
+    platformContext()->paintState().transform = std::nullopt;
     platformContext()->rq().freeSpace(2 * 4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_ROTATE
     << radians;
@@ -924,6 +1025,10 @@ void GraphicsContextJava::scale(const FloatSize& size)
         return;
 
     m_state.transform.scale(size.width(), size.height());
+    if (size.width() == 1 && size.height() == 1)
+        return;
+
+    platformContext()->paintState().transform = std::nullopt;
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SCALE
     << size.width() << size.height();
@@ -1071,9 +1176,13 @@ void GraphicsContextJava::setCTM(const AffineTransform& tm)
         return;
 
     m_state.transform = tm;
+    std::array<float, 6> matrix { (float)tm.a(), (float)tm.b(), (float)tm.c(), (float)tm.d(), (float)tm.e(), (float)tm.f() };
+    if (!updatePaintState(platformContext()->paintState().transform, matrix))
+        return;
+
     platformContext()->rq().freeSpace(28)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_TRANSFORM
-    << (float)tm.a() << (float)tm.b() << (float)tm.c() << (float)tm.d() << (float)tm.e() << (float)tm.f();
+    << matrix[0] << matrix[1] << matrix[2] << matrix[3] << matrix[4] << matrix[5];
 }
 
 void Gradient::stopsChanged()
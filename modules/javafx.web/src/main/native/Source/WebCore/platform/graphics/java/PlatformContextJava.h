@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,13 +29,42 @@
 #include "Path.h"
 #include "RenderingQueue.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
+#include <array>
 #include <jni.h>
+#include <optional>
 #include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
     RefPtr<RQRef> copyPath(RefPtr<RQRef> p);
 
+    // Paint state last written to the rendering queue. WCGraphicsPrismContext
+    // keeps all of these in its saved state, so the mirror is pushed and
+    // popped together with SAVESTATE/RESTORESTATE and transparency layers.
+    // An empty optional means the Java side value is unknown.
+    struct RQPaintState {
+        std::optional<std::array<float, 4>> fillColor;
+        std::optional<std::array<float, 4>> strokeColor;
+        std::optional<float> strokeThickness;
+        std::optional<int> strokeStyle;
+        std::optional<float> alpha;
+        std::optional<int> compositeOperator;
+        // The matrix of the last SET_TRANSFORM, until another transform
+        // command or a clip path layer changes the Java side transform.
+        std::optional<std::array<float, 6>> transform;
+    };
+
+    // The last solid color rect command, which a following rect of the same
+    // color is merged into as long as nothing else was written in between.
+    struct FillRectRun {
+        unsigned bufferGeneration { 0 };
+        int start { -1 };
+        int end { -1 };
+        int count { 0 };
+        std::array<float, 4> color { };
+    };
+
     class PlatformContextJava {
         WTF_MAKE_NONCOPYABLE(PlatformContextJava);
     public:
@@ -119,6 +148,25 @@ namespace WebCore {
         void setMiterLimit(float miterLimit) {
             m_miterLimit = miterLimit;
         }
+
+        RQPaintState& paintState() {
+            return m_paintStates.last();
+        }
+
+        void pushPaintState() {
+            m_paintStates.append(m_paintStates.last());
+        }
+
+        void popPaintState() {
+            if (m_paintStates.size() > 1)
+                m_paintStates.removeLast();
+            else
+                m_paintStates.last() = { };
+        }
+
+        FillRectRun& fillRectRun() {
+            return m_fillRectRun;
+        }
     private:
         RefPtr<RenderingQueue> m_rq;
         RefPtr<RQRef> m_jRenderTheme;
@@ -130,5 +178,7 @@ namespace WebCore {
         LineCap m_lineCap { };
         LineJoin m_lineJoin { };
         float m_miterLimit { };
+        Vector<RQPaintState, 8> m_paintStates { RQPaintState { } };
+        FillRectRun m_fillRectRun;
     };
 }
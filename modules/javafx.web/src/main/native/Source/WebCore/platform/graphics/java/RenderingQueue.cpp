@@ -66,6 +66,7 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
     }
     if (!m_buffer) {
         m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        ++m_bufferGeneration;
     }
     return *this;
 }
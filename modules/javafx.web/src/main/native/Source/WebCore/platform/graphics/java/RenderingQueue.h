@@ -74,6 +74,27 @@ public:
 
     bool hasFreeSpace(int size) { return m_position + size <= m_capacity; }
 
+    int position() const { return m_position; }
+
+    jfloat floatAt(int offset) const {
+        ASSERT(offset + sizeof(jfloat) <= static_cast<size_t>(m_position));
+        jfloat f;
+        memcpy(&f, m_buffer + offset, sizeof(jfloat));
+        return f;
+    }
+
+    void putIntAt(int offset, jint i) {
+        ASSERT(offset + sizeof(jint) <= static_cast<size_t>(m_position));
+        memcpy(m_buffer + offset, &i, sizeof(jint));
+    }
+
+    // Moves the write position back to an earlier offset so that the last
+    // command(s) can be rewritten in place.
+    void rewind(int position) {
+        ASSERT(position >= 0 && position <= m_position);
+        m_position = position;
+    }
+
     bool isEmpty() { return m_position == 0; }
 
     ~ByteBuffer() {
@@ -134,6 +155,13 @@ public:
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
+    // The buffer currently being written, or null if none is allocated.
+    ByteBuffer* currentBuffer() { return m_buffer.get(); }
+
+    // Changes every time a new buffer is started, so that a write offset
+    // recorded earlier can be checked to still refer to the current buffer.
+    unsigned bufferGeneration() const { return m_bufferGeneration; }
+
     bool isEmpty() {
         return m_buffer == nullptr || m_buffer->isEmpty();
     }
@@ -170,6 +198,7 @@ private:
     int m_capacity;
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
+    unsigned m_bufferGeneration { 0 };
 
 };
 } // namespace WebCore
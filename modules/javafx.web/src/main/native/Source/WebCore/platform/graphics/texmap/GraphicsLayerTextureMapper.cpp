@@ -71,12 +71,18 @@ void GraphicsLayerTextureMapper::setNeedsDisplay()
 
     // The current size might change, thus we need to update the whole display.
     m_needsDisplay = true;
+#if PLATFORM(JAVA)
+    m_damagedWholeLayer = true;
+#endif
     notifyChange(DisplayChange);
     addRepaintRect(FloatRect(FloatPoint(), m_size));
 }
 
 void GraphicsLayerTextureMapper::setContentsNeedsDisplay()
 {
+#if PLATFORM(JAVA)
+    m_damageRect.unite(contentsRect());
+#endif
     notifyChange(DisplayChange);
     addRepaintRect(contentsRect());
 }
@@ -89,10 +95,23 @@ void GraphicsLayerTextureMapper::setNeedsDisplayInRect(const FloatRect& rect, Sh
     if (m_needsDisplay)
         return;
     m_needsDisplayRect.unite(rect);
+#if PLATFORM(JAVA)
+    m_damageRect.unite(rect);
+#endif
     notifyChange(DisplayChange);
     addRepaintRect(rect);
 }
 
+#if PLATFORM(JAVA)
+FloatRect GraphicsLayerTextureMapper::takeDamageRect()
+{
+    FloatRect damageRect = m_damagedWholeLayer ? FloatRect(FloatPoint(), m_size) : m_damageRect;
+    m_damagedWholeLayer = false;
+    m_damageRect = FloatRect();
+    return damageRect;
+}
+#endif
+
 bool GraphicsLayerTextureMapper::setChildren(Vector<Ref<GraphicsLayer>>&& children)
 {
     if (GraphicsLayer::setChildren(WTFMove(children))) {
@@ -425,6 +444,15 @@ void GraphicsLayerTextureMapper::commitLayerChanges()
     if (m_changeMask == NoChanges)
         return;
 
+#if PLATFORM(JAVA)
+    // Geometry and opacity changes are picked up by comparing the layer's
+    // bounds between frames; anything else may change every pixel of it.
+    static constexpr int geometryChanges = ChildrenChange | PositionChange | AnchorPointChange
+        | SizeChange | TransformChange | DisplayChange | AnimationChange | AnimationStarted | OpacityChange;
+    if (m_changeMask & ~geometryChanges)
+        m_damagedWholeLayer = true;
+#endif
+
     if (m_changeMask & ChildrenChange) {
         auto rawChildren = WTF::map(children(), [](auto& child) -> TextureMapperLayer* {
             return &downcast<GraphicsLayerTextureMapper>(child.get()).layer();
@@ -94,6 +94,12 @@ public:
 
     TextureMapperLayer& layer() { return m_layer; }
 
+#if PLATFORM(JAVA)
+    // Returns the area of the layer, in layer coordinates, whose rendering
+    // changed since the last call, and resets it.
+    FloatRect takeDamageRect();
+#endif
+
     Color debugBorderColor() const { return m_debugBorderColor; }
     float debugBorderWidth() const { return m_debugBorderWidth; }
 
@@ -173,6 +179,10 @@ private:
     FloatRect m_needsDisplayRect;
     TextureMapperAnimations m_animations;
     MonotonicTime m_animationStartTime;
+#if PLATFORM(JAVA)
+    FloatRect m_damageRect;
+    bool m_damagedWholeLayer { true };
+#endif
 };
 
 } // namespace WebCore
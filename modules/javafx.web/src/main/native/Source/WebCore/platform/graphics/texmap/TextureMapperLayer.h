@@ -77,6 +77,10 @@ public:
     FloatSize size() const { return m_state.size; }
     float opacity() const { return m_state.opacity; }
     TransformationMatrix transform() const { return m_state.transform; }
+#if PLATFORM(JAVA)
+    float currentOpacity() const { return m_currentOpacity; }
+    const FilterOperations& currentFilters() const { return m_currentFilters; }
+#endif
     const TransformationMatrix& toSurfaceTransform() const { return m_layerTransforms.combined; }
     WEBCORE_EXPORT void setContentsVisible(bool);
     WEBCORE_EXPORT void setContentsOpaque(bool);
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "TileDamageTracker.h"
+
+namespace WebCore {
+
+void TileDamageTracker::setSize(const IntSize& size)
+{
+    if (m_size == size)
+        return;
+
+    m_size = size;
+    m_columns = size.width() > 0 ? (size.width() + tileSize - 1) / tileSize : 0;
+    m_rows = size.height() > 0 ? (size.height() + tileSize - 1) / tileSize : 0;
+    m_dirtyTiles.clearAll();
+    m_dirtyTiles.ensureSize(static_cast<size_t>(m_columns) * m_rows);
+    m_dirtyTileCount = 0;
+    addAll();
+}
+
+void TileDamageTracker::add(const IntRect& rect)
+{
+    IntRect damage = intersection(rect, IntRect(IntPoint(), m_size));
+    if (damage.isEmpty())
+        return;
+
+    int firstColumn = damage.x() / tileSize;
+    int lastColumn = (damage.maxX() - 1) / tileSize;
+    int firstRow = damage.y() / tileSize;
+    int lastRow = (damage.maxY() - 1) / tileSize;
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            if (!m_dirtyTiles.quickSet(tileIndex(column, row)))
+                ++m_dirtyTileCount;
+        }
+    }
+}
+
+void TileDamageTracker::addAll()
+{
+    add(IntRect(IntPoint(), m_size));
+}
+
+IntRect TileDamageTracker::tileRect(int column, int row) const
+{
+    return intersection(IntRect(column * tileSize, row * tileSize, tileSize, tileSize), IntRect(IntPoint(), m_size));
+}
+
+Vector<IntRect> TileDamageTracker::takeDamage(const IntRect& clip, size_t maxRects)
+{
+    Vector<IntRect> rects;
+    IntRect damageClip = intersection(clip, IntRect(IntPoint(), m_size));
+    if (!m_dirtyTileCount || damageClip.isEmpty())
+        return rects;
+
+    int firstColumn = damageClip.x() / tileSize;
+    int lastColumn = (damageClip.maxX() - 1) / tileSize;
+    int firstRow = damageClip.y() / tileSize;
+    int lastRow = (damageClip.maxY() - 1) / tileSize;
+
+    // Merge each row's horizontal runs of dirty tiles, then extend a run
+    // from the row above when it covers exactly the same columns.
+    Vector<IntRect> previousRow;
+    Vector<IntRect> currentRow;
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            if (!m_dirtyTiles.quickGet(tileIndex(column, row)))
+                continue;
+            int runStart = column;
+            while (column < lastColumn && m_dirtyTiles.quickGet(tileIndex(column + 1, row)))
+                ++column;
+            IntRect run = unionRect(tileRect(runStart, row), tileRect(column, row));
+
+            auto above = previousRow.findIf([&](const IntRect& rect) {
+                return rect.x() == run.x() && rect.width() == run.width();
+            });
+            if (above != notFound) {
+                run.shiftYEdgeTo(previousRow[above].y());
+                previousRow.removeAt(above);
+            }
+            currentRow.append(run);
+        }
+        rects.appendVector(previousRow);
+        previousRow = std::exchange(currentRow, { });
+    }
+    rects.appendVector(previousRow);
+
+    // Tiles only partly inside the clip stay damaged since their remainder
+    // has not been rendered yet.
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            size_t index = tileIndex(column, row);
+            if (m_dirtyTiles.quickGet(index) && damageClip.contains(tileRect(column, row))) {
+                m_dirtyTiles.quickClear(index);
+                --m_dirtyTileCount;
+            }
+        }
+    }
+
+    if (rects.size() > maxRects) {
+        IntRect bounds;
+        for (const auto& rect : rects)
+            bounds.unite(rect);
+        rects.clear();
+        rects.append(bounds);
+    }
+    for (auto& rect : rects)
+        rect.intersect(damageClip);
+    return rects;
+}
+
+} // namespace WebCore
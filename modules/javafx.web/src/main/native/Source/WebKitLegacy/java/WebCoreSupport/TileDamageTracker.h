@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <WebCore/IntRect.h>
+#include <wtf/BitVector.h>
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+// Tracks which fixed-size tiles of the page have been damaged since the
+// composited layers were last rendered into the page back buffer.
+//
+// WebCore's Damage only accumulates rectangles until it is reset as a
+// whole, while postPaint often renders only part of the page and the rest
+// of the damage has to survive until the next update. Its layer damage
+// collection is also built only with ENABLE(DAMAGE_TRACKING), which is set
+// for the GLib ports and fed by the coordinated graphics layers that the
+// Java port does not use.
+class TileDamageTracker {
+public:
+    static constexpr int tileSize = 256;
+
+    // Changing the size damages every tile.
+    void setSize(const IntSize&);
+    const IntSize& size() const { return m_size; }
+
+    void add(const IntRect&);
+    void addAll();
+
+    bool isEmpty() const { return !m_dirtyTileCount; }
+
+    // Returns the damaged tiles that intersect the clip, merged into
+    // rectangles and clipped to it. Tiles entirely inside the clip are no
+    // longer damaged afterwards. Falls back to the bounding rectangle when
+    // more than maxRects rectangles would be needed.
+    Vector<IntRect> takeDamage(const IntRect& clip, size_t maxRects);
+
+private:
+    size_t tileIndex(int column, int row) const { return static_cast<size_t>(row) * m_columns + column; }
+    IntRect tileRect(int column, int row) const;
+
+    IntSize m_size;
+    int m_columns { 0 };
+    int m_rows { 0 };
+    BitVector m_dirtyTiles;
+    size_t m_dirtyTileCount { 0 };
+};
+
+} // namespace WebCore
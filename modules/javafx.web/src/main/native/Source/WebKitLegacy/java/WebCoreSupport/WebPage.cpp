@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -253,6 +253,9 @@ RefPtr<RQRef> WebPage::jRenderTheme()
 void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
 {
     if (m_rootLayer) {
+        // Composited content is rendered in postPaint, only for the tiles
+        // that have been damaged.
+        m_compositedDamage.add(IntRect(x, y, w, h));
         return;
     }
 
@@ -282,7 +285,7 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
     gc.platformContext()->rq().flushBuffer();
 }
 
-void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
+void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h, bool incremental)
 {
     if (!m_page->inspectorController().highlightedNode()
             && !m_rootLayer
@@ -299,12 +302,31 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
             m_syncLayers = false;
             syncLayers();
         }
-        renderCompositedLayers(gc, IntRect(x, y, w, h));
-        if (m_page->settings().showDebugBorders()) {
-            drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 192, 0, 128 });
+
+        auto& rootLayer = downcast<GraphicsLayerTextureMapper>(*m_rootLayer);
+        static_cast<TextureMapperJavaAdapter*>(m_textureMapper.get())->setGraphicsContext(&gc);
+        rootLayer.layer().applyAnimationsRecursively(MonotonicTime::now());
+        rootLayer.updateBackingStoreIncludingSubLayers(*m_textureMapper);
+        collectCompositedDamage();
+
+        // Without a back buffer, or with the inspector highlight drawn on
+        // top, nothing of the previous frame can be reused.
+        IntRect clip(x, y, w, h);
+        static constexpr size_t maxDamageRects = 8;
+        Vector<IntRect> damage = m_compositedDamage.takeDamage(clip, maxDamageRects);
+        if (!incremental || m_page->inspectorController().highlightedNode()) {
+            damage.clear();
+            damage.append(clip);
+        }
+
+        for (const auto& rect : damage) {
+            renderCompositedLayers(gc, rect);
+            if (m_page->settings().showDebugBorders()) {
+                drawDebugLed(gc, rect, SRGBA<uint8_t> { 0, 192, 0, 128 });
+            }
         }
-        if (downcast<GraphicsLayerTextureMapper>(m_rootLayer.get())->layer().descendantsOrSelfHaveRunningAnimations()) {
-            requestJavaRepaint(pageRect());
+        if (rootLayer.layer().descendantsOrSelfHaveRunningAnimations()) {
+            requestJavaCompositingUpdate();
         }
     }
 
@@ -372,6 +394,20 @@ void WebPage::requestJavaRepaint(const IntRect& rect)
     WTF::CheckAndClearException(env);
 }
 
+void WebPage::requestJavaCompositingUpdate()
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(
+            PG_GetWebPageClass(env),
+            "fwkRequestCompositingUpdate",
+            "()V");
+    ASSERT(mid);
+
+    env->CallVoidMethod(jobjectFromPage(m_page.get()), mid);
+    WTF::CheckAndClearException(env);
+}
+
 void WebPage::setRootChildLayer(GraphicsLayer* layer)
 {
     if (layer) {
@@ -383,9 +419,12 @@ void WebPage::setRootChildLayer(GraphicsLayer* layer)
         m_rootLayer->addChild(*layer);
 
         m_textureMapper = std::make_unique<TextureMapperJavaAdapter>();
+        m_compositedDamage.setSize(pageRect().size());
+        m_compositedDamage.addAll();
     } else {
         m_rootLayer = nullptr;
         m_textureMapper.reset();
+        m_compositedLayerStates.clear();
     }
 }
 
@@ -405,7 +444,7 @@ void WebPage::markForSync()
         return;
     }
     m_syncLayers = true;
-    requestJavaRepaint(pageRect());
+    requestJavaCompositingUpdate();
 }
 
 void WebPage::syncLayers()
@@ -436,6 +475,11 @@ IntRect WebPage::pageRect()
     return IntRect(client.pageRect());
 }
 
+// Runs on the event thread with the page lock held, like layout and
+// JavaScript. TextureMapperJava records into the RenderingQueue, whose
+// RQRef images are registered through JNI with WCGraphicsManager under that
+// lock, and the layer tree is shared with the main-thread GraphicsLayers, so
+// layers cannot be composited on a thread of their own.
 void WebPage::renderCompositedLayers(GraphicsContext& context, const IntRect& clip)
 {
     ASSERT(m_rootLayer);
@@ -449,13 +493,89 @@ void WebPage::renderCompositedLayers(GraphicsContext& context, const IntRect& cl
     TransformationMatrix matrix;
     m_textureMapper->beginPainting();
     m_textureMapper->beginClip(matrix, FloatRoundedRect(clip));
-    rootTextureMapperLayer.applyAnimationsRecursively(MonotonicTime::now());
-    downcast<GraphicsLayerTextureMapper>(*m_rootLayer).updateBackingStoreIncludingSubLayers(*m_textureMapper);
     rootTextureMapperLayer.paint(*m_textureMapper);
     m_textureMapper->endClip();
     m_textureMapper->endPainting();
 }
 
+void WebPage::collectCompositedDamage()
+{
+    ASSERT(m_rootLayer);
+
+    m_compositedDamage.setSize(pageRect().size());
+    downcast<GraphicsLayerTextureMapper>(*m_rootLayer).layer().prepareForPainting(*m_textureMapper);
+
+    CompositedLayerStates states;
+    collectCompositedDamage(*m_rootLayer, 1, false, false, states);
+
+    // Layers that were rendered in the previous frame but have been removed
+    // since leave their old area damaged.
+    for (auto& entry : m_compositedLayerStates) {
+        if (!states.contains(entry.key))
+            m_compositedDamage.add(entry.value.bounds);
+    }
+    m_compositedLayerStates = WTFMove(states);
+}
+
+void WebPage::collectCompositedDamage(GraphicsLayer& graphicsLayer, float opacity, bool inReplica, bool reordered, CompositedLayerStates& states)
+{
+    auto& layer = downcast<GraphicsLayerTextureMapper>(graphicsLayer);
+    auto& textureMapperLayer = layer.layer();
+    const auto& transform = textureMapperLayer.toSurfaceTransform();
+    const auto& filters = textureMapperLayer.currentFilters();
+    opacity *= textureMapperLayer.currentOpacity();
+
+    // Filters such as blur and drop-shadow draw outside of the layer.
+    auto toPage = [&](FloatRect rect) {
+        if (inReplica || !transform.isAffine())
+            return pageRect();
+        if (filters.hasOutsets()) {
+            auto outsets = filters.outsets();
+            rect.expand(FloatBoxExtent(outsets.top(), outsets.right(), outsets.bottom(), outsets.left()));
+        }
+        return enclosingIntRect(transform.mapRect(rect));
+    };
+
+    IntRect bounds;
+    if (textureMapperLayer.contentsAreVisible() && opacity > 0) {
+        bounds = toPage(FloatRect(FloatPoint(), textureMapperLayer.size()));
+        FloatRect damage = layer.takeDamageRect();
+        if (!damage.isEmpty())
+            m_compositedDamage.add(toPage(damage));
+    }
+
+    auto children = WTF::map(graphicsLayer.children(), [](auto& child) -> const GraphicsLayer* {
+        return &child.get();
+    });
+
+    // Moved, transformed, faded or re-filtered layers damage both their old
+    // and new area. A flip or rotation by 180 degrees keeps the bounds, so
+    // the transform itself is compared. Layers whose stacking order changed
+    // relative to a sibling are damaged the same way.
+    auto previous = m_compositedLayerStates.find(&graphicsLayer);
+    bool childrenReordered = false;
+    if (previous == m_compositedLayerStates.end()
+        || reordered
+        || previous->value.bounds != bounds
+        || previous->value.transform != transform
+        || previous->value.opacity != opacity
+        || previous->value.filters != filters) {
+        if (previous != m_compositedLayerStates.end())
+            m_compositedDamage.add(previous->value.bounds);
+        m_compositedDamage.add(bounds);
+    }
+    if (previous != m_compositedLayerStates.end())
+        childrenReordered = previous->value.children != children;
+    states.set(&graphicsLayer, CompositedLayerState { bounds, transform, opacity, filters, WTFMove(children) });
+
+    inReplica |= !!graphicsLayer.replicaLayer();
+    reordered |= childrenReordered;
+    if (auto* maskLayer = graphicsLayer.maskLayer())
+        collectCompositedDamage(*maskLayer, opacity, inReplica, reordered, states);
+    for (auto& child : graphicsLayer.children())
+        collectCompositedDamage(child.get(), opacity, inReplica, reordered, states);
+}
+
 void WebPage::notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/)
 {
     ASSERT_NOT_REACHED();
@@ -876,16 +996,21 @@ namespace {
 bool s_useJIT;
 bool s_useDFGJIT;
 bool s_useCSS3D;
+bool s_useWebAssembly;
+bool s_useWasmFastMemory;
 
 }  // namespace
 
 extern "C" {
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D,
+     jboolean useWebAssembly, jboolean useWasmFastMemory) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
     s_useCSS3D = useCSS3D;
+    s_useWebAssembly = useWebAssembly;
+    s_useWasmFastMemory = useWasmFastMemory;
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
@@ -893,6 +1018,33 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
 {
     // FIXME-java(JDK-8169950): Refactor the following WebCore module
     // initialization flow.
+    static std::once_flag initializeJSCOptions;
+    std::call_once(initializeJSCOptions, [] {
+        // JSC::initialize() finalizes the options and sets up the JIT, wasm
+        // fast memory and the fault handler from them, so they must be
+        // changed before it runs.
+        WTF::initialize();
+        JSC::Options::initialize();
+        JSC::Options::AllowUnfinalizedAccessScope scope;
+        JSC::Options::useJIT() = s_useJIT;
+        // Enable DFG only if JIT is enabled.
+        JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+#if ENABLE(FTL_JIT)
+        // FTL is only built as a prerequisite of the wasm BBQ tier.
+        JSC::Options::useFTLJIT() = false;
+#endif
+#if ENABLE(WEBASSEMBLY)
+        JSC::Options::useWasm() = s_useWebAssembly;
+        JSC::Options::useBBQJIT() = s_useJIT;
+        JSC::Options::useOMGJIT() = false;
+        // The wasm fault handler is installed after the JVM's and chains to
+        // it for faults outside of wasm code, so implicit null checks and
+        // stack banging in Java frames keep working.
+        JSC::Options::useWasmFaultSignalHandler() = s_useWasmFastMemory;
+        JSC::Options::useWasmFastMemory() = s_useWasmFastMemory;
+#endif
+        JSC::Options::notifyOptionsChanged();
+    });
     JSC::initialize();
     WTF::initializeMainThread();
     // JDK-8128763: Allow local loads for substitute data, that is,
@@ -909,13 +1061,6 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
 #endif
     WebCore::PlatformStrategiesJava::initialize();
 
-    static std::once_flag initializeJSCOptions;
-    std::call_once(initializeJSCOptions, [] {
-        JSC::Options::useJIT() = s_useJIT;
-        // Enable DFG only if JIT is enabled.
-        JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
-    });
-
     JLObject jlself(self, true);
 
     //utaTODO: history agent implementation
@@ -1755,9 +1900,9 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateRendering
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPostPaint
-  (JNIEnv*, jobject, jlong pPage, jobject rq, jint x, jint y, jint w, jint h)
+  (JNIEnv*, jobject, jlong pPage, jobject rq, jint x, jint y, jint w, jint h, jboolean incremental)
 {
-    WebPage::webPageFromJLong(pPage)->postPaint(rq, x, y, w, h);
+    WebPage::webPageFromJLong(pPage)->postPaint(rq, x, y, w, h, jbool_to_bool(incremental));
 }
 
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetEncoding
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,10 @@
 
 #include "MediaPlayerPrivateJava.h"
 #include "TextureMapperJavaAdapter.h"
+#include "TileDamageTracker.h"
+#include <WebCore/FilterOperations.h>
+#include <WebCore/TransformationMatrix.h>
+#include <wtf/HashMap.h>
 
 #include <jni.h> // todo tav remove when building w/ pch
 
@@ -86,7 +90,7 @@ public:
     void setSize(const IntSize&);
     void prePaint();
     void paint(jobject, jint, jint, jint, jint);
-    void postPaint(jobject, jint, jint, jint, jint);
+    void postPaint(jobject, jint, jint, jint, jint, bool);
     bool processKeyEvent(const PlatformKeyboardEvent& event);
 
     void scroll(const IntSize& scrollDelta, const IntRect& rectToScroll,
@@ -107,10 +111,15 @@ public:
 
 private:
     void requestJavaRepaint(const IntRect&);
+    void requestJavaCompositingUpdate();
     void markForSync();
     void syncLayers();
     IntRect pageRect();
     void renderCompositedLayers(GraphicsContext&, const IntRect&);
+    void collectCompositedDamage();
+    struct CompositedLayerState;
+    using CompositedLayerStates = HashMap<const GraphicsLayer*, CompositedLayerState>;
+    void collectCompositedDamage(GraphicsLayer&, float opacity, bool inReplica, bool reordered, CompositedLayerStates&);
 
     // GraphicsLayerClient
     void notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/) override;
@@ -137,6 +146,18 @@ private:
     std::unique_ptr<TextureMapper> m_textureMapper;
     bool m_syncLayers { false };
 
+    // Damage of the composited page, tracked per tile so that only the
+    // affected parts of the back buffer are rendered again.
+    struct CompositedLayerState {
+        IntRect bounds;
+        TransformationMatrix transform;
+        float opacity;
+        FilterOperations filters;
+        Vector<const GraphicsLayer*> children;
+    };
+    TileDamageTracker m_compositedDamage;
+    CompositedLayerStates m_compositedLayerStates;
+
     // Webkit expects keyPress events to be suppressed if the associated keyDown
     // event was handled. Safari implements this behavior by peeking out the
     // associated WM_CHAR event if the keydown was handled. We emulate
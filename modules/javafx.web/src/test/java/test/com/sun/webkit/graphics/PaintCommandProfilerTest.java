@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit.graphics;
+
+import com.sun.webkit.graphics.GraphicsDecoder;
+import com.sun.webkit.graphics.PaintCommandProfilerShim;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class PaintCommandProfilerTest {
+
+    @BeforeEach
+    public void setUp() {
+        // discard anything recorded by earlier tests
+        PaintCommandProfilerShim.report();
+    }
+
+    @Test
+    public void testEmptyFrameHasNoReport() {
+        assertNull(PaintCommandProfilerShim.report());
+    }
+
+    @Test
+    public void testReportIsSortedByBytes() {
+        for (int i = 0; i < 10; i++) {
+            PaintCommandProfilerShim.record(GraphicsDecoder.SETFILLCOLOR, 20);
+        }
+        PaintCommandProfilerShim.record(GraphicsDecoder.FILLRECTS_FFFFI, 24 + 16 * 50);
+
+        String report = PaintCommandProfilerShim.report();
+        assertTrue(report.contains("11 commands, 1024 bytes"), report);
+        int rects = report.indexOf("FILLRECTS_FFFFI");
+        int colors = report.indexOf("SETFILLCOLOR");
+        assertTrue(rects > 0 && colors > rects, report);
+    }
+
+    @Test
+    public void testReportResetsCounters() {
+        PaintCommandProfilerShim.record(GraphicsDecoder.DRAWLINE, 20);
+        PaintCommandProfilerShim.report();
+        assertNull(PaintCommandProfilerShim.report());
+    }
+
+    @Test
+    public void testUnknownOpcodesAreGrouped() {
+        PaintCommandProfilerShim.record(1000, 4);
+        PaintCommandProfilerShim.record(-1, 4);
+        String report = PaintCommandProfilerShim.report();
+        assertTrue(report.contains("<unknown>"), report);
+        assertTrue(report.contains("2 commands, 8 bytes"), report);
+    }
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageShim;
+import com.sun.webkit.graphics.GraphicsDecoder;
+import com.sun.webkit.graphics.PaintCommandProfilerShim;
+import java.awt.Color;
+import java.awt.image.BufferedImage;
+import javafx.scene.web.WebEngineShim;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+/**
+ * Checks that GraphicsContextJava drops the paint state commands the Java
+ * side already has, and that the result is still drawn correctly when the
+ * state is saved and restored or a transparency layer ends.
+ */
+public class PaintStateTest extends TestBase {
+
+    private static final String CANVAS_SCRIPT = "<body><script>\n"
+            + "var canvas = document.createElement('canvas');\n"
+            + "canvas.width = canvas.height = 100;\n"
+            + "var ctx = canvas.getContext('2d');\n"
+            + "function pixel(x, y) {\n"
+            + "    return Array.from(ctx.getImageData(x, y, 1, 1).data).join();\n"
+            + "}\n"
+            + "</script></body>";
+
+    private static final String RED = "255,0,0,255";
+    private static final String BLUE = "0,0,255,255";
+    private static final String LIME = "0,255,0,255";
+    private static final String TRANSPARENT = "0,0,0,0";
+
+    @BeforeEach
+    public void enableProfiler() {
+        PaintCommandProfilerShim.setEnabled(true);
+        // discard anything recorded before
+        PaintCommandProfilerShim.report();
+    }
+
+    @AfterEach
+    public void disableProfiler() {
+        PaintCommandProfilerShim.setEnabled(false);
+        PaintCommandProfilerShim.report();
+    }
+
+    private static int count(int op) {
+        return PaintCommandProfilerShim.getCount(op);
+    }
+
+    @Test
+    public void testRepeatedStateIsDropped() {
+        loadContent(CANVAS_SCRIPT);
+        executeScript("ctx.fillStyle = 'red'; ctx.strokeStyle = 'blue'; pixel(0, 0);");
+        PaintCommandProfilerShim.report();
+
+        // Every state update writes all the state that changed before it
+        // again, and resetTransform always sets the transform.
+        String color = (String) executeScript(
+                "for (var i = 0; i < 50; i++) {\n"
+                + "    ctx.lineWidth = 1 + i % 2;\n"
+                + "    ctx.resetTransform();\n"
+                + "    ctx.fillRect(i, 0, 1, 10);\n"
+                + "}\n"
+                + "pixel(10, 5);");
+        assertEquals(RED, color);
+        assertTrue(count(GraphicsDecoder.SETSTROKEWIDTH) >= 40,
+                "stroke widths: " + count(GraphicsDecoder.SETSTROKEWIDTH));
+        assertTrue(count(GraphicsDecoder.SETFILLCOLOR) <= 1,
+                "fill colors: " + count(GraphicsDecoder.SETFILLCOLOR));
+        assertTrue(count(GraphicsDecoder.SETSTROKECOLOR) <= 1,
+                "stroke colors: " + count(GraphicsDecoder.SETSTROKECOLOR));
+        assertTrue(count(GraphicsDecoder.SET_TRANSFORM) <= 1,
+                "transforms: " + count(GraphicsDecoder.SET_TRANSFORM));
+    }
+
+    @Test
+    public void testStateAfterRestore() {
+        loadContent(CANVAS_SCRIPT);
+        executeScript(
+                "ctx.resetTransform();\n"
+                + "ctx.fillStyle = 'red';\n"
+                + "ctx.fillRect(0, 20, 10, 10);\n"
+                + "ctx.save();\n"
+                + "ctx.fillStyle = 'blue';\n"
+                + "ctx.translate(50, 0);\n"
+                + "ctx.fillRect(0, 20, 10, 10);\n"
+                + "ctx.restore();\n"
+                // writes the red fill again, which the restore brought back
+                + "ctx.lineWidth = 3;\n"
+                + "ctx.resetTransform();\n"
+                + "ctx.fillRect(20, 20, 10, 10);\n"
+                + "ctx.save();\n"
+                + "ctx.translate(0, 50);\n"
+                + "ctx.resetTransform();\n"
+                + "ctx.translate(60, 50);\n"
+                + "ctx.fillStyle = 'lime';\n"
+                + "ctx.fillRect(0, 0, 10, 10);\n"
+                + "ctx.restore();\n"
+                + "ctx.resetTransform();\n"
+                + "ctx.fillRect(0, 50, 10, 10);\n");
+
+        assertEquals(RED, executeScript("pixel(5, 25)"));
+        assertEquals(BLUE, executeScript("pixel(55, 25)"));
+        assertEquals(RED, executeScript("pixel(25, 25)"));
+        assertEquals(LIME, executeScript("pixel(65, 55)"));
+        assertEquals(RED, executeScript("pixel(5, 55)"));
+        assertEquals(TRANSPARENT, executeScript("pixel(55, 55)"));
+        assertTrue(count(GraphicsDecoder.SAVESTATE) > 0, "no state was saved");
+    }
+
+    @Test
+    public void testStateAfterTransparencyLayer() {
+        final String box = "height: 100px; width: 100px; transform: translate(100px, 0px);";
+        loadContent("<html>\n"
+                + "<body style='margin: 0px;'>\n"
+                + "<div style='" + box + " background-color: #00f;'></div>\n"
+                + "<div style='" + box + " background-color: #f00; opacity: 0.5;'></div>\n"
+                + "<div style='" + box + " background-color: #00f;'></div>\n"
+                + "</body>\n"
+                + "</html>");
+        submit(() -> {
+            final WebPage webPage = WebEngineShim.getPage(getEngine());
+            assertNotNull(webPage);
+            final BufferedImage img = WebPageShim.paint(webPage, 0, 0, 400, 400);
+            assertNotNull(img);
+            assertTrue(count(GraphicsDecoder.BEGINTRANSPARENCYLAYER) > 0, "no layer was drawn");
+
+            final Color pixelAt150x50 = new Color(img.getRGB(150, 50), true);
+            assertTrue(isColorsSimilar(Color.BLUE, pixelAt150x50, 1), "Color should be blue:" + pixelAt150x50);
+            final Color pixelAt150x150 = new Color(img.getRGB(150, 150), true);
+            assertTrue(isColorsSimilar(new Color(255, 128, 128), pixelAt150x150, 1), "Color should be light red:" + pixelAt150x150);
+            final Color pixelAt150x250 = new Color(img.getRGB(150, 250), true);
+            assertTrue(isColorsSimilar(Color.BLUE, pixelAt150x250, 1), "Color should be blue:" + pixelAt150x250);
+            final Color pixelAt50x250 = new Color(img.getRGB(50, 250), true);
+            assertTrue(isColorsSimilar(Color.WHITE, pixelAt50x250, 1), "Color should be white:" + pixelAt50x250);
+        });
+    }
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.javafx.PlatformUtil;
+
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+public class WebAssemblyTest extends TestBase {
+
+    // (module (func (export "add") (param i32 i32) (result i32)
+    //     local.get 0 local.get 1 i32.add))
+    private static final String ADD_MODULE =
+            "[0x00,0x61,0x73,0x6d,0x01,0x00,0x00,0x00," +
+            "0x01,0x07,0x01,0x60,0x02,0x7f,0x7f,0x01,0x7f," +
+            "0x03,0x02,0x01,0x00," +
+            "0x07,0x07,0x01,0x03,0x61,0x64,0x64,0x00,0x00," +
+            "0x0a,0x09,0x01,0x07,0x00,0x20,0x00,0x20,0x01,0x6a,0x0b]";
+
+    // (module (memory 1) (func (export "load") (param i32) (result i32)
+    //     local.get 0 i32.load))
+    private static final String LOAD_MODULE =
+            "[0x00,0x61,0x73,0x6d,0x01,0x00,0x00,0x00," +
+            "0x01,0x06,0x01,0x60,0x01,0x7f,0x01,0x7f," +
+            "0x03,0x02,0x01,0x00," +
+            "0x05,0x03,0x01,0x00,0x01," +
+            "0x07,0x08,0x01,0x04,0x6c,0x6f,0x61,0x64,0x00,0x00," +
+            "0x0a,0x09,0x01,0x07,0x00,0x20,0x00,0x28,0x02,0x00,0x0b]";
+
+    // (module (memory 1 4)
+    //     (func (export "grow") (param i32) (result i32) local.get 0 memory.grow)
+    //     (func (export "load") (param i32) (result i32) local.get 0 i32.load))
+    private static final String GROW_MODULE =
+            "[0x00,0x61,0x73,0x6d,0x01,0x00,0x00,0x00,0x01,0x06,0x01,0x60,0x01,0x7f,0x01,0x7f," +
+            "0x03,0x03,0x02,0x00,0x00,0x05,0x04,0x01,0x01,0x01,0x04,0x07,0x0f,0x02,0x04,0x67," +
+            "0x72,0x6f,0x77,0x00,0x00,0x04,0x6c,0x6f,0x61,0x64,0x00,0x01,0x0a,0x10,0x02,0x06," +
+            "0x00,0x20,0x00,0x40,0x00,0x0b,0x07,0x00,0x20,0x00,0x28,0x02,0x00,0x0b]";
+
+    // (module (func (export "div") (param i32 i32) (result i32)
+    //     local.get 0 local.get 1 i32.div_s)
+    //     (func (export "trap") unreachable))
+    private static final String TRAP_MODULE =
+            "[0x00,0x61,0x73,0x6d,0x01,0x00,0x00,0x00,0x01,0x0a,0x02,0x60,0x02,0x7f,0x7f,0x01," +
+            "0x7f,0x60,0x00,0x00,0x03,0x03,0x02,0x00,0x01,0x07,0x0e,0x02,0x03,0x64,0x69,0x76," +
+            "0x00,0x00,0x04,0x74,0x72,0x61,0x70,0x00,0x01,0x0a,0x0d,0x02,0x07,0x00,0x20,0x00," +
+            "0x20,0x01,0x6d,0x0b,0x03,0x00,0x00,0x0b]";
+
+    // (module (func $f (export "recurse") (param i32) (result i32)
+    //     local.get 0 local.get 0 i32.const 1 i32.add call $f i32.add))
+    private static final String RECURSE_MODULE =
+            "[0x00,0x61,0x73,0x6d,0x01,0x00,0x00,0x00,0x01,0x06,0x01,0x60,0x01,0x7f,0x01,0x7f," +
+            "0x03,0x02,0x01,0x00,0x07,0x0b,0x01,0x07,0x72,0x65,0x63,0x75,0x72,0x73,0x65,0x00," +
+            "0x00,0x0a,0x0e,0x01,0x0c,0x00,0x20,0x00,0x20,0x00,0x41,0x01,0x6a,0x10,0x00,0x6a," +
+            "0x0b]";
+
+    // (module (type $v (func (result i32))) (type $i (func (param i32) (result i32)))
+    //     (table 1 funcref) (elem (i32.const 0) $seven)
+    //     (func $seven (type $v) i32.const 7)
+    //     (func (export "callWrongType") (type $i)
+    //         i32.const 0 local.get 0 call_indirect (type $i))
+    //     (func (export "callRight") (type $i)
+    //         local.get 0 call_indirect (type $v)))
+    private static final String INDIRECT_MODULE =
+            "[0x00,0x61,0x73,0x6d,0x01,0x00,0x00,0x00,0x01,0x0a,0x02,0x60,0x00,0x01,0x7f,0x60," +
+            "0x01,0x7f,0x01,0x7f,0x03,0x04,0x03,0x00,0x01,0x01,0x04,0x04,0x01,0x70,0x00,0x01," +
+            "0x07,0x1d,0x02,0x0d,0x63,0x61,0x6c,0x6c,0x57,0x72,0x6f,0x6e,0x67,0x54,0x79,0x70," +
+            "0x65,0x00,0x01,0x09,0x63,0x61,0x6c,0x6c,0x52,0x69,0x67,0x68,0x74,0x00,0x02,0x09," +
+            "0x07,0x01,0x00,0x41,0x00,0x0b,0x01,0x00,0x0a,0x18,0x03,0x04,0x00,0x41,0x07,0x0b," +
+            "0x09,0x00,0x41,0x00,0x20,0x00,0x11,0x01,0x00,0x0b,0x07,0x00,0x20,0x00,0x11,0x00," +
+            "0x00,0x0b]";
+
+    private static boolean isWebAssemblySupported() {
+        final String arch = System.getProperty("os.arch");
+        return PlatformUtil.isLinux()
+                && ("amd64".equals(arch) || "x86_64".equals(arch) || "aarch64".equals(arch));
+    }
+
+    private Object instantiateAndCall(String module, String call) {
+        return executeScript(
+                "(function() {" +
+                "  var m = new WebAssembly.Module(new Uint8Array(" + module + "));" +
+                "  var e = new WebAssembly.Instance(m, {}).exports;" +
+                "  try {" +
+                "    return String(" + call + ");" +
+                "  } catch (ex) {" +
+                "    return ex.constructor.name;" +
+                "  }" +
+                "})()");
+    }
+
+    @BeforeEach
+    public void before() {
+        assumeTrue(isWebAssemblySupported());
+        loadContent("<html><body></body></html>");
+    }
+
+    @Test
+    public void testWebAssemblyObjectAvailable() {
+        assertEquals("object", executeScript("typeof WebAssembly"));
+    }
+
+    @Test
+    public void testCallExportedFunction() {
+        assertEquals("42", instantiateAndCall(ADD_MODULE, "e.add(40, 2)"));
+    }
+
+    @Test
+    public void testInBoundsLoad() {
+        assertEquals("0", instantiateAndCall(LOAD_MODULE, "e.load(65532)"));
+    }
+
+    @Test
+    public void testOutOfBoundsLoadTraps() {
+        // With fast memory this goes through the wasm SIGSEGV handler, which
+        // must win over the JVM's handler and must not crash the VM.
+        assertEquals("RuntimeError", instantiateAndCall(LOAD_MODULE, "e.load(65536)"));
+        assertEquals("RuntimeError", instantiateAndCall(LOAD_MODULE, "e.load(-4)"));
+    }
+
+    @Test
+    public void testLoadAfterGrow() {
+        assertEquals("RuntimeError", instantiateAndCall(GROW_MODULE, "e.load(65536)"));
+        assertEquals("0", instantiateAndCall(GROW_MODULE, "(e.grow(1), e.load(65536))"));
+        assertEquals("RuntimeError", instantiateAndCall(GROW_MODULE, "(e.grow(1), e.load(131069))"));
+        assertEquals("-1", instantiateAndCall(GROW_MODULE, "e.grow(4)"));
+        assertEquals("1", instantiateAndCall(GROW_MODULE, "e.grow(3)"));
+    }
+
+    @Test
+    public void testArithmeticTraps() {
+        assertEquals("3", instantiateAndCall(TRAP_MODULE, "e.div(7, 2)"));
+        assertEquals("RuntimeError", instantiateAndCall(TRAP_MODULE, "e.div(7, 0)"));
+        assertEquals("RuntimeError", instantiateAndCall(TRAP_MODULE, "e.div(-2147483648, -1)"));
+        assertEquals("RuntimeError", instantiateAndCall(TRAP_MODULE, "e.trap()"));
+    }
+
+    @Test
+    public void testIndirectCallSignatureMismatchTraps() {
+        assertEquals("7", instantiateAndCall(INDIRECT_MODULE, "e.callRight(0)"));
+        assertEquals("RuntimeError", instantiateAndCall(INDIRECT_MODULE, "e.callRight(1)"));
+        assertEquals("RuntimeError", instantiateAndCall(INDIRECT_MODULE, "e.callWrongType(0)"));
+    }
+
+    @Test
+    public void testStackOverflow() {
+        // Runs on the JavaFX application thread, whose stack the JVM sized
+        assertEquals("RangeError", instantiateAndCall(RECURSE_MODULE, "e.recurse(0)"));
+        assertEquals("RuntimeError", instantiateAndCall(LOAD_MODULE, "e.load(65536)"));
+    }
+
+    @Test
+    public void testRepeatedTraps() {
+        assertEquals("1000", instantiateAndCall(LOAD_MODULE,
+                "(function() { var n = 0; for (var i = 0; i < 1000; i++) {" +
+                "  try { e.load(65536 + i); } catch (ex) { if (ex instanceof WebAssembly.RuntimeError) n++; }" +
+                "} return n; })()"));
+    }
+
+    @Test
+    public void testManyMemories() {
+        // More instances than fast memories may be reserved, so the later ones
+        // may be bounds checked explicitly and must trap the same way
+        assertEquals("64", executeScript(
+                "(function() {" +
+                "  var m = new WebAssembly.Module(new Uint8Array(" + LOAD_MODULE + "));" +
+                "  var keep = [], n = 0;" +
+                "  for (var i = 0; i < 64; i++) {" +
+                "    var e = new WebAssembly.Instance(m, {}).exports;" +
+                "    keep.push(e);" +
+                "    try { e.load(65536); } catch (ex) { if (e.load(0) === 0) n++; }" +
+                "  }" +
+                "  return String(n);" +
+                "})()"));
+    }
+
+    @Test
+    public void testJavaNullChecksAfterTrap() {
+        // Compiled Java code checks for null with a SIGSEGV, which the wasm
+        // fault handler must keep passing on to the JVM
+        assertEquals("RuntimeError", instantiateAndCall(LOAD_MODULE, "e.load(65536)"));
+        int caught = 0;
+        for (int i = 0; i < 100_000; i++) {
+            try {
+                hash((i & 1) == 0 ? null : "x");
+            } catch (NullPointerException ex) {
+                caught++;
+            }
+        }
+        assertEquals(50_000, caught);
+    }
+
+    private static int hash(Object o) {
+        return o.hashCode();
+    }
+}
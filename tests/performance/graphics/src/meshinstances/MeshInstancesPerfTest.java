@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package meshinstances;
+
+import java.util.concurrent.CountDownLatch;
+import javafx.animation.AnimationTimer;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.PerspectiveCamera;
+import javafx.scene.Scene;
+import javafx.scene.paint.Color;
+import javafx.scene.paint.PhongMaterial;
+import javafx.scene.shape.MeshView;
+import javafx.scene.shape.TriangleMesh;
+import javafx.scene.transform.Rotate;
+import javafx.stage.Stage;
+
+/**
+ * Measures the frame rate of a rotating grid of mesh views that all share
+ * one TriangleMesh and use a handful of materials differing only in their
+ * diffuse color, as in point clouds or molecule viewers.
+ * <p>
+ * Compare instanced and one draw per mesh view rendering:
+ * <pre>
+ * java -Djavafx.animation.fullspeed=true meshinstances.MeshInstancesPerfTest
+ * java -Djavafx.animation.fullspeed=true -Dprism.meshInstancing=false meshinstances.MeshInstancesPerfTest
+ * </pre>
+ *
+ * Usage: java meshinstances.MeshInstancesPerfTest [instances] [seconds]
+ */
+public class MeshInstancesPerfTest {
+
+    private static final int WARMUP_FRAMES = 60;
+    private static final float SIZE = 4;
+    private static final Color[] COLORS = {
+        Color.CRIMSON, Color.GOLD, Color.TEAL, Color.ORCHID
+    };
+
+    public static void main(String[] args) throws Exception {
+        int instances = args.length > 0 ? Integer.parseInt(args[0]) : 10000;
+        int seconds = args.length > 1 ? Integer.parseInt(args[1]) : 10;
+
+        CountDownLatch done = new CountDownLatch(1);
+        Platform.startup(() -> run(instances, seconds, done));
+        done.await();
+        Platform.exit();
+    }
+
+    // An octahedron
+    private static TriangleMesh createMesh() {
+        TriangleMesh mesh = new TriangleMesh();
+        mesh.getPoints().addAll(
+                0, -SIZE, 0,   SIZE, 0, 0,   0, 0, SIZE,
+                -SIZE, 0, 0,   0, 0, -SIZE,   0, SIZE, 0);
+        mesh.getTexCoords().addAll(0, 0);
+        mesh.getFaces().addAll(
+                0, 0, 2, 0, 1, 0,   0, 0, 3, 0, 2, 0,
+                0, 0, 4, 0, 3, 0,   0, 0, 1, 0, 4, 0,
+                5, 0, 1, 0, 2, 0,   5, 0, 2, 0, 3, 0,
+                5, 0, 3, 0, 4, 0,   5, 0, 4, 0, 1, 0);
+        return mesh;
+    }
+
+    private static void run(int instances, int seconds, CountDownLatch done) {
+        TriangleMesh mesh = createMesh();
+        PhongMaterial[] materials = new PhongMaterial[COLORS.length];
+        for (int i = 0; i < materials.length; i++) {
+            materials[i] = new PhongMaterial(COLORS[i]);
+        }
+
+        Group cloud = new Group();
+        int side = (int) Math.ceil(Math.cbrt(instances));
+        for (int i = 0; i < instances; i++) {
+            MeshView view = new MeshView(mesh);
+            // Neighbours share a material so that runs of views can be batched
+            view.setMaterial(materials[(i / side) % materials.length]);
+            view.setTranslateX((i % side - side / 2.0) * SIZE * 3);
+            view.setTranslateY((i / side % side - side / 2.0) * SIZE * 3);
+            view.setTranslateZ((i / (side * side) - side / 2.0) * SIZE * 3);
+            cloud.getChildren().add(view);
+        }
+        Rotate rotate = new Rotate(0, Rotate.Y_AXIS);
+        cloud.getTransforms().add(rotate);
+
+        PerspectiveCamera camera = new PerspectiveCamera(true);
+        camera.setFarClip(10000);
+        camera.setTranslateZ(-side * SIZE * 6);
+        Scene scene = new Scene(cloud, 1280, 720, true);
+        scene.setCamera(camera);
+        Stage stage = new Stage();
+        stage.setScene(scene);
+        stage.setTitle(instances + " mesh views");
+        stage.show();
+
+        new AnimationTimer() {
+            private int frames;
+            private long start;
+
+            @Override
+            public void handle(long now) {
+                rotate.setAngle(rotate.getAngle() + 0.5);
+                if (++frames == WARMUP_FRAMES) {
+                    start = now;
+                    frames = 0;
+                } else if (start != 0 && now - start >= seconds * 1_000_000_000L) {
+                    stop();
+                    System.out.printf("%d mesh views: %.1f fps%n", instances,
+                            frames * 1e9 / (now - start));
+                    stage.hide();
+                    done.countDown();
+                }
+            }
+        }.start();
+    }
+}
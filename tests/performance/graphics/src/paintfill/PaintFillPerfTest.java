@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package paintfill;
+
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.concurrent.CountDownLatch;
+import javafx.application.Platform;
+import javafx.scene.image.Image;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.paint.CycleMethod;
+import javafx.scene.paint.ImagePattern;
+import javafx.scene.paint.LinearGradient;
+import javafx.scene.paint.Paint;
+import javafx.scene.paint.RadialGradient;
+import javafx.scene.paint.Stop;
+import javafx.scene.shape.Rectangle;
+
+/**
+ * Measures how long the software pipeline takes to fill a 4K area with a
+ * linear gradient, a radial gradient and a bilinearly filtered image
+ * pattern by taking snapshots of a rectangle filled with each paint.
+ * <p>
+ * Compare the vectorized and the scalar paint generators:
+ * <pre>
+ * java -Dprism.order=sw paintfill.PaintFillPerfTest
+ * java -Dprism.order=sw -Dprism.sw.simd=false paintfill.PaintFillPerfTest
+ * </pre>
+ *
+ * Usage: java paintfill.PaintFillPerfTest [fills] [width] [height]
+ */
+public class PaintFillPerfTest {
+
+    private static final int WARMUP_FILLS = 5;
+
+    public static void main(String[] args) throws Exception {
+        int fills = args.length > 0 ? Integer.parseInt(args[0]) : 50;
+        int width = args.length > 1 ? Integer.parseInt(args[1]) : 3840;
+        int height = args.length > 2 ? Integer.parseInt(args[2]) : 2160;
+
+        CountDownLatch done = new CountDownLatch(1);
+        Platform.startup(() -> {
+            try {
+                run(fills, width, height);
+            } finally {
+                done.countDown();
+            }
+        });
+        done.await();
+        Platform.exit();
+    }
+
+    private static Image createTile(int size) {
+        WritableImage tile = new WritableImage(size, size);
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                tile.getPixelWriter().setArgb(x, y,
+                        0xff000000 | (x << 16) | (y << 8) | ((x ^ y) & 0xff));
+            }
+        }
+        return tile;
+    }
+
+    private static void run(int fills, int width, int height) {
+        Stop[] stops = {
+            new Stop(0, Color.CRIMSON), new Stop(0.5, Color.GOLD), new Stop(1, Color.TEAL)
+        };
+        Map<String, Paint> paints = new LinkedHashMap<>();
+        paints.put("linear", new LinearGradient(0, 0, width / 3.0, height / 5.0, false,
+                CycleMethod.REFLECT, stops));
+        paints.put("radial", new RadialGradient(30, 0.4, width / 2.0, height / 2.0,
+                height / 3.0, false, CycleMethod.REPEAT, stops));
+        // the fractional anchor makes every pixel interpolate between texels
+        paints.put("texture", new ImagePattern(createTile(256), 0.5, 0.25, 256, 256, false));
+
+        Rectangle rect = new Rectangle(width, height);
+        WritableImage target = new WritableImage(width, height);
+        for (Map.Entry<String, Paint> entry : paints.entrySet()) {
+            rect.setFill(entry.getValue());
+            for (int i = 0; i < WARMUP_FILLS; i++) {
+                rect.snapshot(null, target);
+            }
+            long start = System.nanoTime();
+            for (int i = 0; i < fills; i++) {
+                rect.snapshot(null, target);
+            }
+            double millis = (System.nanoTime() - start) / 1e6 / fills;
+            System.out.printf("%-8s %8.2f ms per %dx%d fill%n", entry.getKey(), millis, width, height);
+        }
+    }
+}
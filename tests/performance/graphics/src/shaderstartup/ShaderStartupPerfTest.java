@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package shaderstartup;
+
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.List;
+import java.util.stream.Stream;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Node;
+import javafx.scene.Scene;
+import javafx.scene.effect.BlendMode;
+import javafx.scene.effect.Bloom;
+import javafx.scene.effect.BoxBlur;
+import javafx.scene.effect.ColorAdjust;
+import javafx.scene.effect.DropShadow;
+import javafx.scene.effect.Effect;
+import javafx.scene.effect.GaussianBlur;
+import javafx.scene.effect.Glow;
+import javafx.scene.effect.InnerShadow;
+import javafx.scene.effect.Lighting;
+import javafx.scene.effect.MotionBlur;
+import javafx.scene.effect.Reflection;
+import javafx.scene.effect.SepiaTone;
+import javafx.scene.paint.Color;
+import javafx.scene.paint.CycleMethod;
+import javafx.scene.paint.LinearGradient;
+import javafx.scene.paint.Paint;
+import javafx.scene.paint.RadialGradient;
+import javafx.scene.paint.Stop;
+import javafx.scene.shape.Circle;
+import javafx.scene.shape.Rectangle;
+import javafx.scene.text.Font;
+import javafx.scene.text.Text;
+
+/**
+ * Measures the cost of creating the ES2 shader programs on startup. A fresh
+ * JVM is launched for every run and renders a snapshot of a scene that uses
+ * many paints, effects and blend modes, so that most of the Prism shaders
+ * are created. Each run reports the time from JVM start until the snapshot
+ * was taken, and the time the snapshot itself took.
+ * <p>
+ * Each round runs once with the program binary cache disabled
+ * (-Dprism.programBinaryCache=false), once with an empty cache and once with
+ * the cache filled by the previous run.
+ *
+ * Usage: java -Dprism.order=es2 shaderstartup.ShaderStartupPerfTest [rounds]
+ */
+public class ShaderStartupPerfTest {
+
+    private static final String CHILD = "--child";
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals(CHILD)) {
+            child();
+            return;
+        }
+        int rounds = args.length > 0 ? Integer.parseInt(args[0]) : 5;
+
+        Path cacheDir = Files.createTempDirectory("shaderstartup");
+        long[] total = new long[6];
+        for (int r = 0; r < rounds; r++) {
+            long[] source = runChild(cacheDir, false);
+            clear(cacheDir);
+            long[] cold = runChild(cacheDir, true);
+            long[] warm = runChild(cacheDir, true);
+            System.out.printf("round %d: source %d/%d ms, empty cache %d/%d ms, cache %d/%d ms%n",
+                              r, source[0], source[1], cold[0], cold[1], warm[0], warm[1]);
+            total[0] += source[0];
+            total[1] += source[1];
+            total[2] += cold[0];
+            total[3] += cold[1];
+            total[4] += warm[0];
+            total[5] += warm[1];
+        }
+        System.out.printf("average: source %d/%d ms, empty cache %d/%d ms, cache %d/%d ms%n",
+                          total[0] / rounds, total[1] / rounds, total[2] / rounds,
+                          total[3] / rounds, total[4] / rounds, total[5] / rounds);
+        System.out.println("(startup/snapshot)");
+        clear(cacheDir);
+    }
+
+    private static void clear(Path dir) throws IOException {
+        try (Stream<Path> files = Files.walk(dir)) {
+            for (Path p : files.sorted(Comparator.reverseOrder()).toList()) {
+                if (!p.equals(dir)) {
+                    Files.delete(p);
+                }
+            }
+        }
+    }
+
+    private static long[] runChild(Path cacheDir, boolean cache)
+            throws IOException, InterruptedException {
+        List<String> cmd = new ArrayList<>();
+        cmd.add(Path.of(System.getProperty("java.home"), "bin", "java").toString());
+        cmd.add("-cp");
+        cmd.add(System.getProperty("java.class.path"));
+        String modulePath = System.getProperty("jdk.module.path");
+        if (modulePath != null) {
+            cmd.add("--module-path");
+            cmd.add(modulePath);
+            cmd.add("--add-modules");
+            cmd.add("javafx.graphics");
+        }
+        cmd.add("-Dprism.order=" + System.getProperty("prism.order", "es2"));
+        cmd.add("-Djavafx.cachedir=" + cacheDir);
+        cmd.add("-Dprism.programBinaryCache=" + cache);
+        cmd.add(ShaderStartupPerfTest.class.getName());
+        cmd.add(CHILD);
+        ProcessBuilder pb = new ProcessBuilder(cmd);
+        pb.redirectError(ProcessBuilder.Redirect.INHERIT);
+        Process p = pb.start();
+        long[] millis = { -1, -1 };
+        try (BufferedReader in = new BufferedReader(new InputStreamReader(p.getInputStream()))) {
+            String line;
+            while ((line = in.readLine()) != null) {
+                String[] fields = line.trim().split(" ");
+                millis[0] = Long.parseLong(fields[0]);
+                millis[1] = Long.parseLong(fields[1]);
+            }
+        }
+        p.waitFor();
+        return millis;
+    }
+
+    private static void child() {
+        Platform.startup(() -> {
+            long snapshotStart = System.nanoTime();
+            Scene scene = new Scene(createContent(), 800, 600);
+            scene.snapshot(null);
+            long snapshotMillis = (System.nanoTime() - snapshotStart) / 1_000_000;
+            long start = ProcessHandle.current().info().startInstant()
+                    .map(i -> i.toEpochMilli()).orElse(0L);
+            System.out.println((System.currentTimeMillis() - start) + " " + snapshotMillis);
+            Platform.exit();
+        });
+    }
+
+    private static Group createContent() {
+        Stop[] stops = { new Stop(0, Color.RED), new Stop(0.5, Color.GREEN), new Stop(1, Color.BLUE) };
+        Paint[] paints = {
+            Color.CORAL,
+            new LinearGradient(0, 0, 1, 0, true, CycleMethod.NO_CYCLE, stops),
+            new LinearGradient(0, 0, 0.2, 0, true, CycleMethod.REFLECT, stops),
+            new LinearGradient(0, 0, 0.2, 0.2, true, CycleMethod.REPEAT, stops),
+            new RadialGradient(0, 0, 0.5, 0.5, 0.5, true, CycleMethod.NO_CYCLE, stops),
+            new RadialGradient(45, 0.3, 0.5, 0.5, 0.2, true, CycleMethod.REFLECT, stops),
+            new RadialGradient(0, 0, 0.5, 0.5, 0.2, true, CycleMethod.REPEAT, stops),
+        };
+        Effect[] effects = {
+            null,
+            new DropShadow(),
+            new InnerShadow(),
+            new GaussianBlur(),
+            new BoxBlur(),
+            new MotionBlur(),
+            new Bloom(),
+            new Glow(),
+            new ColorAdjust(0.2, 0.3, 0.1, 0.4),
+            new SepiaTone(),
+            new Reflection(),
+            new Lighting(),
+        };
+        BlendMode[] blendModes = BlendMode.values();
+
+        Group root = new Group();
+        int n = 0;
+        for (Paint paint : paints) {
+            for (Effect effect : effects) {
+                Node shape = (n & 1) == 0 ? new Rectangle(30, 30, paint) : new Circle(15, paint);
+                shape.setEffect(effect);
+                shape.setBlendMode(blendModes[n % blendModes.length]);
+                shape.setLayoutX(10 + (n % 20) * 38);
+                shape.setLayoutY(10 + (n / 20) * 38);
+                shape.setRotate(n * 7);
+                root.getChildren().add(shape);
+                n++;
+            }
+        }
+        Text text = new Text(10, 500, "The quick brown fox jumps over the lazy dog");
+        text.setFont(Font.font(24));
+        text.setFill(paints[1]);
+        root.getChildren().add(text);
+        return root;
+    }
+}
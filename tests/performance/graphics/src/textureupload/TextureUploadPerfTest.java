@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package textureupload;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.IntBuffer;
+import java.util.Arrays;
+import javafx.animation.AnimationTimer;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.image.ImageView;
+import javafx.scene.image.PixelBuffer;
+import javafx.scene.image.PixelFormat;
+import javafx.scene.image.WritableImage;
+import javafx.stage.Stage;
+
+/**
+ * Measures frame times while a 4K image backed by a PixelBuffer, as used by
+ * media players and other producers of video frames, is modified and
+ * uploaded to its texture on every frame. Frame times are taken from the
+ * pulse timestamps once a warm up period has passed.
+ * <p>
+ * Compare the ES2 pipeline with and without pixel buffer object uploads:
+ * <pre>
+ * java -Dprism.order=es2 textureupload.TextureUploadPerfTest
+ * java -Dprism.order=es2 -Dprism.pboUpload=false textureupload.TextureUploadPerfTest
+ * </pre>
+ *
+ * Usage: java textureupload.TextureUploadPerfTest [seconds] [width] [height]
+ */
+public class TextureUploadPerfTest extends Application {
+
+    private static final long WARMUP_NANOS = 2_000_000_000L;
+
+    private static int seconds = 10;
+    private static int width = 3840;
+    private static int height = 2160;
+
+    public static void main(String[] args) {
+        if (args.length > 0) seconds = Integer.parseInt(args[0]);
+        if (args.length > 1) width = Integer.parseInt(args[1]);
+        if (args.length > 2) height = Integer.parseInt(args[2]);
+        launch(args);
+    }
+
+    @Override
+    public void start(Stage stage) {
+        IntBuffer pixels = ByteBuffer.allocateDirect(width * height * 4)
+                .order(ByteOrder.nativeOrder()).asIntBuffer();
+        for (int i = 0; i < width * height; i++) {
+            pixels.put(i, 0xff000000 | (i * 0x9e3779b1) >>> 8);
+        }
+        PixelBuffer<IntBuffer> pixelBuffer = new PixelBuffer<>(width, height, pixels,
+                PixelFormat.getIntArgbPreInstance());
+        ImageView view = new ImageView(new WritableImage(pixelBuffer));
+        view.setFitWidth(1280);
+        view.setFitHeight(720);
+
+        stage.setScene(new Scene(new Group(view), 1280, 720));
+        stage.setTitle("Texture upload " + width + "x" + height);
+        stage.show();
+
+        long[] frameTimes = new long[seconds * 1000];
+        new AnimationTimer() {
+            long start = -1;
+            long last;
+            int frame;
+            int count;
+
+            @Override
+            public void handle(long now) {
+                if (start < 0) {
+                    start = now;
+                }
+                // Move a bar across the image so every frame has new content
+                int bar = (frame++ * 16) % width;
+                int barEnd = Math.min(bar + 16, width);
+                // A null dirty region uploads the whole image
+                pixelBuffer.updateBuffer(_ -> {
+                    for (int y = 0; y < height; y++) {
+                        int row = y * width;
+                        for (int x = bar; x < barEnd; x++) {
+                            pixels.put(row + x, ~pixels.get(row + x) | 0xff000000);
+                        }
+                    }
+                    return null;
+                });
+                if (now - start > WARMUP_NANOS && count < frameTimes.length) {
+                    frameTimes[count++] = now - last;
+                }
+                last = now;
+                if (now - start > WARMUP_NANOS + seconds * 1_000_000_000L) {
+                    stop();
+                    report(Arrays.copyOf(frameTimes, count));
+                    Platform.exit();
+                }
+            }
+        }.start();
+    }
+
+    private static void report(long[] frameTimes) {
+        if (frameTimes.length == 0) {
+            System.out.println("No frames");
+            return;
+        }
+        Arrays.sort(frameTimes);
+        long total = 0;
+        for (long t : frameTimes) {
+            total += t;
+        }
+        System.out.printf("%dx%d, %d frames, %.1f fps%n", width, height,
+                frameTimes.length, frameTimes.length * 1e9 / total);
+        System.out.printf("frame time ms: avg %.2f, p50 %.2f, p95 %.2f, p99 %.2f, max %.2f%n",
+                total / 1e6 / frameTimes.length,
+                percentile(frameTimes, 50), percentile(frameTimes, 95),
+                percentile(frameTimes, 99), frameTimes[frameTimes.length - 1] / 1e6);
+    }
+
+    private static double percentile(long[] sorted, int p) {
+        int index = Math.min(sorted.length - 1, sorted.length * p / 100);
+        return sorted[index] / 1e6;
+    }
+}
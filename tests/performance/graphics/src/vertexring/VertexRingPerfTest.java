@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package vertexring;
+
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.lang.management.ManagementFactory;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Random;
+import java.util.concurrent.CountDownLatch;
+import javafx.animation.AnimationTimer;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.paint.Color;
+import javafx.scene.shape.Rectangle;
+import javafx.stage.Stage;
+
+/**
+ * Measures the frame rate of the ES2 pipeline on Mesa's llvmpipe software
+ * rasterizer while thousands of small rectangles move every frame, so that
+ * each frame streams many full quad batches. The test runs itself once
+ * with client side vertex arrays and once with the streaming vertex buffer,
+ * each in a child process with LIBGL_ALWAYS_SOFTWARE=1, and prints both
+ * frame rates.
+ * <p>
+ * <pre>
+ * java vertexring.VertexRingPerfTest [rectangles] [seconds]
+ * </pre>
+ * Any JVM options, such as the module path, are passed to the children.
+ */
+public class VertexRingPerfTest {
+
+    private static final String CHILD = "--child";
+    private static final String RESULT = "RESULT ";
+    private static final int WARMUP_FRAMES = 60;
+    private static final double SIZE = 1000;
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals(CHILD)) {
+            int rects = Integer.parseInt(args[1]);
+            int seconds = Integer.parseInt(args[2]);
+            CountDownLatch done = new CountDownLatch(1);
+            Platform.startup(() -> run(rects, seconds, done));
+            done.await();
+            Platform.exit();
+            return;
+        }
+
+        String rects = args.length > 0 ? args[0] : "20000";
+        String seconds = args.length > 1 ? args[1] : "10";
+        double arrays = runChild("0", rects, seconds);
+        double ring = runChild(null, rects, seconds);
+        System.out.printf("%s rectangles on llvmpipe%n", rects);
+        System.out.printf("client arrays:          %.1f fps%n", arrays);
+        System.out.printf("streaming vertex ring:  %.1f fps (%+.1f%%)%n",
+                ring, (ring / arrays - 1) * 100);
+    }
+
+    // Runs the test in a new JVM on llvmpipe, the default ring size is used if null
+    private static double runChild(String ringSize, String rects, String seconds)
+            throws IOException, InterruptedException {
+        List<String> command = new ArrayList<>();
+        command.add(ProcessHandle.current().info().command().orElse("java"));
+        for (String arg : ManagementFactory.getRuntimeMXBean().getInputArguments()) {
+            if (!arg.startsWith("-Dprism.")) {
+                command.add(arg);
+            }
+        }
+        command.add("-cp");
+        command.add(System.getProperty("java.class.path"));
+        command.add("-Dprism.order=es2");
+        // llvmpipe does not pass the GPU qualification
+        command.add("-Dprism.forceGPU=true");
+        command.add("-Dprism.vsync=false");
+        command.add("-Djavafx.animation.fullspeed=true");
+        if (ringSize != null) {
+            command.add("-Dprism.vertexRingSize=" + ringSize);
+        }
+        command.add(VertexRingPerfTest.class.getName());
+        command.add(CHILD);
+        command.add(rects);
+        command.add(seconds);
+
+        ProcessBuilder builder = new ProcessBuilder(command).redirectErrorStream(true);
+        builder.environment().put("LIBGL_ALWAYS_SOFTWARE", "1");
+        builder.environment().put("GALLIUM_DRIVER", "llvmpipe");
+        Process process = builder.start();
+        double fps = Double.NaN;
+        try (BufferedReader in = new BufferedReader(
+                new InputStreamReader(process.getInputStream()))) {
+            String line;
+            while ((line = in.readLine()) != null) {
+                if (line.startsWith(RESULT)) {
+                    fps = Double.parseDouble(line.substring(RESULT.length()));
+                } else {
+                    System.out.println(line);
+                }
+            }
+        }
+        if (process.waitFor() != 0 || Double.isNaN(fps)) {
+            throw new IllegalStateException("Test failed: " + String.join(" ", command));
+        }
+        return fps;
+    }
+
+    private static void run(int count, int seconds, CountDownLatch done) {
+        Random random = new Random(42);
+        Rectangle[] rects = new Rectangle[count];
+        double[] speeds = new double[count];
+        Group root = new Group();
+        for (int i = 0; i < count; i++) {
+            rects[i] = new Rectangle(random.nextDouble() * SIZE,
+                    random.nextDouble() * SIZE, 8, 8);
+            rects[i].setFill(Color.hsb(random.nextDouble() * 360, 0.8, 0.9));
+            speeds[i] = 1 + random.nextDouble() * 4;
+            root.getChildren().add(rects[i]);
+        }
+
+        Stage stage = new Stage();
+        stage.setScene(new Scene(root, SIZE, SIZE));
+        stage.setTitle("Vertex ring");
+        stage.show();
+
+        new AnimationTimer() {
+            long start;
+            int frames;
+
+            @Override
+            public void handle(long now) {
+                for (int i = 0; i < count; i++) {
+                    rects[i].setX((rects[i].getX() + speeds[i]) % SIZE);
+                }
+                if (++frames == WARMUP_FRAMES) {
+                    start = now;
+                } else if (frames > WARMUP_FRAMES && now - start > seconds * 1_000_000_000L) {
+                    stop();
+                    System.out.println(RESULT
+                            + (frames - WARMUP_FRAMES) * 1e9 / (now - start));
+                    stage.close();
+                    done.countDown();
+                }
+            }
+        }.start();
+    }
+}
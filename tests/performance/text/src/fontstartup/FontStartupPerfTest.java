@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package fontstartup;
+
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.stream.Stream;
+import javafx.application.Platform;
+import javafx.scene.text.Font;
+import javafx.scene.text.Text;
+
+/**
+ * Measures time-to-first-text-layout on Linux with a large font directory.
+ * A private fontconfig configuration adds a directory holding many copies
+ * of an installed font to the system configuration, then a fresh JVM is
+ * launched for every run and reports how long it took from JVM start until
+ * a Text node using a font looked up by family name was laid out.
+ * <p>
+ * Each round runs once without the fontconfig index (-Dprism.fontConfigIndex=false)
+ * and once with an index written by a previous run.
+ *
+ * Usage: java fontstartup.FontStartupPerfTest [fontCopies] [rounds]
+ */
+public class FontStartupPerfTest {
+
+    private static final String CHILD = "--child";
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals(CHILD)) {
+            child();
+            return;
+        }
+        int copies = args.length > 0 ? Integer.parseInt(args[0]) : 2000;
+        int rounds = args.length > 1 ? Integer.parseInt(args[1]) : 5;
+
+        Path work = Files.createTempDirectory("fontstartup");
+        Path fontDir = Files.createDirectory(work.resolve("fonts"));
+        Path font = findFont();
+        if (font == null) {
+            System.err.println("No TrueType font found in /usr/share/fonts");
+            return;
+        }
+        String ext = font.getFileName().toString();
+        ext = ext.substring(ext.lastIndexOf('.'));
+        for (int i = 0; i < copies; i++) {
+            Files.copy(font, fontDir.resolve("font" + i + ext), StandardCopyOption.COPY_ATTRIBUTES);
+        }
+        Path conf = work.resolve("fonts.conf");
+        Files.writeString(conf,
+            "<?xml version=\"1.0\"?>\n" +
+            "<!DOCTYPE fontconfig SYSTEM \"fonts.dtd\">\n" +
+            "<fontconfig>\n" +
+            "  <include ignore_missing=\"yes\">/etc/fonts/fonts.conf</include>\n" +
+            "  <dir>" + fontDir + "</dir>\n" +
+            "  <cachedir>" + work.resolve("fccache") + "</cachedir>\n" +
+            "</fontconfig>\n");
+        Path cacheDir = work.resolve("jfxcache");
+
+        System.out.println("Font directory: " + copies + " copies of " + font);
+        // Let fontconfig build its caches for the new directory first
+        runChild(conf, cacheDir, false);
+
+        long totalScan = 0, totalIndexed = 0;
+        for (int r = 0; r < rounds; r++) {
+            long scan = runChild(conf, cacheDir, false);
+            runChild(conf, cacheDir, true); // make sure the index is current
+            long indexed = runChild(conf, cacheDir, true);
+            System.out.printf("round %d: fontconfig %d ms, index %d ms%n", r, scan, indexed);
+            totalScan += scan;
+            totalIndexed += indexed;
+        }
+        System.out.printf("average: fontconfig %d ms, index %d ms%n",
+                          totalScan / rounds, totalIndexed / rounds);
+    }
+
+    private static Path findFont() throws IOException {
+        Path root = Path.of("/usr/share/fonts");
+        if (!Files.isDirectory(root)) {
+            return null;
+        }
+        try (Stream<Path> files = Files.walk(root)) {
+            return files.filter(p -> p.toString().endsWith(".ttf"))
+                        .findFirst().orElse(null);
+        }
+    }
+
+    private static long runChild(Path conf, Path cacheDir, boolean index)
+            throws IOException, InterruptedException {
+        List<String> cmd = new ArrayList<>();
+        cmd.add(Path.of(System.getProperty("java.home"), "bin", "java").toString());
+        cmd.add("-cp");
+        cmd.add(System.getProperty("java.class.path"));
+        String modulePath = System.getProperty("jdk.module.path");
+        if (modulePath != null) {
+            cmd.add("--module-path");
+            cmd.add(modulePath);
+            cmd.add("--add-modules");
+            cmd.add("javafx.graphics");
+        }
+        cmd.add("-Djavafx.cachedir=" + cacheDir);
+        cmd.add("-Dprism.fontConfigIndex=" + index);
+        cmd.add(FontStartupPerfTest.class.getName());
+        cmd.add(CHILD);
+        ProcessBuilder pb = new ProcessBuilder(cmd);
+        pb.environment().put("FONTCONFIG_FILE", conf.toString());
+        pb.redirectError(ProcessBuilder.Redirect.INHERIT);
+        Process p = pb.start();
+        long millis = -1;
+        try (BufferedReader in = new BufferedReader(new InputStreamReader(p.getInputStream()))) {
+            String line;
+            while ((line = in.readLine()) != null) {
+                millis = Long.parseLong(line.trim());
+            }
+        }
+        p.waitFor();
+        return millis;
+    }
+
+    private static void child() {
+        Platform.startup(() -> {
+            // A family name that is not a logical font needs the full name map
+            String family = Font.getFamilies().stream()
+                    .filter(f -> !f.equals("System"))
+                    .findFirst().orElse("System");
+            Text text = new Text("The quick brown fox jumps over the lazy dog");
+            text.setFont(Font.font(family, 14));
+            text.getLayoutBounds();
+            long start = ProcessHandle.current().info().startInstant()
+                    .map(i -> i.toEpochMilli()).orElse(0L);
+            System.out.println(System.currentTimeMillis() - start);
+            Platform.exit();
+        });
+    }
+}
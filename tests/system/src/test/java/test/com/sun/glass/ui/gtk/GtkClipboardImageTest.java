@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.glass.ui.gtk;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import java.awt.Toolkit;
+import java.awt.datatransfer.DataFlavor;
+import java.awt.datatransfer.Transferable;
+import java.awt.datatransfer.UnsupportedFlavorException;
+import java.awt.image.BufferedImage;
+import java.util.concurrent.CountDownLatch;
+import javafx.scene.image.Image;
+import javafx.scene.image.PixelReader;
+import javafx.scene.image.PixelWriter;
+import javafx.scene.image.WritableImage;
+import javafx.scene.input.Clipboard;
+import javafx.scene.input.ClipboardContent;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.CsvSource;
+import com.sun.javafx.PlatformUtil;
+import test.util.Util;
+
+/**
+ * Checks the red and blue swap of images exported to and imported from the
+ * GTK clipboard, through AWT on the other side. The sizes cover the vector
+ * blocks and the scalar tail of swap_red_blue, which must agree on every
+ * pixel.
+ */
+public class GtkClipboardImageTest {
+    static CountDownLatch startupLatch = new CountDownLatch(1);
+    static Clipboard clipboard;
+
+    @BeforeAll
+    public static void initFX() {
+        Util.startup(startupLatch, () -> {
+            clipboard = Clipboard.getSystemClipboard();
+            startupLatch.countDown();
+        });
+    }
+
+    @AfterAll
+    public static void teardown() {
+        Util.shutdown();
+    }
+
+    // Opaque, so that premultiplication does not change the pixels
+    private static int argb(int x, int y) {
+        int r = (x * 37 + y * 11) & 0xff;
+        int g = (x * 13 + y * 71 + 91) & 0xff;
+        int b = (x * 7 + y * 53 + 29) & 0xff;
+        return 0xff000000 | (r << 16) | (g << 8) | b;
+    }
+
+    @ParameterizedTest
+    @CsvSource({ "1, 1", "3, 5", "17, 3", "33, 7" })
+    public void testExportedImage(int w, int h) throws Exception {
+        assumeTrue(PlatformUtil.isLinux());
+
+        WritableImage image = new WritableImage(w, h);
+        PixelWriter writer = image.getPixelWriter();
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                writer.setArgb(x, y, argb(x, y));
+            }
+        }
+        ClipboardContent content = new ClipboardContent();
+        content.putImage(image);
+        Util.runAndWait(() -> clipboard.setContent(content));
+        Thread.sleep(1000);
+
+        Object data = Toolkit.getDefaultToolkit()
+                .getSystemClipboard().getData(DataFlavor.imageFlavor);
+        assertTrue(data instanceof BufferedImage);
+        BufferedImage exported = (BufferedImage) data;
+        assertEquals(w, exported.getWidth());
+        assertEquals(h, exported.getHeight());
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                assertEquals(argb(x, y), exported.getRGB(x, y), "pixel " + x + ", " + y);
+            }
+        }
+    }
+
+    @ParameterizedTest
+    @CsvSource({ "1, 1", "3, 5", "17, 3", "33, 7" })
+    public void testImportedImage(int w, int h) throws Exception {
+        assumeTrue(PlatformUtil.isLinux());
+
+        BufferedImage image = new BufferedImage(w, h, BufferedImage.TYPE_INT_ARGB);
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                image.setRGB(x, y, argb(x, y));
+            }
+        }
+        Toolkit.getDefaultToolkit().getSystemClipboard().setContents(new Transferable() {
+            @Override
+            public DataFlavor[] getTransferDataFlavors() {
+                return new DataFlavor[] { DataFlavor.imageFlavor };
+            }
+
+            @Override
+            public boolean isDataFlavorSupported(DataFlavor flavor) {
+                return DataFlavor.imageFlavor.equals(flavor);
+            }
+
+            @Override
+            public Object getTransferData(DataFlavor flavor) throws UnsupportedFlavorException {
+                if (!isDataFlavorSupported(flavor)) {
+                    throw new UnsupportedFlavorException(flavor);
+                }
+                return image;
+            }
+        }, null);
+        Thread.sleep(1000);
+
+        Util.runAndWait(() -> {
+            Image imported = clipboard.getImage();
+            assertNotNull(imported);
+            assertEquals(w, (int) imported.getWidth());
+            assertEquals(h, (int) imported.getHeight());
+            PixelReader reader = imported.getPixelReader();
+            for (int y = 0; y < h; y++) {
+                for (int x = 0; x < w; x++) {
+                    assertEquals(argb(x, y), reader.getArgb(x, y), "pixel " + x + ", " + y);
+                }
+            }
+        });
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.glass.ui.gtk;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.glass.ui.Screen;
+import com.sun.glass.ui.Timer;
+import com.sun.javafx.PlatformUtil;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import test.util.Util;
+
+public class GtkMillisTimerTest extends GtkTimerCommon {
+
+    private static final int PERIOD = 16;
+
+    @BeforeAll
+    public static void setup() throws Exception {
+        doSetup(false);
+    }
+
+    @AfterAll
+    public static void teardown() {
+        doTeardown();
+    }
+
+    @Test
+    public void testTicksAtRequestedPeriod() throws Exception {
+        assumeTrue(PlatformUtil.isLinux());
+
+        Ticks ticks = new Ticks();
+        Timer timer = createTimer(ticks);
+        Util.runAndWait(() -> {
+            assertEquals(0.0, Screen.getVideoRefreshPeriod());
+            assertThrows(RuntimeException.class, timer::start);
+            timer.start(PERIOD);
+        });
+        double actual = ticks.await(timer);
+
+        assertTrue(ticks.fxThread, "ticked on " + ticks.thread.getName());
+        // The GLib timeout runs on the event thread, relative to each dispatch
+        assertPeriod(PERIOD, actual, 0.5);
+    }
+}
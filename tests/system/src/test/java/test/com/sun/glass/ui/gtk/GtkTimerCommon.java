@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.glass.ui.gtk;
+
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assertions.fail;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import javafx.application.Platform;
+import com.sun.glass.ui.Application;
+import com.sun.glass.ui.Timer;
+import com.sun.javafx.PlatformUtil;
+import test.util.Util;
+
+public class GtkTimerCommon {
+
+    private static final CountDownLatch startupLatch = new CountDownLatch(1);
+
+    protected static final int TICKS = 61;
+
+    public static void doSetup(boolean vsyncTimer) throws Exception {
+        if (!PlatformUtil.isLinux()) return;
+
+        System.setProperty("glass.gtk.vsyncTimer", Boolean.toString(vsyncTimer));
+
+        Platform.startup(() -> {
+            startupLatch.countDown();
+        });
+
+        if (!startupLatch.await(15, TimeUnit.SECONDS)) {
+            fail("Timeout waiting for FX runtime to start");
+        }
+    }
+
+    public static void doTeardown() {
+        if (!PlatformUtil.isLinux()) return;
+
+        Platform.exit();
+    }
+
+    /**
+     * Ticks of a timer, with the thread the first one ran on.
+     */
+    protected static class Ticks implements Runnable {
+        private final long[] times = new long[TICKS];
+        private final AtomicInteger count = new AtomicInteger();
+        private final CountDownLatch done = new CountDownLatch(1);
+        volatile Thread thread;
+        volatile boolean fxThread;
+
+        @Override
+        public void run() {
+            int i = count.getAndIncrement();
+            if (i < TICKS) {
+                if (i == 0) {
+                    thread = Thread.currentThread();
+                    fxThread = Platform.isFxApplicationThread();
+                }
+                times[i] = System.nanoTime();
+                if (i == TICKS - 1) {
+                    done.countDown();
+                }
+            }
+        }
+
+        /**
+         * Waits for the ticks and returns their average period in milliseconds.
+         */
+        double await(Timer timer) throws InterruptedException {
+            boolean ticked = done.await(15, TimeUnit.SECONDS);
+            Util.runAndWait(timer::stop);
+            assertTrue(ticked, "timer stopped ticking after " + count.get() + " ticks");
+            return (times[TICKS - 1] - times[0]) / 1e6 / (TICKS - 1);
+        }
+    }
+
+    protected static Timer createTimer(Runnable runnable) {
+        return Application.GetApplication().createTimer(runnable);
+    }
+
+    protected static void assertPeriod(double expected, double actual, double tolerance) {
+        assertTrue(actual >= expected * (1 - tolerance) && actual <= expected * (1 + tolerance),
+                "period " + actual + " ms, expected " + expected + " ms");
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.glass.ui.gtk;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.glass.ui.Screen;
+import com.sun.glass.ui.Timer;
+import com.sun.javafx.PlatformUtil;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import test.util.Util;
+
+public class GtkVsyncTimerTest extends GtkTimerCommon {
+
+    @BeforeAll
+    public static void setup() throws Exception {
+        doSetup(true);
+    }
+
+    @AfterAll
+    public static void teardown() {
+        doTeardown();
+    }
+
+    @Test
+    public void testTicksAtRefreshPeriod() throws Exception {
+        assumeTrue(PlatformUtil.isLinux());
+
+        double[] period = new double[1];
+        Util.runAndWait(() -> period[0] = Screen.getVideoRefreshPeriod());
+        assumeTrue(period[0] > 0.0, "the display reports no refresh rate");
+
+        Ticks ticks = new Ticks();
+        Timer timer = createTimer(ticks);
+        Util.runAndWait(timer::start);
+        double actual = ticks.await(timer);
+
+        assertEquals("GtkVsyncTimer", ticks.thread.getName());
+        assertFalse(ticks.fxThread);
+        // The deadlines are absolute, so a late tick does not delay the
+        // later ones; ticks are only lost when a whole period is missed
+        assertPeriod(period[0], actual, 0.25);
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,9 +26,14 @@
 package test.com.sun.glass.ui.monocle;
 
 import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.IntBuffer;
 import org.junit.jupiter.api.Test;
 import com.sun.glass.ui.monocle.FramebufferShim;
 
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
 public class FramebufferTest {
 
     @Test
@@ -67,4 +72,131 @@ public class FramebufferTest {
         windowBuffer.clear();
     }
 
+    @Test
+    public void testDamage() {
+        ByteBuffer screenBuffer = ByteBuffer.allocate(100 * 100 * 4);
+        screenBuffer.order(ByteOrder.nativeOrder());
+        FramebufferShim fb = new FramebufferShim(screenBuffer, 100, 100, 4, true);
+        IntBuffer window = IntBuffer.allocate(100 * 100);
+        for (int i = 0; i < window.capacity(); i++) {
+            window.put(i, 0xff000000 | i);
+        }
+        int[] starts = new int[100];
+        int[] ends = new int[100];
+        fb.composePixels(window, 0, 0, 100, 100, 1f);
+        fb.clearDamage(starts, ends);
+        fb.addDamageTo(starts, ends);
+        for (int y = 0; y < 100; y++) {
+            assertEquals(0, starts[y]);
+            assertEquals(100, ends[y]);
+        }
+
+        // Only the changed pixels of an identical full screen upload count
+        fb.reset();
+        window.put(20 * 100 + 30, 0xffffffff);
+        window.put(20 * 100 + 90, 0xffffffff);
+        window.put(70 * 100 + 5, 0xffffffff);
+        fb.composePixels(window, 0, 0, 100, 100, 1f);
+        fb.clearDamage(starts, ends);
+        fb.addDamageTo(starts, ends);
+        for (int y = 0; y < 100; y++) {
+            if (y == 20) {
+                assertEquals(30, starts[y]);
+                assertEquals(91, ends[y]);
+            } else if (y == 70) {
+                assertEquals(5, starts[y]);
+                assertEquals(6, ends[y]);
+            } else {
+                assertTrue(starts[y] >= ends[y], "row " + y);
+            }
+        }
+        IntBuffer screen = screenBuffer.asIntBuffer();
+        for (int i = 0; i < window.capacity(); i++) {
+            assertEquals(window.get(i), screen.get(i));
+        }
+
+        // Blended pixels count where they change
+        fb.reset();
+        fb.composePixels(window, 0, 0, 100, 100, 1f);
+        fb.composePixels(IntBuffer.allocate(10 * 10), 40, 50, 10, 10, 0.5f);
+        fb.clearDamage(starts, ends);
+        fb.addDamageTo(starts, ends);
+        assertEquals(40, starts[55]);
+        assertEquals(50, ends[55]);
+        assertTrue(starts[20] >= ends[20]);
+    }
+
+    private static IntBuffer createWindow(int w, int h, int color) {
+        IntBuffer window = IntBuffer.allocate(w * h);
+        for (int i = 0; i < window.capacity(); i++) {
+            window.put(i, color);
+        }
+        return window;
+    }
+
+    private static void composeWindows(FramebufferShim fb, IntBuffer... windows) {
+        fb.composePixels(windows[0], 0, 0, 20, 20, 1f);
+        if (windows.length > 1) {
+            fb.composePixels(windows[1], 60, 10, 20, 20, 1f);
+            fb.composePixels(windows[2], 30, 70, 10, 10, 0.5f);
+        }
+    }
+
+    @Test
+    public void testClearDamage() {
+        ByteBuffer screenBuffer = ByteBuffer.allocate(100 * 100 * 4);
+        screenBuffer.order(ByteOrder.nativeOrder());
+        FramebufferShim fb = new FramebufferShim(screenBuffer, 100, 100, 4, true);
+        IntBuffer screen = screenBuffer.asIntBuffer();
+        IntBuffer a = createWindow(20, 20, 0xff102030);
+        IntBuffer b = createWindow(20, 20, 0xff405060);
+        IntBuffer c = createWindow(10, 10, 0xff708090);
+        int[] starts = new int[100];
+        int[] ends = new int[100];
+
+        // The second window shares rows with the first, the third is blended
+        composeWindows(fb, a, b, c);
+        fb.clearDamage(starts, ends);
+        fb.addDamageTo(starts, ends);
+        assertEquals(0, starts[5]);
+        assertEquals(20, ends[5]);
+        assertEquals(0, starts[15]);
+        assertEquals(80, ends[15]);
+        assertEquals(30, starts[75]);
+        assertEquals(40, ends[75]);
+        assertTrue(starts[50] >= ends[50]);
+        assertTrue(screen.get(75 * 100 + 35) != 0);
+        int[] frame = new int[100 * 100];
+        screen.get(0, frame);
+
+        // The clear of a repeated frame changes no pixel
+        fb.reset();
+        composeWindows(fb, a, b, c);
+        fb.clearDamage(starts, ends);
+        fb.addDamageTo(starts, ends);
+        for (int y = 0; y < 100; y++) {
+            assertTrue(starts[y] >= ends[y], "row " + y);
+        }
+        for (int i = 0; i < frame.length; i++) {
+            assertEquals(frame[i], screen.get(i));
+        }
+
+        // Only the pixels of the windows that are gone are cleared
+        fb.reset();
+        composeWindows(fb, a);
+        fb.clearDamage(starts, ends);
+        fb.addDamageTo(starts, ends);
+        assertTrue(starts[5] >= ends[5]);
+        assertEquals(60, starts[15]);
+        assertEquals(80, ends[15]);
+        assertEquals(30, starts[75]);
+        assertEquals(40, ends[75]);
+        for (int y = 0; y < 100; y++) {
+            for (int x = 0; x < 100; x++) {
+                int expected = x < 20 && y < 20 ? 0xff102030 : 0;
+                assertEquals(expected, screen.get(y * 100 + x), x + ", " + y);
+            }
+        }
+    }
+
 }
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.glass.ui.monocle;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import com.sun.glass.ui.monocle.FramebufferShim;
+import com.sun.glass.ui.monocle.LinuxFrameBufferShim;
+import com.sun.glass.ui.monocle.LinuxSystemShim;
+import com.sun.javafx.PlatformUtil;
+import java.io.ByteArrayOutputStream;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.Channels;
+import java.nio.channels.FileChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.Arrays;
+import java.util.Random;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+
+/**
+ * Checks the page offsets of LinuxFrameBuffer and copies rows into a
+ * memory mapped temporary file standing in for the framebuffer device.
+ */
+public class LinuxFrameBufferTest {
+
+    // odd, so that the vector loops have a tail
+    private static final int WIDTH = 67;
+    private static final int HEIGHT = 13;
+    private static final int VIRTUAL_WIDTH = 80;
+    private static final byte UNTOUCHED = 0x5a;
+
+    @Test
+    public void testVerticalPages() {
+        LinuxFrameBufferShim fb = new LinuxFrameBufferShim(100, 50, 100, 100, 0, 0, 32);
+        assertTrue(fb.canDoubleBuffer());
+        assertEquals(50 * 100 * 4, fb.getNextAddress());
+
+        // the second page follows the first one, rows are virtual width apart
+        fb = new LinuxFrameBufferShim(100, 50, 120, 150, 10, 20, 32);
+        assertEquals((10 + 70 * 120) * 4, fb.getNextAddress());
+
+        // the first page is the lower one
+        fb = new LinuxFrameBufferShim(100, 50, 120, 150, 10, 60, 16);
+        assertEquals(10 * 2, fb.getNextAddress());
+    }
+
+    @Test
+    public void testHorizontalPages() {
+        LinuxFrameBufferShim fb = new LinuxFrameBufferShim(100, 50, 250, 50, 30, 0, 32);
+        assertTrue(fb.canDoubleBuffer());
+        assertEquals(130 * 4, fb.getNextAddress());
+
+        fb = new LinuxFrameBufferShim(100, 50, 250, 60, 120, 5, 16);
+        assertEquals(5 * 250 * 2, fb.getNextAddress());
+    }
+
+    @Test
+    public void testSinglePage() {
+        LinuxFrameBufferShim fb = new LinuxFrameBufferShim(100, 50, 120, 60, 7, 3, 32);
+        assertFalse(fb.canDoubleBuffer());
+        assertEquals((7 + 3 * 120) * 4, fb.getNextAddress());
+    }
+
+    private static byte[] expectedRows(ByteBuffer src, int depth) throws Exception {
+        if (depth == 32) {
+            byte[] rows = new byte[src.capacity()];
+            src.duplicate().clear().get(rows);
+            return rows;
+        }
+        // RGB565 has to match the conversion of Framebuffer.write
+        ByteBuffer pixels = ByteBuffer.allocate(src.capacity()).order(ByteOrder.nativeOrder());
+        pixels.put(src.duplicate().clear());
+        FramebufferShim fb = new FramebufferShim(pixels, WIDTH, HEIGHT, depth, false);
+        ByteArrayOutputStream out = new ByteArrayOutputStream();
+        fb.write(Channels.newChannel(out));
+        return out.toByteArray();
+    }
+
+    @ParameterizedTest
+    @ValueSource(ints = { 16, 32 })
+    public void testCopyRows(int depth) throws Exception {
+        assumeTrue(PlatformUtil.isLinux());
+        try {
+            LinuxSystemShim.loadLibrary();
+        } catch (UnsatisfiedLinkError e) {
+            assumeTrue(false, "Monocle is not available");
+        }
+        int byteDepth = depth / 8;
+        int stride = VIRTUAL_WIDTH * byteDepth;
+        int size = stride * HEIGHT * 2;
+        LinuxFrameBufferShim fb = new LinuxFrameBufferShim(WIDTH, HEIGHT, VIRTUAL_WIDTH,
+                                                           HEIGHT * 2, 3, 0, depth);
+        int offset = fb.getNextAddress();
+        assertEquals((3 + HEIGHT * VIRTUAL_WIDTH) * byteDepth, offset);
+
+        Random random = new Random(depth);
+        ByteBuffer src = ByteBuffer.allocateDirect(WIDTH * HEIGHT * 4).order(ByteOrder.nativeOrder());
+        while (src.hasRemaining()) {
+            src.putInt(random.nextInt());
+        }
+        int[] starts = new int[HEIGHT];
+        int[] ends = new int[HEIGHT];
+        for (int y = 0; y < HEIGHT; y++) {
+            switch (y % 4) {
+                case 0 -> { starts[y] = 0; ends[y] = WIDTH; }
+                case 1 -> { starts[y] = ends[y] = random.nextInt(WIDTH); }
+                case 2 -> { starts[y] = random.nextInt(WIDTH); ends[y] = starts[y] + 1; }
+                default -> {
+                    starts[y] = random.nextInt(WIDTH);
+                    ends[y] = starts[y] + random.nextInt(WIDTH - starts[y] + 1);
+                }
+            }
+        }
+
+        Path file = Files.createTempFile("fb", null);
+        byte[] actual;
+        try {
+            try (FileChannel channel = FileChannel.open(file, StandardOpenOption.READ,
+                                                        StandardOpenOption.WRITE)) {
+                MappedByteBuffer mapped = channel.map(FileChannel.MapMode.READ_WRITE, 0, size);
+                while (mapped.hasRemaining()) {
+                    mapped.put(UNTOUCHED);
+                }
+                fb.copyRows(src, mapped, offset, starts, ends);
+                mapped.force();
+            }
+            actual = Files.readAllBytes(file);
+        } finally {
+            Files.delete(file);
+        }
+
+        byte[] rows = expectedRows(src, depth);
+        byte[] expected = new byte[size];
+        Arrays.fill(expected, UNTOUCHED);
+        for (int y = 0; y < HEIGHT; y++) {
+            System.arraycopy(rows, (y * WIDTH + starts[y]) * byteDepth,
+                             expected, offset + y * stride + starts[y] * byteDepth,
+                             (ends[y] - starts[y]) * byteDepth);
+        }
+        assertArrayEquals(expected, actual);
+    }
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.glass.ui.monocle;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import com.sun.glass.ui.monocle.LinuxInputMultiplexerShim;
+import com.sun.glass.ui.monocle.LinuxInputMultiplexerShim.DeviceShim;
+import com.sun.glass.ui.monocle.LinuxSystemShim;
+import com.sun.javafx.PlatformUtil;
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.ArrayList;
+import java.util.List;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Feeds real evdev devices, created through /dev/uinput, to the
+ * LinuxInputMultiplexer. Nothing processes their events, as no application
+ * runs, so their buffers fill up. Requires write access to /dev/uinput.
+ */
+public class LinuxInputMultiplexerTest {
+
+    private static final int EV_SYN = 0;
+    private static final int EV_REL = 2;
+    private static final int REL_X = 0;
+    private static final int BUS_VIRTUAL = 0x06;
+    // struct uinput_user_dev
+    private static final int UINPUT_MAX_NAME_SIZE = 80;
+    private static final int UINPUT_USER_DEV_SIZE = UINPUT_MAX_NAME_SIZE + 8 + 4 + 4 * 64 * 4;
+    private static final long TIMEOUT = 5000;
+
+    private static int UI_SET_EVBIT;
+    private static int UI_SET_RELBIT;
+    private static final int UI_DEV_CREATE = 'U' << 8 | 1; // _IO('U', 1)
+    private static final int UI_DEV_DESTROY = 'U' << 8 | 2; // _IO('U', 2)
+
+    private final List<UInputDevice> devices = new ArrayList<>();
+
+    /** A virtual relative pointer device created through /dev/uinput */
+    private static class UInputDevice {
+        final long fd;
+        final DeviceShim shim;
+        final int eventSize = LinuxInputMultiplexerShim.getEventSize();
+        final ByteBuffer events = ByteBuffer.allocateDirect(eventSize * 2)
+                                            .order(ByteOrder.nativeOrder());
+
+        UInputDevice(String name) throws Exception {
+            fd = LinuxSystemShim.open("/dev/uinput",
+                                      LinuxSystemShim.O_WRONLY | LinuxSystemShim.O_NONBLOCK);
+            assumeTrue(fd >= 0, "/dev/uinput is not available");
+            LinuxSystemShim.ioctl(fd, UI_SET_EVBIT, EV_REL);
+            LinuxSystemShim.ioctl(fd, UI_SET_RELBIT, REL_X);
+            ByteBuffer setup = ByteBuffer.allocateDirect(UINPUT_USER_DEV_SIZE)
+                                         .order(ByteOrder.nativeOrder());
+            setup.put(name.getBytes(StandardCharsets.US_ASCII));
+            setup.position(UINPUT_MAX_NAME_SIZE);
+            setup.putShort((short) BUS_VIRTUAL).putShort((short) 1)
+                 .putShort((short) 1).putShort((short) 1);
+            write(setup, UINPUT_USER_DEV_SIZE);
+            if (LinuxSystemShim.ioctl(fd, UI_DEV_CREATE, 0) != 0) {
+                throw new IOException(LinuxSystemShim.getErrorMessage());
+            }
+            File sysPath = findSysPath(name);
+            shim = LinuxInputMultiplexerShim.addDevice(
+                    new File("/dev/input", sysPath.getName()), sysPath);
+        }
+
+        private static File findSysPath(String name) throws Exception {
+            long end = System.currentTimeMillis() + TIMEOUT;
+            while (System.currentTimeMillis() < end) {
+                File[] nodes = new File("/sys/class/input").listFiles(
+                        f -> f.getName().startsWith("event"));
+                for (File node : nodes == null ? new File[0] : nodes) {
+                    try {
+                        if (Files.readString(node.toPath().resolve("device/name")).trim().equals(name)) {
+                            return node;
+                        }
+                    } catch (IOException e) {
+                        // the device went away
+                    }
+                }
+                Thread.sleep(10);
+            }
+            throw new IOException("No event node for " + name);
+        }
+
+        private void write(ByteBuffer buffer, int length) throws IOException {
+            if (LinuxSystemShim.write(fd, buffer, 0, length) != length) {
+                throw new IOException(LinuxSystemShim.getErrorMessage());
+            }
+        }
+
+        private void putEvent(int index, int type, int code, int value) {
+            int offset = index * eventSize;
+            events.putShort(offset + eventSize - 8, (short) type);
+            events.putShort(offset + eventSize - 6, (short) code);
+            events.putInt(offset + eventSize - 4, value);
+        }
+
+        /** Writes an event made of a one pixel motion and its SYN_REPORT */
+        void move() throws IOException {
+            putEvent(0, EV_REL, REL_X, 1);
+            putEvent(1, EV_SYN, 0, 0);
+            write(events, events.capacity());
+        }
+
+        void awaitData() throws InterruptedException {
+            long end = System.currentTimeMillis() + TIMEOUT;
+            while (!shim.hasData() && System.currentTimeMillis() < end) {
+                Thread.sleep(10);
+            }
+            assertTrue(shim.hasData(), "no events read");
+        }
+
+        void dispose() {
+            LinuxInputMultiplexerShim.removeDevice(shim);
+            LinuxSystemShim.ioctl(fd, UI_DEV_DESTROY, 0);
+            LinuxSystemShim.close(fd);
+        }
+    }
+
+    @BeforeAll
+    public static void setupOnce() {
+        assumeTrue(PlatformUtil.isLinux());
+        System.setProperty("monocle.platform", "Headless");
+        try {
+            LinuxSystemShim.loadLibrary();
+        } catch (UnsatisfiedLinkError e) {
+            assumeTrue(false, "Monocle is not available");
+        }
+        UI_SET_EVBIT = LinuxSystemShim.IOW('U', 100, 4);
+        UI_SET_RELBIT = LinuxSystemShim.IOW('U', 102, 4);
+    }
+
+    @AfterEach
+    public void teardown() {
+        devices.forEach(UInputDevice::dispose);
+        devices.clear();
+    }
+
+    private UInputDevice createDevice(String name) throws Exception {
+        UInputDevice device = new UInputDevice(name + " " + ProcessHandle.current().pid());
+        devices.add(device);
+        return device;
+    }
+
+    private static void assertMove(List<int[]> lines) {
+        assertEquals(2, lines.size());
+        assertArrayEquals(new int[] { EV_REL, REL_X, 1 }, lines.get(0));
+        assertArrayEquals(new int[] { EV_SYN, 0, 0 }, lines.get(1));
+    }
+
+    @Test
+    public void testFullDeviceDoesNotBlockOthers() throws Exception {
+        UInputDevice flooded = createDevice("Flooded");
+        UInputDevice other = createDevice("Other");
+
+        // Far more lines than the buffer of the device holds, paced so that
+        // the kernel buffer of the device does not overflow as well
+        for (int i = 0; i < 2000; i++) {
+            flooded.move();
+            if (i % 16 == 0) {
+                Thread.sleep(1);
+            }
+        }
+        other.move();
+        other.awaitData();
+        assertMove(other.shim.takeEvents());
+
+        // only whole events were kept from the flooded device
+        List<int[]> lines = flooded.shim.takeEvents();
+        assertFalse(lines.isEmpty());
+        assertFalse(flooded.shim.hasData(), "an incomplete event was kept");
+        for (int[] line : lines) {
+            if (line[0] != EV_SYN) {
+                assertArrayEquals(new int[] { EV_REL, REL_X, 1 }, line);
+            }
+        }
+        assertEquals(EV_SYN, lines.get(lines.size() - 1)[0]);
+
+        // and the device is read again once there is room
+        flooded.move();
+        flooded.awaitData();
+        assertMove(flooded.shim.takeEvents());
+    }
+}
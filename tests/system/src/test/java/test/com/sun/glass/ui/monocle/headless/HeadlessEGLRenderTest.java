@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.glass.ui.monocle.headless;
+
+import java.util.concurrent.CountDownLatch;
+import javafx.application.Application;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.paint.Color;
+import javafx.scene.robot.Robot;
+import javafx.scene.shape.Rectangle;
+import javafx.stage.Stage;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import com.sun.prism.GraphicsPipeline;
+import test.util.Util;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Renders a scene with ES2 into the offscreen EGL surface of the HeadlessEGL
+ * platform and reads it back with a Robot. The test is skipped when EGL is
+ * not available and Prism falls back to the software pipeline.
+ */
+public class HeadlessEGLRenderTest {
+
+    private static final double TOLERANCE = 0.02;
+
+    private static CountDownLatch startupLatch = new CountDownLatch(1);
+
+    private static Scene scene;
+
+    public static class TestApp extends Application {
+        @Override
+        public void start(Stage stage) {
+            Rectangle rect = new Rectangle(50, 50, 100, 100);
+            rect.setFill(Color.RED);
+            scene = new Scene(new Group(rect), 200, 200, Color.BLUE);
+            stage.setScene(scene);
+            stage.setX(0);
+            stage.setY(0);
+            stage.setOnShown(e -> startupLatch.countDown());
+            stage.show();
+        }
+    }
+
+    @BeforeAll
+    public static void setup() throws Exception {
+        System.setProperty("glass.platform", "Monocle");
+        System.setProperty("monocle.platform", "HeadlessEGL");
+        System.setProperty("prism.order", "es2,sw");
+        // llvmpipe does not pass the GPU qualification
+        System.setProperty("prism.forceGPU", "true");
+        System.setProperty("headless.geometry", "200x200");
+
+        Util.launch(startupLatch, TestApp.class);
+        Assertions.assertEquals(0, startupLatch.getCount());
+    }
+
+    @AfterAll
+    public static void shutdown() {
+        Util.shutdown();
+    }
+
+    private static void assertColor(Color expected, Color actual) {
+        Assertions.assertEquals(expected.getRed(), actual.getRed(), TOLERANCE);
+        Assertions.assertEquals(expected.getGreen(), actual.getGreen(), TOLERANCE);
+        Assertions.assertEquals(expected.getBlue(), actual.getBlue(), TOLERANCE);
+    }
+
+    @Test
+    public void renderOffscreen() {
+        assumeTrue(GraphicsPipeline.getPipeline().getClass().getName()
+                .endsWith("ES2Pipeline"), "EGL is not available");
+
+        Robot[] robot = new Robot[1];
+        Util.runAndWait(() -> robot[0] = new Robot());
+        // Creating the robot repaints the scene into the captured frame
+        Util.waitForIdle(scene);
+
+        Color[] colors = new Color[2];
+        Util.runAndWait(() -> {
+            colors[0] = robot[0].getPixelColor(100, 100);
+            colors[1] = robot[0].getPixelColor(10, 10);
+        });
+        assertColor(Color.RED, colors[0]);
+        assertColor(Color.BLUE, colors[1]);
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.font.freetype;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.javafx.PlatformUtil;
+import com.sun.javafx.font.CompositeFontResource;
+import com.sun.javafx.font.FontResource;
+import com.sun.javafx.font.FontStrike;
+import com.sun.javafx.font.Glyph;
+import com.sun.javafx.font.PGFont;
+import com.sun.javafx.font.freetype.FTGlyphShim;
+import com.sun.javafx.geom.transform.BaseTransform;
+import com.sun.javafx.scene.text.FontHelper;
+import javafx.scene.text.Font;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+
+/**
+ * Checks that glyphs rasterized in a batch by FTFontStrike.prepareGlyphs
+ * match the ones rasterized one by one.
+ */
+public class GlyphBatchTest {
+
+    private static final String TEXT =
+        "The quick brown fox jumps over the lazy dog 0123456789 {}[]()!?";
+
+    private static FontResource getPhysicalFont() {
+        PGFont font = (PGFont) FontHelper.getNativeFont(Font.font("System", 24));
+        FontResource resource = font.getFontResource();
+        if (resource instanceof CompositeFontResource composite) {
+            resource = composite.getSlotResource(0);
+        }
+        return resource;
+    }
+
+    @ParameterizedTest
+    @ValueSource(ints = { FontResource.AA_GREYSCALE, FontResource.AA_LCD })
+    public void testBatchMatchesSingleGlyphs(int aaMode) {
+        assumeTrue(PlatformUtil.isLinux());
+        FontResource resource = getPhysicalFont();
+
+        int[] glyphCodes = TEXT.codePoints()
+                .map(cp -> resource.getGlyphMapper().charToGlyph(cp))
+                .distinct()
+                .toArray();
+
+        // Both sizes map to the same 26.6 FreeType size, but are different
+        // strikes, so none of the glyphs of the second one were rendered yet
+        FontStrike single = resource.getStrike(24f, BaseTransform.IDENTITY_TRANSFORM, aaMode);
+        FontStrike batch = resource.getStrike(24.001f, BaseTransform.IDENTITY_TRANSFORM, aaMode);
+        batch.prepareGlyphs(glyphCodes, glyphCodes.length);
+
+        // Rendered by the batch, before anything could fall back to the
+        // per-glyph path
+        for (int gc : glyphCodes) {
+            assertTrue(FTGlyphShim.isRendered(batch.getGlyph(gc)), "glyph " + gc + " not batched");
+        }
+
+        for (int gc : glyphCodes) {
+            Glyph expected = single.getGlyph(gc);
+            Glyph actual = batch.getGlyph(gc);
+            String msg = "glyph " + gc;
+            assertArrayEquals(expected.getPixelData(), actual.getPixelData(), msg);
+            assertEquals(expected.getWidth(), actual.getWidth(), msg);
+            assertEquals(expected.getHeight(), actual.getHeight(), msg);
+            assertEquals(expected.getOriginX(), actual.getOriginX(), msg);
+            assertEquals(expected.getOriginY(), actual.getOriginY(), msg);
+            assertEquals(expected.getPixelXAdvance(), actual.getPixelXAdvance(), msg);
+            assertEquals(expected.getPixelYAdvance(), actual.getPixelYAdvance(), msg);
+            assertEquals(expected.isLCDGlyph(), actual.isLCDGlyph(), msg);
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.font.freetype;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertNull;
+import static org.junit.jupiter.api.Assertions.assertSame;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.javafx.PlatformUtil;
+import com.sun.javafx.font.CompositeFontResource;
+import com.sun.javafx.font.FontResource;
+import com.sun.javafx.font.FontStrike;
+import com.sun.javafx.font.PGFont;
+import com.sun.javafx.geom.RectBounds;
+import com.sun.javafx.geom.Shape;
+import com.sun.javafx.geom.transform.BaseTransform;
+import com.sun.javafx.scene.text.FontHelper;
+import javafx.scene.text.Font;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Checks the glyph outlines returned through the native outline cache
+ * shared by the strikes of a FreeType face.
+ */
+public class GlyphOutlineCacheTest {
+
+    private FontResource resource;
+    private int glyphCode;
+
+    @BeforeEach
+    public void setUp() {
+        assumeTrue(PlatformUtil.isLinux());
+        PGFont font = (PGFont) FontHelper.getNativeFont(Font.font("System", 24));
+        resource = font.getFontResource();
+        if (resource instanceof CompositeFontResource composite) {
+            resource = composite.getSlotResource(0);
+        }
+        glyphCode = resource.getGlyphMapper().charToGlyph('A');
+    }
+
+    private Shape getOutline(float size, int code) {
+        FontStrike strike = resource.getStrike(size, BaseTransform.IDENTITY_TRANSFORM);
+        return strike.getGlyph(code).getShape();
+    }
+
+    @Test
+    public void testOutlineIsShared() {
+        // Both sizes map to the same 26.6 FreeType size
+        Shape outline = getOutline(24f, glyphCode);
+        assertNotNull(outline);
+        assertSame(outline, getOutline(24f, glyphCode));
+        assertSame(outline, getOutline(24.001f, glyphCode));
+    }
+
+    @Test
+    public void testOutlineMatchesSize() {
+        RectBounds small = getOutline(24f, glyphCode).getBounds();
+        RectBounds large = getOutline(48f, glyphCode).getBounds();
+        assertTrue(small.getWidth() > 0 && small.getHeight() > 0);
+        assertEquals(2 * small.getWidth(), large.getWidth(), 1f);
+        assertEquals(2 * small.getHeight(), large.getHeight(), 1f);
+    }
+
+    @Test
+    public void testInvalidGlyphIsNotCached() {
+        int invalid = 0xFFFFFF;
+        assertNull(getOutline(24f, invalid));
+        assertNull(getOutline(24f, invalid));
+        // The face is still usable after the failed load
+        assertNotNull(getOutline(24f, glyphCode));
+    }
+}
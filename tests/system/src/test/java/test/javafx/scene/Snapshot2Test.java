@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -425,6 +425,20 @@ public final class Snapshot2Test extends SnapshotCommon {
         return true;
     }
 
+    @ParameterizedTest
+    @MethodSource("parameters")
+    public void testSnapshot1x1TileImm(boolean live, boolean useImage) {
+        setupEach(live, useImage);
+        doTestTiledSnapshotImm(live, useImage, 301, 157);
+    }
+
+    @ParameterizedTest
+    @MethodSource("parameters")
+    public void testSnapshot1x1TileDefer(boolean live, boolean useImage) {
+        setupEach(live, useImage);
+        doTestTiledSnapshotDefer(live, useImage, 301, 157);
+    }
+
     @ParameterizedTest
     @MethodSource("parameters")
     public void testSnapshot2x1TilesSameSizeImm(boolean live, boolean useImage) {
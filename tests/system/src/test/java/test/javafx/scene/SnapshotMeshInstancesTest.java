@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene;
+
+import javafx.application.ConditionalFeature;
+import javafx.application.Platform;
+import javafx.scene.AmbientLight;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.image.PixelReader;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.paint.PhongMaterial;
+import javafx.scene.shape.CullFace;
+import javafx.scene.shape.MeshView;
+import javafx.scene.shape.TriangleMesh;
+
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+import test.util.Util;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Checks that mesh views sharing a mesh, which the ES2 pipeline draws as
+ * instances, each keep their own transform and diffuse color.
+ */
+public class SnapshotMeshInstancesTest extends SnapshotCommon {
+
+    static final int CELL = 20;
+    static final int COLUMNS = 8;
+    static final int ROWS = 6;
+
+    @BeforeAll
+    public static void setupOnce() {
+        doSetupOnce();
+    }
+
+    @AfterAll
+    public static void teardownOnce() {
+        doTeardownOnce();
+    }
+
+    private static Color cellColor(int col, int row) {
+        return Color.rgb(col * 255 / (COLUMNS - 1), row * 255 / (ROWS - 1),
+                         (col + row) % 2 == 0 ? 255 : 0);
+    }
+
+    private static Scene buildScene(boolean textured) {
+        TriangleMesh mesh = new TriangleMesh();
+        mesh.getPoints().addAll(0, 0, 0, CELL, 0, 0, CELL, CELL, 0, 0, CELL, 0);
+        mesh.getTexCoords().addAll(0, 0);
+        mesh.getFaces().addAll(0, 0, 1, 0, 2, 0, 0, 0, 2, 0, 3, 0);
+
+        WritableImage white = null;
+        if (textured) {
+            white = new WritableImage(1, 1);
+            white.getPixelWriter().setArgb(0, 0, 0xffffffff);
+        }
+
+        // an ambient light only leaves the diffuse color of each view
+        Group root = new Group(new AmbientLight(Color.WHITE));
+        for (int row = 0; row < ROWS; row++) {
+            for (int col = 0; col < COLUMNS; col++) {
+                PhongMaterial material = new PhongMaterial(cellColor(col, row));
+                material.setDiffuseMap(white);
+                MeshView view = new MeshView(mesh);
+                view.setCullFace(CullFace.NONE);
+                view.setMaterial(material);
+                view.setTranslateX(col * CELL);
+                view.setTranslateY(row * CELL);
+                root.getChildren().add(view);
+            }
+        }
+        return new Scene(root, COLUMNS * CELL, ROWS * CELL, true);
+    }
+
+    @ParameterizedTest
+    @ValueSource(booleans = { false, true })
+    public void testInstancesKeepTheirColor(boolean textured) {
+        assumeTrue(Platform.isSupported(ConditionalFeature.SCENE3D));
+        Util.runAndWait(() -> {
+            WritableImage snapshot = buildScene(textured).snapshot(null);
+            PixelReader reader = snapshot.getPixelReader();
+            for (int row = 0; row < ROWS; row++) {
+                for (int col = 0; col < COLUMNS; col++) {
+                    Color expected = cellColor(col, row);
+                    Color actual = reader.getColor(col * CELL + CELL / 2, row * CELL + CELL / 2);
+                    String msg = "cell " + col + ", " + row;
+                    assertEquals(expected.getRed(), actual.getRed(), 0.02, msg);
+                    assertEquals(expected.getGreen(), actual.getGreen(), 0.02, msg);
+                    assertEquals(expected.getBlue(), actual.getBlue(), 0.02, msg);
+                }
+            }
+        });
+    }
+}